@@ -148,6 +148,10 @@ public class CesiumRuntime : ModuleRules
                     "MaterialEditor"
                 }
             );
+
+            // Used to build Nanite resources for tiles, which is only
+            // possible in the Editor.
+            PrivateDependencyModuleNames.Add("NaniteBuilder");
         }
 
         DynamicallyLoadedModuleNames.AddRange(
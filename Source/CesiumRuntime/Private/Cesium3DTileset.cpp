@@ -26,12 +26,24 @@
 #include "CesiumGltfComponent.h"
 #include "CesiumGltfPointsSceneProxyUpdater.h"
 #include "CesiumGltfPrimitiveComponent.h"
+#include "CesiumGpuEviction.h"
+#include "CesiumMaterialInstanceCache.h"
+#include "CesiumMetadataPickingBlueprintLibrary.h"
 #include "CesiumIonClient/Connection.h"
+#include "CesiumNaniteBuilder.h"
+#include "CesiumPrimitive.h"
+#include "CesiumPrimitiveFeatures.h"
 #include "CesiumRasterOverlay.h"
+#include "CesiumRasterOverlayAtlas.h"
+#include "CesiumRasterOverlayParameterNames.h"
 #include "CesiumRuntime.h"
 #include "CesiumRuntimeSettings.h"
+#include "CesiumTextureResource.h"
 #include "CesiumTileExcluder.h"
+#include "CesiumTileObjectPool.h"
+#include "CesiumTriangleBvh.h"
 #include "CesiumViewExtension.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "Components/SceneCaptureComponent2D.h"
 #include "Engine/Engine.h"
 #include "Engine/LocalPlayer.h"
@@ -217,6 +229,155 @@ void ACesium3DTileset::SampleHeightMostDetailed(
       });
 }
 
+namespace {
+/**
+ * Traces a segment against a picking hierarchy placed in the world with the
+ * given transform, and updates the hit if the new intersection is closer.
+ */
+void lineTracePickingBvh(
+    const CesiumTriangleBvh& bvh,
+    const FTransform& transform,
+    UPrimitiveComponent* pComponent,
+    int32 item,
+    const FVector& start,
+    const FVector& end,
+    FHitResult& hit) {
+  const std::optional<CesiumTriangleBvh::Hit> maybeHit = bvh.lineTrace(
+      FVector3f(transform.InverseTransformPosition(start)),
+      FVector3f(transform.InverseTransformPosition(end)));
+  if (!maybeHit || (hit.bBlockingHit && maybeHit->time >= hit.Time)) {
+    return;
+  }
+
+  // Normals transform by the inverse transpose, which for an FTransform is
+  // the rotation applied after the reciprocal of the scale.
+  const FVector direction = end - start;
+  const FVector inverseScale =
+      FTransform::GetSafeScaleReciprocal(transform.GetScale3D());
+  FVector normal =
+      transform.GetRotation()
+          .RotateVector(FVector(maybeHit->normal) * inverseScale)
+          .GetSafeNormal();
+  if ((normal | direction) > 0.0) {
+    normal = -normal;
+  }
+
+  const FVector location =
+      transform.TransformPosition(FVector(maybeHit->position));
+
+  hit = FHitResult(pComponent->GetOwner(), pComponent, location, normal);
+  hit.bBlockingHit = true;
+  hit.Time = maybeHit->time;
+  hit.Distance = (location - start).Size();
+  hit.TraceStart = start;
+  hit.TraceEnd = end;
+  hit.FaceIndex = maybeHit->faceIndex;
+  hit.Item = item;
+}
+} // namespace
+
+bool ACesium3DTileset::LineTraceTileset(
+    const FVector& Start,
+    const FVector& End,
+    FHitResult& OutHit) const {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::LineTraceTileset)
+
+  OutHit = FHitResult(Start, End);
+
+  const FVector direction = End - Start;
+  if (direction.IsNearlyZero()) {
+    return false;
+  }
+
+  TArray<UCesiumGltfComponent*> gltfComponents;
+  this->GetComponents<UCesiumGltfComponent>(gltfComponents);
+
+  for (UCesiumGltfComponent* pGltf : gltfComponents) {
+    if (!IsValid(pGltf) || !pGltf->IsVisible()) {
+      continue;
+    }
+
+    for (USceneComponent* pChild : pGltf->GetAttachChildren()) {
+      auto* pMesh = Cast<UStaticMeshComponent>(pChild);
+      const auto* pCesiumPrimitive = Cast<ICesiumPrimitive>(pChild);
+      if (!IsValid(pMesh) || !pCesiumPrimitive || !pMesh->IsVisible()) {
+        continue;
+      }
+
+      const TSharedPtr<const CesiumTriangleBvh>& pBvh =
+          pCesiumPrimitive->getPrimitiveData().pPickingBvh;
+      if (!pBvh ||
+          !FMath::LineBoxIntersection(
+              pMesh->Bounds.GetBox(),
+              Start,
+              End,
+              direction)) {
+        continue;
+      }
+
+      if (auto* pInstanced = Cast<UInstancedStaticMeshComponent>(pMesh)) {
+        for (int32 i = 0; i < pInstanced->GetInstanceCount(); ++i) {
+          FTransform instanceTransform;
+          if (pInstanced->GetInstanceTransform(i, instanceTransform, true)) {
+            lineTracePickingBvh(
+                *pBvh,
+                instanceTransform,
+                pMesh,
+                i,
+                Start,
+                End,
+                OutHit);
+          }
+        }
+      } else {
+        lineTracePickingBvh(
+            *pBvh,
+            pMesh->GetComponentTransform(),
+            pMesh,
+            INDEX_NONE,
+            Start,
+            End,
+            OutHit);
+      }
+    }
+  }
+
+  return OutHit.bBlockingHit;
+}
+
+bool ACesium3DTileset::PickFeature(
+    const FVector& Start,
+    const FVector& End,
+    FHitResult& OutHit,
+    FVector2D& OutUV,
+    int64& OutFeatureID,
+    int64 FeatureIDSetIndex,
+    int64 GltfTexCoordSetIndex) const {
+  OutUV = FVector2D::Zero();
+  OutFeatureID = -1;
+
+  if (!this->LineTraceTileset(Start, End, OutHit)) {
+    return false;
+  }
+
+  if (!UCesiumMetadataPickingBlueprintLibrary::FindUVFromHit(
+          OutHit,
+          GltfTexCoordSetIndex,
+          OutUV)) {
+    OutUV = FVector2D::Zero();
+  }
+
+  const FCesiumPrimitiveFeatures& features =
+      UCesiumPrimitiveFeaturesBlueprintLibrary::GetPrimitiveFeatures(
+          OutHit.GetComponent());
+  OutFeatureID = UCesiumPrimitiveFeaturesBlueprintLibrary::GetFeatureIDFromHit(
+      features,
+      OutHit,
+      FeatureIDSetIndex);
+
+  return true;
+}
+
 void ACesium3DTileset::SetGeoreference(
     TSoftObjectPtr<ACesiumGeoreference> NewGeoreference) {
   this->Georeference = NewGeoreference;
@@ -492,6 +653,13 @@ void ACesium3DTileset::SetCreatePhysicsMeshes(bool bCreatePhysicsMeshes) {
   }
 }
 
+void ACesium3DTileset::SetCreatePickingBvhs(bool bCreatePickingBvhs) {
+  if (this->CreatePickingBvhs != bCreatePickingBvhs) {
+    this->CreatePickingBvhs = bCreatePickingBvhs;
+    this->DestroyTileset();
+  }
+}
+
 void ACesium3DTileset::SetCreateNavCollision(bool bCreateNavCollision) {
   if (this->CreateNavCollision != bCreateNavCollision) {
     this->CreateNavCollision = bCreateNavCollision;
@@ -528,6 +696,67 @@ void ACesium3DTileset::SetIgnoreKhrMaterialsUnlit(
   }
 }
 
+void ACesium3DTileset::SetEnableNanite(bool bEnableNanite) {
+  if (this->EnableNanite != bEnableNanite) {
+    this->EnableNanite = bEnableNanite;
+    this->DestroyTileset();
+  }
+}
+
+void ACesium3DTileset::SetTextureCompression(
+    ECesiumTextureCompression NewCompression) {
+  if (this->TextureCompression != NewCompression) {
+    this->TextureCompression = NewCompression;
+    this->DestroyTileset();
+  }
+}
+
+void ACesium3DTileset::SetEvictHiddenTileGpuResources(
+    bool bEvictHiddenTileGpuResources) {
+  if (this->EvictHiddenTileGpuResources != bEvictHiddenTileGpuResources) {
+    this->EvictHiddenTileGpuResources = bEvictHiddenTileGpuResources;
+    this->DestroyTileset();
+  }
+}
+
+void ACesium3DTileset::SetStreamTextureMips(bool bStreamTextureMips) {
+  if (this->StreamTextureMips != bStreamTextureMips) {
+    this->StreamTextureMips = bStreamTextureMips;
+    this->DestroyTileset();
+  }
+}
+
+void ACesium3DTileset::SetReleaseGltfBuffersAfterLoad(
+    bool bReleaseGltfBuffersAfterLoad) {
+  if (this->ReleaseGltfBuffersAfterLoad != bReleaseGltfBuffersAfterLoad) {
+    this->ReleaseGltfBuffersAfterLoad = bReleaseGltfBuffersAfterLoad;
+    this->DestroyTileset();
+  }
+}
+
+void ACesium3DTileset::SetShareMaterialInstances(bool bShareMaterialInstances) {
+  if (this->ShareMaterialInstances != bShareMaterialInstances) {
+    this->ShareMaterialInstances = bShareMaterialInstances;
+    this->DestroyTileset();
+  }
+}
+
+void ACesium3DTileset::SetEnableRasterOverlayAtlas(
+    bool bEnableRasterOverlayAtlas) {
+  if (this->EnableRasterOverlayAtlas != bEnableRasterOverlayAtlas) {
+    this->EnableRasterOverlayAtlas = bEnableRasterOverlayAtlas;
+    this->DestroyTileset();
+  }
+}
+
+void ACesium3DTileset::SetCompositeRasterOverlays(
+    bool bCompositeRasterOverlays) {
+  if (this->CompositeRasterOverlays != bCompositeRasterOverlays) {
+    this->CompositeRasterOverlays = bCompositeRasterOverlays;
+    this->DestroyTileset();
+  }
+}
+
 void ACesium3DTileset::SetMaterial(UMaterialInterface* InMaterial) {
   if (this->Material != InMaterial) {
     this->Material = InMaterial;
@@ -560,8 +789,15 @@ void ACesium3DTileset::SetCustomDepthParameters(
 void ACesium3DTileset::SetPointCloudShading(
     FCesiumPointCloudShading InPointCloudShading) {
   if (PointCloudShading != InPointCloudShading) {
+    // Points are only sorted for decimation as tiles load.
+    const bool decimationChanged =
+        PointCloudShading.Decimation != InPointCloudShading.Decimation;
     PointCloudShading = InPointCloudShading;
-    FCesiumGltfPointsSceneProxyUpdater::UpdateSettingsInProxies(this);
+    if (decimationChanged) {
+      this->DestroyTileset();
+    } else {
+      FCesiumGltfPointsSceneProxyUpdater::UpdateSettingsInProxies(this);
+    }
   }
 }
 
@@ -984,8 +1220,19 @@ void ACesium3DTileset::LoadTileset() {
   CesiumGeospatial::Ellipsoid pNativeEllipsoid =
       this->ResolveGeoreference()->GetEllipsoid()->GetNativeEllipsoid();
 
+  if (this->EnableNanite) {
+    // The Nanite builder module must be loaded from the game thread before
+    // tiles start building Nanite resources in worker threads.
+    CesiumNaniteBuilder::initialize();
+  }
+
   ACesiumCreditSystem* pCreditSystem = this->ResolvedCreditSystem;
 
+  // The renderer resources take the atlas when they're created.
+  if (this->EnableRasterOverlayAtlas) {
+    this->_pRasterOverlayAtlas = MakeShared<CesiumRasterOverlayAtlas>();
+  }
+
   Cesium3DTilesSelection::TilesetExternals externals{
       pAssetAccessor,
       std::make_shared<UnrealPrepareRendererResources>(this),
@@ -1140,6 +1387,10 @@ void ACesium3DTileset::LoadTileset() {
     break;
   }
 
+  if (this->ShareMaterialInstances) {
+    this->_pMaterialInstanceCache = MakeShared<CesiumMaterialInstanceCache>();
+  }
+
 #ifdef CESIUM_DEBUG_TILE_STATES
   FString dbDirectory = FPaths::Combine(
       FPaths::ProjectSavedDir(),
@@ -1267,6 +1518,15 @@ void ACesium3DTileset::DestroyTileset() {
   this->_pTileset->getAsyncDestructionCompleteEvent().thenInMainThread(
       [this]() { --this->_tilesetsBeingDestroyed; });
   this->_pTileset.Reset();
+  this->_gltfBuffersReleased = false;
+  this->_pMaterialInstanceCache.Reset();
+  this->_pRasterOverlayAtlas.Reset();
+
+  // Pooled objects may have been created with settings that are about to
+  // change.
+  if (this->_pTileObjectPool) {
+    this->_pTileObjectPool->clear();
+  }
 
   switch (this->TilesetSource) {
   case ETilesetSource::FromEllipsoid:
@@ -1791,7 +2051,19 @@ void ACesium3DTileset::updateTilesetOptionsFromProperties() {
       this->_pTileset->getOptions();
   options.maximumScreenSpaceError =
       static_cast<double>(this->MaximumScreenSpaceError);
-  options.maximumCachedBytes = this->MaximumCachedBytes;
+  // cesium-native only counts the glTF buffers and images of loaded tiles
+  // toward the cache size, so the budget it sees is reduced by the memory
+  // used by Unreal-side resources that it doesn't know about.
+  const int64 unrealOnlyBytes = this->_memoryStatistics.VertexBufferBytes +
+                                this->_memoryStatistics.IndexBufferBytes +
+                                this->_memoryStatistics.MeshCpuCopyBytes +
+                                this->_memoryStatistics.CollisionMeshBytes +
+                                this->_memoryStatistics
+                                    .EncodedMetadataTextureBytes +
+                                this->_memoryStatistics
+                                    .RasterOverlayCompositeBytes;
+  options.maximumCachedBytes =
+      FMath::Max<int64>(0, this->MaximumCachedBytes - unrealOnlyBytes);
   options.preloadAncestors = this->PreloadAncestors;
   options.preloadSiblings = this->PreloadSiblings;
   options.forbidHoles = this->ForbidHoles;
@@ -1814,6 +2086,51 @@ void ACesium3DTileset::updateTilesetOptionsFromProperties() {
   // options.kickDescendantsWhileFadingIn = false;
 }
 
+CesiumRasterOverlayParameterNameCache&
+ACesium3DTileset::getRasterOverlayParameterNameCache() {
+  if (!this->_pRasterOverlayParameterNames) {
+    this->_pRasterOverlayParameterNames =
+        MakeShared<CesiumRasterOverlayParameterNameCache>();
+  }
+  return *this->_pRasterOverlayParameterNames;
+}
+
+void ACesium3DTileset::scheduleRasterTileUpdates(UCesiumGltfComponent& gltf) {
+  if (this->_deferRasterTileUpdates) {
+    this->_tilesWithRasterTileUpdates.Add(&gltf);
+  } else {
+    gltf.ApplyRasterTileUpdates();
+  }
+}
+
+void ACesium3DTileset::applyScheduledRasterTileUpdates() {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::ApplyScheduledRasterTileUpdates)
+
+  for (const TWeakObjectPtr<UCesiumGltfComponent>& pGltf :
+       this->_tilesWithRasterTileUpdates) {
+    // Tiles that were unloaded in the meantime are no longer valid.
+    if (pGltf.IsValid()) {
+      pGltf->ApplyRasterTileUpdates();
+    }
+  }
+  this->_tilesWithRasterTileUpdates.Reset();
+}
+
+void ACesium3DTileset::updateTileObjectPoolFromProperties() {
+  if (this->EnableTileObjectPooling) {
+    if (!this->_pTileObjectPool) {
+      this->_pTileObjectPool =
+          MakeShared<CesiumTileObjectPool>(this->MaximumPooledObjects);
+    } else {
+      this->_pTileObjectPool->setMaximumObjectsPerType(
+          this->MaximumPooledObjects);
+    }
+  } else if (this->_pTileObjectPool) {
+    this->_pTileObjectPool->clear();
+    this->_pTileObjectPool.Reset();
+  }
+}
+
 void ACesium3DTileset::updateLastViewUpdateResultState(
     const Cesium3DTilesSelection::ViewUpdateResult& result) {
   TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::updateLastViewUpdateResultState)
@@ -1968,6 +2285,140 @@ void ACesium3DTileset::showTilesToRender(
       });
 }
 
+void ACesium3DTileset::updateTextureStreaming(
+    const std::vector<Cesium3DTilesSelection::ViewState>& frustums,
+    const std::vector<Cesium3DTilesSelection::Tile::ConstPointer>& tiles) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::UpdateTextureStreaming)
+
+  const uint64 frame = GFrameCounter;
+  const CesiumGeospatial::Ellipsoid& ellipsoid =
+      this->ResolveGeoreference()->GetEllipsoid()->GetNativeEllipsoid();
+
+  forEachRenderableTile(
+      tiles,
+      [&frustums, &ellipsoid, frame](
+          const Cesium3DTilesSelection::Tile::ConstPointer& pTile,
+          UCesiumGltfComponent* pGltf) {
+        if (pGltf->StreamedTextures.IsEmpty()) {
+          return;
+        }
+
+        const Cesium3DTilesSelection::BoundingVolume& boundingVolume =
+            pTile->getBoundingVolume();
+        const double diameter = glm::length(
+            Cesium3DTilesSelection::getOrientedBoundingBoxFromBoundingVolume(
+                boundingVolume,
+                ellipsoid)
+                .getLengths());
+
+        // The screen-space error formula projects a length at a distance to
+        // pixels, so it also gives the size of the tile on screen.
+        double screenSize = 0.0;
+        for (const Cesium3DTilesSelection::ViewState& frustum : frustums) {
+          const double distance = glm::sqrt(glm::max(
+              frustum.computeDistanceSquaredToBoundingVolume(boundingVolume),
+              0.0));
+          screenSize = glm::max(
+              screenSize,
+              frustum.computeScreenSpaceError(diameter, distance));
+        }
+
+        pGltf->RequestTextureMips(screenSize, frame);
+      });
+
+  const double budgetBytes =
+      double(GetDefault<UCesiumRuntimeSettings>()->TextureStreamingBudget) *
+      1024.0 * 1024.0;
+  const bool memoryPressure =
+      double(FCesiumStreamedTextureResource::GetTotalResidentBytes()) >
+      budgetBytes;
+
+  // Hidden tiles' textures are included, so that their finer mips can be
+  // dropped.
+  for (const auto& entry : this->_streamedTextureTileCounts) {
+    entry.Key->UpdateStreaming(frame, memoryPressure);
+  }
+}
+
+void ACesium3DTileset::registerStreamedTextures(
+    const TArray<TSharedPtr<FCesiumStreamedTextureResource>>& textures) {
+  for (const TSharedPtr<FCesiumStreamedTextureResource>& pTexture : textures) {
+    ++this->_streamedTextureTileCounts.FindOrAdd(pTexture, 0);
+  }
+}
+
+void ACesium3DTileset::unregisterStreamedTextures(
+    const TArray<TSharedPtr<FCesiumStreamedTextureResource>>& textures) {
+  for (const TSharedPtr<FCesiumStreamedTextureResource>& pTexture : textures) {
+    int32* pTileCount = this->_streamedTextureTileCounts.Find(pTexture);
+    if (pTileCount && --*pTileCount <= 0) {
+      this->_streamedTextureTileCounts.Remove(pTexture);
+    }
+  }
+}
+
+void ACesium3DTileset::registerSharedTextures(
+    const TMap<
+        TSharedPtr<FCesiumTextureResource>,
+        FCesium3DTilesetMemoryStatistics>& textures) {
+  for (const auto& entry : textures) {
+    int32& tileCount = this->_sharedTextureTileCounts.FindOrAdd(entry.Key, 0);
+    if (tileCount++ == 0) {
+      this->_memoryStatistics += entry.Value;
+    }
+  }
+}
+
+void ACesium3DTileset::unregisterSharedTextures(
+    const TMap<
+        TSharedPtr<FCesiumTextureResource>,
+        FCesium3DTilesetMemoryStatistics>& textures) {
+  for (const auto& entry : textures) {
+    int32* pTileCount = this->_sharedTextureTileCounts.Find(entry.Key);
+    if (pTileCount && --*pTileCount <= 0) {
+      this->_sharedTextureTileCounts.Remove(entry.Key);
+      this->_memoryStatistics -= entry.Value;
+    }
+  }
+}
+
+void ACesium3DTileset::evictHiddenTileGpuResources() {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::EvictHiddenTileGpuResources)
+
+  const uint64 frame = GFrameCounter;
+  const uint64 delay =
+      uint64(FMath::Max(this->HiddenFramesBeforeGpuEviction, 0));
+
+  TArray<UCesiumGltfComponent*> hiddenTiles;
+  TArray<CesiumGpuEviction::HiddenTile> hiddenTileInfos;
+  for (USceneComponent* pChild : this->RootComponent->GetAttachChildren()) {
+    UCesiumGltfComponent* pGltf = Cast<UCesiumGltfComponent>(pChild);
+    if (!pGltf) {
+      continue;
+    }
+    if (pGltf->IsVisible() || pGltf->LastVisibleFrame == 0) {
+      pGltf->LastVisibleFrame = frame;
+      continue;
+    }
+    if (pGltf->AreGpuResourcesEvicted()) {
+      continue;
+    }
+
+    hiddenTiles.Add(pGltf);
+    hiddenTileInfos.Add(CesiumGpuEviction::HiddenTile{
+        pGltf->GetEvictableGpuBytes(),
+        pGltf->LastVisibleFrame});
+  }
+
+  for (int32 i : CesiumGpuEviction::chooseTilesToEvict(
+           hiddenTileInfos,
+           frame,
+           delay,
+           this->MaximumHiddenTileGpuBytes)) {
+    hiddenTiles[i]->EvictGpuResources(frame);
+  }
+}
+
 static void updateTileFades(const auto& tiles, bool fadingIn) {
   forEachRenderableTile(
       tiles,
@@ -2028,8 +2479,18 @@ void ACesium3DTileset::Tick(float DeltaTime) {
   }
 
   updateTilesetOptionsFromProperties();
+  updateTileObjectPoolFromProperties();
 
   std::vector<FCesiumCamera> cameras = this->GetCameras();
+  const double previousViewportSize = this->_largestViewportSize;
+  if (!cameras.empty()) {
+    this->_largestViewportSize = 0.0;
+    for (const FCesiumCamera& camera : cameras) {
+      this->_largestViewportSize = FMath::Max(
+          this->_largestViewportSize,
+          FMath::Max(camera.ViewportSize.X, camera.ViewportSize.Y));
+    }
+  }
 
   glm::dmat4 ueTilesetToUeWorld =
       VecMath::createMatrix4D(this->GetActorTransform().ToMatrixWithScale());
@@ -2056,6 +2517,10 @@ void ACesium3DTileset::Tick(float DeltaTime) {
         ellipsoid));
   }
 
+  // Raster overlay changes made while updating are applied all at once
+  // afterward.
+  this->_deferRasterTileUpdates = true;
+
   const Cesium3DTilesSelection::ViewUpdateResult* pResult;
   if (this->_captureMovieMode) {
     TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::updateViewOffline)
@@ -2075,6 +2540,29 @@ void ACesium3DTileset::Tick(float DeltaTime) {
     this->_pTileset->loadTiles();
   }
 
+  // Composites are no larger than the viewport, so the ones made for a
+  // smaller viewport, or before there was one, are rebuilt when it grows.
+  if (this->CompositeRasterOverlays &&
+      this->_largestViewportSize > previousViewportSize) {
+    TArray<UCesiumGltfComponent*> gltfComponents;
+    this->GetComponents<UCesiumGltfComponent>(gltfComponents);
+    for (UCesiumGltfComponent* pGltf : gltfComponents) {
+      pGltf->RebuildRasterOverlayComposites();
+      this->scheduleRasterTileUpdates(*pGltf);
+    }
+  }
+
+  if (this->_pRasterOverlayAtlas) {
+    TArray<UCesiumGltfComponent*> reattached;
+    this->_pRasterOverlayAtlas->defragment(reattached);
+    for (UCesiumGltfComponent* pGltf : reattached) {
+      this->scheduleRasterTileUpdates(*pGltf);
+    }
+  }
+
+  this->_deferRasterTileUpdates = false;
+  this->applyScheduledRasterTileUpdates();
+
   updateLastViewUpdateResultState(*pResult);
 
   removeCollisionForTiles(pResult->tilesFadingOut);
@@ -2098,6 +2586,14 @@ void ACesium3DTileset::Tick(float DeltaTime) {
 
   showTilesToRender(pResult->tilesToRenderThisFrame);
 
+  if (this->StreamTextureMips) {
+    updateTextureStreaming(frustums, pResult->tilesToRenderThisFrame);
+  }
+
+  if (this->EvictHiddenTileGpuResources) {
+    evictHiddenTileGpuResources();
+  }
+
   if (this->UseLodTransitions) {
     TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::UpdateTileFades)
     updateTileFades(pResult->tilesToRenderThisFrame, true);
@@ -2174,6 +2670,8 @@ void ACesium3DTileset::PostEditChangeProperty(
       PropName == GET_MEMBER_NAME_CHECKED(ACesium3DTileset, IonAccessToken) ||
       PropName ==
           GET_MEMBER_NAME_CHECKED(ACesium3DTileset, CreatePhysicsMeshes) ||
+      PropName ==
+          GET_MEMBER_NAME_CHECKED(ACesium3DTileset, CreatePickingBvhs) ||
       PropName ==
           GET_MEMBER_NAME_CHECKED(ACesium3DTileset, CreateNavCollision) ||
       PropName ==
@@ -2183,6 +2681,26 @@ void ACesium3DTileset::PostEditChangeProperty(
       PropName == GET_MEMBER_NAME_CHECKED(ACesium3DTileset, EnableWaterMask) ||
       PropName ==
           GET_MEMBER_NAME_CHECKED(ACesium3DTileset, IgnoreKhrMaterialsUnlit) ||
+      PropName == GET_MEMBER_NAME_CHECKED(ACesium3DTileset, EnableNanite) ||
+      PropName ==
+          GET_MEMBER_NAME_CHECKED(ACesium3DTileset, TextureCompression) ||
+      PropName ==
+          GET_MEMBER_NAME_CHECKED(ACesium3DTileset, StreamTextureMips) ||
+      PropName == GET_MEMBER_NAME_CHECKED(
+                      ACesium3DTileset,
+                      EvictHiddenTileGpuResources) ||
+      PropName == GET_MEMBER_NAME_CHECKED(
+                      ACesium3DTileset,
+                      ReleaseGltfBuffersAfterLoad) ||
+      PropName == GET_MEMBER_NAME_CHECKED(
+                      ACesium3DTileset,
+                      ShareMaterialInstances) ||
+      PropName == GET_MEMBER_NAME_CHECKED(
+                      ACesium3DTileset,
+                      EnableRasterOverlayAtlas) ||
+      PropName == GET_MEMBER_NAME_CHECKED(
+                      ACesium3DTileset,
+                      CompositeRasterOverlays) ||
       PropName == GET_MEMBER_NAME_CHECKED(ACesium3DTileset, Material) ||
       PropName ==
           GET_MEMBER_NAME_CHECKED(ACesium3DTileset, TranslucentMaterial) ||
@@ -2251,7 +2769,13 @@ void ACesium3DTileset::PostEditChangeChainProperty(
       PropertyChangedChainEvent.PropertyChain.GetHead()->GetValue()->GetFName();
   if (PropName ==
       GET_MEMBER_NAME_CHECKED(ACesium3DTileset, PointCloudShading)) {
-    FCesiumGltfPointsSceneProxyUpdater::UpdateSettingsInProxies(this);
+    // Points are only sorted for decimation as tiles load.
+    if (PropertyChangedChainEvent.Property->GetFName() ==
+        GET_MEMBER_NAME_CHECKED(FCesiumPointCloudShading, Decimation)) {
+      this->DestroyTileset();
+    } else {
+      FCesiumGltfPointsSceneProxyUpdater::UpdateSettingsInProxies(this);
+    }
   }
 }
 
@@ -0,0 +1,169 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumAtlasAllocator.h"
+#include "Misc/AssertionMacros.h"
+
+namespace {
+int32 roundUp(int32 value, int32 granularity) {
+  return (value + granularity - 1) / granularity * granularity;
+}
+} // namespace
+
+CesiumAtlasAllocator::CesiumAtlasAllocator(int32 pageSize, int32 granularity)
+    : _pageSize(pageSize),
+      _granularity(granularity),
+      _allocationCount(0),
+      _allocatedArea(0),
+      _shelves() {
+  this->_shelves.push_back(Shelf{0, pageSize, {Span{0, pageSize}}, 0});
+}
+
+std::optional<CesiumAtlasAllocator::Block>
+CesiumAtlasAllocator::allocate(int32 width, int32 height) {
+  if (width <= 0 || height <= 0) {
+    return std::nullopt;
+  }
+
+  const int32 blockWidth = roundUp(width, this->_granularity);
+  const int32 blockHeight = roundUp(height, this->_granularity);
+  if (blockWidth > this->_pageSize || blockHeight > this->_pageSize) {
+    return std::nullopt;
+  }
+
+  auto hasRoom = [blockWidth](const Shelf& shelf) {
+    for (const Span& span : shelf.freeSpans) {
+      if (span.width >= blockWidth) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  // Find the shortest shelf that is in use and has room for the block, among
+  // those that are at most half again as tall as it, or any at all if
+  // allowWaste is true.
+  auto findShelf = [this, blockHeight, &hasRoom](bool allowWaste) {
+    int32 best = -1;
+    for (int32 i = 0; i < int32(this->_shelves.size()); ++i) {
+      const Shelf& shelf = this->_shelves[size_t(i)];
+      if (shelf.allocationCount == 0 || shelf.height < blockHeight ||
+          (!allowWaste && shelf.height > blockHeight + blockHeight / 2) ||
+          (best >= 0 && shelf.height >= this->_shelves[size_t(best)].height) ||
+          !hasRoom(shelf)) {
+        continue;
+      }
+      best = i;
+    }
+    return best;
+  };
+
+  int32 shelfIndex = findShelf(false);
+
+  // Otherwise, start a new shelf in the topmost empty space that is tall
+  // enough, leaving the rest of that space empty.
+  if (shelfIndex < 0) {
+    for (int32 i = 0; i < int32(this->_shelves.size()); ++i) {
+      Shelf& shelf = this->_shelves[size_t(i)];
+      if (shelf.allocationCount > 0 || shelf.height < blockHeight) {
+        continue;
+      }
+      if (shelf.height > blockHeight) {
+        const Shelf rest{
+            shelf.y + blockHeight,
+            shelf.height - blockHeight,
+            {Span{0, this->_pageSize}},
+            0};
+        shelf.height = blockHeight;
+        this->_shelves.insert(this->_shelves.begin() + i + 1, rest);
+      }
+      shelfIndex = i;
+      break;
+    }
+  }
+
+  if (shelfIndex < 0) {
+    shelfIndex = findShelf(true);
+  }
+  if (shelfIndex < 0) {
+    return std::nullopt;
+  }
+
+  Shelf& shelf = this->_shelves[size_t(shelfIndex)];
+  std::optional<int32> x = allocateInShelf(shelf, blockWidth);
+  check(x);
+
+  ++this->_allocationCount;
+  this->_allocatedArea += int64(blockWidth) * blockHeight;
+  return Block{*x, shelf.y, blockWidth, blockHeight};
+}
+
+void CesiumAtlasAllocator::free(const Block& block) {
+  int32 shelfIndex = 0;
+  while (this->_shelves[size_t(shelfIndex)].y != block.y) {
+    ++shelfIndex;
+  }
+
+  --this->_allocationCount;
+  this->_allocatedArea -= int64(block.width) * block.height;
+
+  // Return the block's span to the shelf, merging it with the free spans on
+  // either side.
+  Shelf& shelf = this->_shelves[size_t(shelfIndex)];
+  std::vector<Span>& spans = shelf.freeSpans;
+  auto next = spans.begin();
+  while (next != spans.end() && next->x < block.x) {
+    ++next;
+  }
+  next = spans.insert(next, Span{block.x, block.width});
+  if (next + 1 != spans.end() && next->x + next->width == (next + 1)->x) {
+    next->width += (next + 1)->width;
+    spans.erase(next + 1);
+  }
+  if (next != spans.begin() && (next - 1)->x + (next - 1)->width == next->x) {
+    (next - 1)->width += next->width;
+    spans.erase(next);
+  }
+
+  if (--shelf.allocationCount > 0) {
+    return;
+  }
+
+  // Merge the now-empty shelf with the empty shelves above and below it, so
+  // that the space can be taken by taller blocks.
+  check(spans.size() == 1 && spans[0].width == this->_pageSize);
+  const size_t below = size_t(shelfIndex) + 1;
+  if (below < this->_shelves.size() &&
+      this->_shelves[below].allocationCount == 0) {
+    shelf.height += this->_shelves[below].height;
+    this->_shelves.erase(this->_shelves.begin() + below);
+  }
+  if (shelfIndex > 0 &&
+      this->_shelves[size_t(shelfIndex) - 1].allocationCount == 0) {
+    this->_shelves[size_t(shelfIndex) - 1].height +=
+        this->_shelves[size_t(shelfIndex)].height;
+    this->_shelves.erase(this->_shelves.begin() + shelfIndex);
+  }
+}
+
+double CesiumAtlasAllocator::getOccupancy() const {
+  return double(this->_allocatedArea) /
+         (double(this->_pageSize) * double(this->_pageSize));
+}
+
+/*static*/ std::optional<int32>
+CesiumAtlasAllocator::allocateInShelf(Shelf& shelf, int32 width) {
+  for (auto it = shelf.freeSpans.begin(); it != shelf.freeSpans.end(); ++it) {
+    if (it->width < width) {
+      continue;
+    }
+    const int32 x = it->x;
+    it->x += width;
+    it->width -= width;
+    if (it->width == 0) {
+      shelf.freeSpans.erase(it);
+    }
+    ++shelf.allocationCount;
+    return x;
+  }
+  return std::nullopt;
+}
@@ -0,0 +1,99 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "HAL/Platform.h"
+#include <optional>
+#include <vector>
+
+/**
+ * @brief Allocates rectangular blocks of a square texture atlas page, using a
+ * shelf packer.
+ *
+ * The page is divided into horizontal shelves, each as tall as the blocks it
+ * holds, and blocks are placed side by side along them. Block positions and
+ * sizes are rounded up to a granularity, so that the mips of the page down to
+ * a given level hold whole mips of every block without sharing texels or
+ * compressed blocks between them. Unlike power-of-two blocks, a block is never
+ * more than one granule wider or taller than its image.
+ *
+ * When the last block of a shelf is freed, the shelf is merged with any empty
+ * shelves above and below it, so that a page whose blocks are all freed can
+ * hold blocks of any height again.
+ */
+class CesiumAtlasAllocator {
+public:
+  /**
+   * @brief A block of the page, in texels.
+   */
+  struct Block {
+    int32 x;
+    int32 y;
+    int32 width;
+    int32 height;
+  };
+
+  /**
+   * @brief Constructs an allocator for an empty page.
+   *
+   * @param pageSize The width and height of the page. This must be a multiple
+   * of the granularity.
+   * @param granularity The multiple to which the positions and sizes of blocks
+   * are rounded up.
+   */
+  CesiumAtlasAllocator(int32 pageSize, int32 granularity);
+
+  /**
+   * @brief Allocates a block for an image of the given size. Existing shelves
+   * whose height wastes less than half of the block are preferred, the
+   * shortest first. Otherwise, a new shelf is taken from the topmost empty
+   * space that is tall enough.
+   *
+   * @return The block, or std::nullopt if the page has no room for it.
+   */
+  std::optional<Block> allocate(int32 width, int32 height);
+
+  /**
+   * @brief Frees a block returned by {@link allocate}.
+   */
+  void free(const Block& block);
+
+  int32 getPageSize() const { return this->_pageSize; }
+
+  /**
+   * @brief Gets the number of blocks that are currently allocated.
+   */
+  int32 getAllocationCount() const { return this->_allocationCount; }
+
+  /**
+   * @brief Gets the fraction of the page's area covered by allocated blocks,
+   * from 0.0 to 1.0.
+   */
+  double getOccupancy() const;
+
+private:
+  struct Span {
+    int32 x;
+    int32 width;
+  };
+
+  struct Shelf {
+    int32 y;
+    int32 height;
+
+    // The free parts of the shelf, ordered by x, with no two adjacent.
+    std::vector<Span> freeSpans;
+    int32 allocationCount;
+  };
+
+  static std::optional<int32> allocateInShelf(Shelf& shelf, int32 width);
+
+  int32 _pageSize;
+  int32 _granularity;
+  int32 _allocationCount;
+  int64 _allocatedArea;
+
+  // The shelves, ordered by y, covering the whole page. Shelves without
+  // blocks have a single free span as wide as the page.
+  std::vector<Shelf> _shelves;
+};
@@ -227,12 +227,8 @@ int64 UCesiumFeatureIdSetBlueprintLibrary::GetFeatureIDFromHit(
   if (!primData.pMeshPrimitive) {
     return -1;
   }
-  auto VertexIndices = std::visit(
-      CesiumGltf::IndicesForFaceFromAccessor{
-          Hit.FaceIndex,
-          primData.PositionAccessor.size(),
-          primData.pMeshPrimitive->mode},
-      primData.IndexAccessor);
+  std::array<int64, 3> VertexIndices =
+      primData.getFaceVertexIndices(Hit.FaceIndex);
 
   int64 VertexIndex = VertexIndices[0];
 
@@ -11,10 +11,17 @@
 #include "CesiumGltfPointsComponent.h"
 #include "CesiumGltfPrimitiveComponent.h"
 #include "CesiumGltfTextures.h"
+#include "CesiumMaterialInstanceCache.h"
 #include "CesiumMaterialUserData.h"
+#include "CesiumNaniteBuilder.h"
+#include "CesiumPointCloudUtility.h"
+#include "CesiumRasterOverlay.h"
+#include "CesiumRasterOverlayCompositor.h"
 #include "CesiumRasterOverlays.h"
 #include "CesiumRuntime.h"
+#include "CesiumStats.h"
 #include "CesiumTextureUtility.h"
+#include "CesiumTileObjectPool.h"
 #include "CesiumTransforms.h"
 #include "Chaos/AABBTree.h"
 #include "Chaos/CollisionConvexMesh.h"
@@ -24,6 +31,7 @@
 #include "EncodedFeaturesMetadata.h"
 #include "Engine/CollisionProfile.h"
 #include "Engine/StaticMesh.h"
+#include "Engine/TextureRenderTarget2D.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 #include "LoadGltfResult.h"
@@ -37,6 +45,7 @@
 #include "StaticMeshOperations.h"
 #include "StaticMeshResources.h"
 #include "UObject/ConstructorHelpers.h"
+#include "UnrealPrepareRendererResources.h"
 #include "VecMath.h"
 #include "mikktspace.h"
 
@@ -73,6 +82,11 @@
 #include "ScopedTransaction.h"
 #endif
 
+DECLARE_MEMORY_STAT(
+    TEXT("Evicted Tile Mesh Memory"),
+    STAT_CesiumEvictedTileGpuMemory,
+    STATGROUP_Cesium);
+
 using namespace CesiumTextureUtility;
 using namespace CreateGltfOptions;
 using namespace LoadGltfResult;
@@ -1270,6 +1284,32 @@ std::string getPrimitiveName(
   return name;
 }
 
+int64 computeVertexBufferBytes(const FStaticMeshVertexBuffers& vertexBuffers) {
+  const FPositionVertexBuffer& positions = vertexBuffers.PositionVertexBuffer;
+  const FColorVertexBuffer& colors = vertexBuffers.ColorVertexBuffer;
+  return int64(positions.GetNumVertices()) * positions.GetStride() +
+         int64(vertexBuffers.StaticMeshVertexBuffer.GetTangentSize()) +
+         int64(vertexBuffers.StaticMeshVertexBuffer.GetTexCoordSize()) +
+         int64(colors.GetNumVertices()) * colors.GetStride();
+}
+
+/**
+ * @brief Estimates the memory used by a Chaos triangle mesh from its vertices
+ * and triangles. The acceleration structure is not included.
+ */
+int64 estimateCollisionMeshBytes(
+    const Chaos::FTriangleMeshImplicitObjectPtr& pCollisionMesh) {
+  if (!pCollisionMesh) {
+    return 0;
+  }
+
+  const int64 indexSize =
+      pCollisionMesh->Elements().RequiresLargeIndices() ? sizeof(int32)
+                                                        : sizeof(uint16);
+  return int64(pCollisionMesh->Particles().Size()) * sizeof(Chaos::FVec3f) +
+         int64(pCollisionMesh->Elements().GetNumTriangles()) * 3 * indexSize;
+}
+
 template <class TIndexAccessor>
 TArray<uint32>
 getIndices(const TIndexAccessor& indicesView, int32 primitiveMode) {
@@ -1342,6 +1382,42 @@ getIndices(const TIndexAccessor& indicesView, int32 primitiveMode) {
 
   return indices;
 }
+
+/**
+ * Gets the static mesh of a tile's child component whose GPU buffers can be
+ * released while the tile is hidden, or nullptr if the buffers must be kept.
+ */
+UStaticMesh* getEvictableStaticMesh(const USceneComponent* pChild) {
+  const UStaticMeshComponent* pMesh = Cast<UStaticMeshComponent>(pChild);
+  if (!pMesh || !Cast<ICesiumPrimitive>(pMesh) || pMesh->SceneProxy ||
+      pMesh->IsCollisionEnabled()) {
+    // A component with a scene proxy may still be drawn from the buffers,
+    // and one with collision may still be hit.
+    return nullptr;
+  }
+
+  UStaticMesh* pStaticMesh = pMesh->GetStaticMesh();
+  if (!pStaticMesh || pStaticMesh->HasValidNaniteData()) {
+    return nullptr;
+  }
+
+  const FStaticMeshRenderData* pRenderData = pStaticMesh->GetRenderData();
+  if (!pRenderData || !pRenderData->IsInitialized()) {
+    return nullptr;
+  }
+
+  return pStaticMesh;
+}
+
+int64 computeGpuBufferBytes(const UStaticMesh& staticMesh) {
+  int64 bytes = 0;
+  for (const FStaticMeshLODResources& LODResources :
+       staticMesh.GetRenderData()->LODResources) {
+    bytes += computeVertexBufferBytes(LODResources.VertexBuffers) +
+             int64(LODResources.IndexBuffer.GetIndexDataSize());
+  }
+  return bytes;
+}
 } // namespace
 
 template <class TIndexAccessor>
@@ -1546,12 +1622,29 @@ static void loadPrimitive(
     break;
   }
 
+  // Points in progressive order are decimated by drawing a prefix of them, so
+  // the vertices themselves must be in that order.
+  if (primitive.mode == CesiumGltf::MeshPrimitive::Mode::POINTS &&
+      options.pMeshOptions->pNodeOptions->pModelOptions
+          ->sortPointsProgressively) {
+    CesiumPointCloudUtility::sortPointsProgressively(
+        indices,
+        [&positionView](uint32 index) { return positionView[index]; });
+    duplicateVertices = true;
+    primitiveResult.pointsInProgressiveOrder = true;
+  }
+
   uint32 numVertices =
       duplicateVertices ? uint32(indices.Num()) : uint32(positionView.size());
 
+  // Buffers that may be evicted from the GPU need a CPU copy to be uploaded
+  // from again.
+  const bool keepCpuCopy =
+      options.pMeshOptions->pNodeOptions->pModelOptions->keepMeshDataOnCpu;
+
   FPositionVertexBuffer& positionBuffer =
       LODResources.VertexBuffers.PositionVertexBuffer;
-  positionBuffer.Init(numVertices, false);
+  positionBuffer.Init(numVertices, keepCpuCopy);
 
   {
     // Note: scaling from glTF vertices to Unreal's must match
@@ -1588,7 +1681,9 @@ static void loadPrimitive(
       CesiumGltf::VertexAttributeSemantics::COLOR_n[0]);
   if (colorAccessorIt != primitive.attributes.end()) {
     TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CopyVertexColors)
-    LODResources.VertexBuffers.ColorVertexBuffer.Init(numVertices, false);
+    LODResources.VertexBuffers.ColorVertexBuffer.Init(
+        numVertices,
+        keepCpuCopy);
     LODResources.bHasColorVertexData = createAccessorView(
         model,
         colorAccessorIt->second,
@@ -1649,7 +1744,7 @@ static void loadPrimitive(
   // metadata because integer feature IDs can and will lose meaningful
   // precision when using 16-bit floats.
   vertexBuffer.SetUseFullPrecisionUVs(true);
-  vertexBuffer.Init(numVertices, numberOfTextureCoordinates, false);
+  vertexBuffer.Init(numVertices, numberOfTextureCoordinates, keepCpuCopy);
 
   {
     TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::loadTextures)
@@ -1779,6 +1874,7 @@ static void loadPrimitive(
         numVertices >= std::numeric_limits<uint16>::max()
             ? EIndexBufferStride::Type::Force32Bit
             : EIndexBufferStride::Type::Force16Bit);
+    LODResources.IndexBuffer.TrySetAllowCPUAccess(keepCpuCopy);
   }
 
   LODResources.bHasDepthOnlyIndices = false;
@@ -1793,6 +1889,35 @@ static void loadPrimitive(
   }
 #endif
 
+  // Nanite does not support translucency, and water is rendered with its own
+  // (potentially translucent) material, so those primitives are left on the
+  // regular static mesh path. The LOD0 resources built above remain in place
+  // as the Nanite fallback mesh, and are used as-is if the build fails.
+  if (isTriangles && modelOptions.buildNanite &&
+      material.alphaMode != CesiumGltf::Material::AlphaMode::BLEND &&
+      !primitiveResult.onlyWater && !primitiveResult.waterMaskTexture) {
+    CesiumNaniteBuilder::NaniteBuildInput naniteInput;
+    if (!CesiumNaniteBuilder::createBuildInput(LODResources, naniteInput) ||
+        !CesiumNaniteBuilder::buildNaniteResources(
+            std::move(naniteInput),
+            *RenderData)) {
+      UE_LOG(
+          LogCesium,
+          Verbose,
+          TEXT("%s: Could not build Nanite resources; using LOD0 instead."),
+          UTF8_TO_TCHAR(name.c_str()));
+    }
+  }
+
+  primitiveResult.vertexBufferBytes =
+      computeVertexBufferBytes(LODResources.VertexBuffers);
+  primitiveResult.indexBufferBytes =
+      int64(LODResources.IndexBuffer.GetIndexDataSize());
+  if (keepCpuCopy) {
+    primitiveResult.meshCpuCopyBytes =
+        primitiveResult.vertexBufferBytes + primitiveResult.indexBufferBytes;
+  }
+
   primitiveResult.meshIndex = options.pMeshOptions->meshIndex;
   primitiveResult.primitiveIndex = options.primitiveIndex;
   primitiveResult.RenderData = std::move(RenderData);
@@ -1812,6 +1937,25 @@ static void loadPrimitive(
               : BuildChaosTriangleMeshes<int32>(
                     LODResources.VertexBuffers.PositionVertexBuffer,
                     indices);
+      primitiveResult.collisionMeshBytes =
+          estimateCollisionMeshBytes(primitiveResult.pCollisionMesh);
+    }
+  }
+
+  if (isTriangles &&
+      options.pMeshOptions->pNodeOptions->pModelOptions->createPickingBvhs) {
+    if (numVertices != 0 && indices.Num() != 0) {
+      TArray<FVector3f> bvhPositions;
+      bvhPositions.SetNumUninitialized(numVertices);
+      for (uint32 i = 0; i < numVertices; ++i) {
+        bvhPositions[i] =
+            LODResources.VertexBuffers.PositionVertexBuffer.VertexPosition(i);
+      }
+      primitiveResult.pPickingBvh = MakeShared<const CesiumTriangleBvh>(
+          MoveTemp(bvhPositions),
+          TArray<uint32>(indices));
+      primitiveResult.collisionMeshBytes +=
+          primitiveResult.pPickingBvh->getMemorySize();
     }
   }
 }
@@ -2364,7 +2508,11 @@ loadModelAnyThreadPart(
     const CesiumGeospatial::Ellipsoid& ellipsoid) {
   TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::loadModelAnyThreadPart)
 
-  return CesiumGltfTextures::createInWorkerThread(asyncSystem, *options.pModel)
+  return CesiumGltfTextures::createInWorkerThread(
+             asyncSystem,
+             *options.pModel,
+             options.textureCompression,
+             options.streamTextureMips)
       .thenInWorkerThread(
           [transform, ellipsoid, options = std::move(options)]() mutable
           -> UCesiumGltfComponent::CreateOffGameThreadResult {
@@ -3015,6 +3163,271 @@ void addInstanceFeatureIds(
 }
 } // namespace
 
+namespace {
+// Counts the memory used by the textures of a tile. Textures may be shared by
+// multiple primitives in the model, so each one is only counted once.
+// Textures that wrap a resource from the CesiumTextureCache may also be shared
+// with other tiles, so their bytes are recorded in the tile's SharedTextures
+// for the tileset to count once, rather than in its own statistics.
+struct TextureMemoryCounter {
+  UCesiumGltfComponent& gltf;
+  TSet<const UTexture*> countedTextures;
+
+  void addTexture(
+      const CesiumTextureUtility::LoadedTextureResult* pLoadedTexture) {
+    int64 bytes = 0;
+    if (FCesium3DTilesetMemoryStatistics* pStatistics =
+            this->count(pLoadedTexture, bytes)) {
+      pStatistics->TextureBytes += bytes;
+    }
+  }
+
+  void addEncodedMetadataTexture(
+      const CesiumTextureUtility::LoadedTextureResult* pLoadedTexture) {
+    int64 bytes = 0;
+    if (FCesium3DTilesetMemoryStatistics* pStatistics =
+            this->count(pLoadedTexture, bytes)) {
+      pStatistics->EncodedMetadataTextureBytes += bytes;
+    }
+  }
+
+private:
+  // Returns the statistics that the texture's bytes should be added to, and
+  // sets `bytes`, or returns nullptr if the texture was already counted.
+  FCesium3DTilesetMemoryStatistics* count(
+      const CesiumTextureUtility::LoadedTextureResult* pLoadedTexture,
+      int64& bytes) {
+    if (!pLoadedTexture || !pLoadedTexture->pTexture) {
+      return nullptr;
+    }
+
+    const UTexture2D* pTexture = pLoadedTexture->pTexture->getUnrealTexture();
+    if (!pTexture || this->countedTextures.Contains(pTexture)) {
+      return nullptr;
+    }
+    this->countedTextures.Add(pTexture);
+
+    // All textures created for glTF primitives use an FCesiumTextureResource.
+    const FCesiumTextureResource* pResource =
+        static_cast<const FCesiumTextureResource*>(pTexture->GetResource());
+    if (!pResource) {
+      return nullptr;
+    }
+
+    TSharedPtr<FCesiumTextureResource> pWrapped =
+        pResource->GetWrappedResource();
+    if (!pWrapped) {
+      bytes = int64(pResource->GetMemorySize());
+      return &this->gltf.MemoryStatistics;
+    }
+    if (this->gltf.SharedTextures.Contains(pWrapped)) {
+      return nullptr;
+    }
+    bytes = int64(pWrapped->GetMemorySize());
+    return &this->gltf.SharedTextures.Add(
+        pWrapped,
+        FCesium3DTilesetMemoryStatistics());
+  }
+};
+
+void addStreamedTexture(
+    const CesiumTextureUtility::LoadedTextureResult* pLoadedTexture,
+    TArray<TSharedPtr<FCesiumStreamedTextureResource>>& streamedTextures) {
+  if (!pLoadedTexture || !pLoadedTexture->pTexture) {
+    return;
+  }
+
+  const UTexture2D* pTexture = pLoadedTexture->pTexture->getUnrealTexture();
+  const FCesiumTextureResource* pResource =
+      pTexture ? static_cast<const FCesiumTextureResource*>(
+                     pTexture->GetResource())
+               : nullptr;
+  TSharedPtr<FCesiumStreamedTextureResource> pStreamed =
+      pResource ? pResource->GetStreamedResource() : nullptr;
+  if (pStreamed) {
+    streamedTextures.AddUnique(pStreamed);
+  }
+}
+
+void addStreamedTextures(
+    const LoadedPrimitiveResult& loadResult,
+    TArray<TSharedPtr<FCesiumStreamedTextureResource>>& streamedTextures) {
+  addStreamedTexture(loadResult.baseColorTexture.Get(), streamedTextures);
+  addStreamedTexture(
+      loadResult.metallicRoughnessTexture.Get(),
+      streamedTextures);
+  addStreamedTexture(loadResult.normalTexture.Get(), streamedTextures);
+  addStreamedTexture(loadResult.emissiveTexture.Get(), streamedTextures);
+  addStreamedTexture(loadResult.occlusionTexture.Get(), streamedTextures);
+  addStreamedTexture(loadResult.waterMaskTexture.Get(), streamedTextures);
+}
+
+void accumulatePrimitiveMemoryStatistics(
+    const LoadedPrimitiveResult& loadResult,
+    const CesiumPrimitiveData& primData,
+    TextureMemoryCounter& textureCounter,
+    FCesium3DTilesetMemoryStatistics& statistics) {
+  statistics.VertexBufferBytes += loadResult.vertexBufferBytes;
+  statistics.IndexBufferBytes += loadResult.indexBufferBytes;
+  statistics.MeshCpuCopyBytes += loadResult.meshCpuCopyBytes;
+  statistics.CollisionMeshBytes += loadResult.collisionMeshBytes;
+
+  textureCounter.addTexture(loadResult.baseColorTexture.Get());
+  textureCounter.addTexture(loadResult.metallicRoughnessTexture.Get());
+  textureCounter.addTexture(loadResult.normalTexture.Get());
+  textureCounter.addTexture(loadResult.emissiveTexture.Get());
+  textureCounter.addTexture(loadResult.occlusionTexture.Get());
+  textureCounter.addTexture(loadResult.waterMaskTexture.Get());
+
+  for (const EncodedFeaturesMetadata::EncodedFeatureIdSet& featureIdSet :
+       primData.EncodedFeatures.featureIdSets) {
+    if (featureIdSet.texture) {
+      textureCounter.addEncodedMetadataTexture(
+          featureIdSet.texture->pTexture.Get());
+    }
+  }
+}
+
+void accumulateModelMemoryStatistics(
+    const CesiumGltf::Model& model,
+    const EncodedFeaturesMetadata::EncodedModelMetadata& encodedMetadata,
+    TextureMemoryCounter& textureCounter,
+    FCesium3DTilesetMemoryStatistics& statistics) {
+  for (const EncodedFeaturesMetadata::EncodedPropertyTable& propertyTable :
+       encodedMetadata.propertyTables) {
+    for (const EncodedFeaturesMetadata::EncodedPropertyTableProperty&
+             property : propertyTable.properties) {
+      textureCounter.addEncodedMetadataTexture(property.pTexture.Get());
+    }
+  }
+
+  for (const EncodedFeaturesMetadata::EncodedPropertyTexture& propertyTexture :
+       encodedMetadata.propertyTextures) {
+    for (const EncodedFeaturesMetadata::EncodedPropertyTextureProperty&
+             property : propertyTexture.properties) {
+      textureCounter.addEncodedMetadataTexture(property.pTexture.Get());
+    }
+  }
+
+  // Image pixel data has usually been handed off to the renderer by now, but
+  // buffers may be retained for picking and metadata access.
+  for (const CesiumGltf::Buffer& buffer : model.buffers) {
+    statistics.GltfCpuBytes += int64(buffer.cesium.data.size());
+  }
+  for (const CesiumGltf::Image& image : model.images) {
+    if (image.pAsset) {
+      statistics.GltfCpuBytes += int64(image.pAsset->pixelData.size());
+    }
+  }
+}
+
+bool isRenderOnlyAttribute(
+    const CesiumGltf::MeshPrimitive& primitive,
+    const std::string& semantic) {
+  if (semantic == CesiumGltf::VertexAttributeSemantics::POSITION ||
+      semantic == CesiumGltf::VertexAttributeSemantics::NORMAL ||
+      semantic == CesiumGltf::VertexAttributeSemantics::TANGENT ||
+      semantic.rfind("COLOR_", 0) == 0) {
+    return true;
+  }
+
+  if (semantic.rfind("TEXCOORD_", 0) != 0) {
+    return false;
+  }
+
+  // Feature ID textures keep a view of their texture coordinates so that
+  // feature IDs can be retrieved by vertex.
+  const CesiumGltf::ExtensionExtMeshFeatures* pFeatures =
+      primitive.getExtension<CesiumGltf::ExtensionExtMeshFeatures>();
+  if (pFeatures) {
+    for (const CesiumGltf::FeatureId& featureId : pFeatures->featureIds) {
+      if (featureId.texture &&
+          semantic ==
+              "TEXCOORD_" + std::to_string(featureId.texture->texCoord)) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+/**
+ * @brief Releases the data of glTF buffers that are only used by mesh vertex
+ * attributes, indices, and images. Unreal already has its own copies of that
+ * data. Buffers that are also used for anything else, such as property tables,
+ * feature ID attributes, or instancing, are retained.
+ */
+void releaseRenderOnlyGltfBuffers(CesiumGltf::Model& model) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::ReleaseGltfBuffers)
+
+  std::vector<bool> isRenderOnlyAccessor(model.accessors.size(), false);
+  for (const CesiumGltf::Mesh& mesh : model.meshes) {
+    for (const CesiumGltf::MeshPrimitive& primitive : mesh.primitives) {
+      if (primitive.indices >= 0 &&
+          size_t(primitive.indices) < isRenderOnlyAccessor.size()) {
+        isRenderOnlyAccessor[primitive.indices] = true;
+      }
+      for (const auto& [semantic, accessorIndex] : primitive.attributes) {
+        if (accessorIndex >= 0 &&
+            size_t(accessorIndex) < isRenderOnlyAccessor.size() &&
+            isRenderOnlyAttribute(primitive, semantic)) {
+          isRenderOnlyAccessor[accessorIndex] = true;
+        }
+      }
+    }
+  }
+
+  // A buffer view can only be released if something renderable uses it and
+  // nothing else does. Buffer views that aren't used by any accessor or image,
+  // such as those used by property tables, are retained.
+  std::vector<bool> isUsedForRendering(model.bufferViews.size(), false);
+  std::vector<bool> isUsedOtherwise(model.bufferViews.size(), false);
+  for (size_t i = 0; i < model.accessors.size(); ++i) {
+    const CesiumGltf::Accessor& accessor = model.accessors[i];
+    if (accessor.sparse) {
+      isRenderOnlyAccessor[i] = false;
+    }
+    if (accessor.bufferView >= 0 &&
+        size_t(accessor.bufferView) < model.bufferViews.size()) {
+      if (isRenderOnlyAccessor[i]) {
+        isUsedForRendering[accessor.bufferView] = true;
+      } else {
+        isUsedOtherwise[accessor.bufferView] = true;
+      }
+    }
+  }
+  for (const CesiumGltf::Image& image : model.images) {
+    // Images have already been decoded, so the encoded bytes aren't needed.
+    if (image.bufferView >= 0 &&
+        size_t(image.bufferView) < model.bufferViews.size()) {
+      isUsedForRendering[image.bufferView] = true;
+    }
+  }
+
+  std::vector<bool> canReleaseBuffer(model.buffers.size(), true);
+  for (size_t i = 0; i < model.bufferViews.size(); ++i) {
+    const CesiumGltf::BufferView& bufferView = model.bufferViews[i];
+    if (bufferView.buffer < 0 ||
+        size_t(bufferView.buffer) >= canReleaseBuffer.size()) {
+      continue;
+    }
+    if (!isUsedForRendering[i] || isUsedOtherwise[i]) {
+      canReleaseBuffer[bufferView.buffer] = false;
+    }
+  }
+
+  for (size_t i = 0; i < model.buffers.size(); ++i) {
+    if (canReleaseBuffer[i]) {
+      // Calling clear() isn't good enough because it won't actually release
+      // the memory.
+      std::vector<std::byte> data;
+      model.buffers[i].cesium.data.swap(data);
+    }
+  }
+}
+} // namespace
+
 static void loadPrimitiveGameThreadPart(
     CesiumGltf::Model& model,
     UCesiumGltfComponent* pGltf,
@@ -3024,7 +3437,8 @@ static void loadPrimitiveGameThreadPart(
     bool createNavCollision,
     ACesium3DTileset* pTilesetActor,
     const std::vector<FTransform>& instanceTransforms,
-    const TSharedPtr<FCesiumPrimitiveFeatures>& pInstanceFeatures) {
+    const TSharedPtr<FCesiumPrimitiveFeatures>& pInstanceFeatures,
+    TextureMemoryCounter& textureCounter) {
   TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::LoadPrimitive)
 
 #if DEBUG_GLTF_ASSET_NAMES
@@ -3049,6 +3463,7 @@ static void loadPrimitiveGameThreadPart(
         tile.getRefine() == Cesium3DTilesSelection::TileRefine::Add;
     pPointMesh->GeometricError = static_cast<float>(tile.getGeometricError());
     pPointMesh->Dimensions = loadResult.dimensions;
+    pPointMesh->PointsInProgressiveOrder = loadResult.pointsInProgressiveOrder;
     pMesh = pPointMesh;
     pCesiumPrimitive = pPointMesh;
   } else if (
@@ -3095,6 +3510,7 @@ static void loadPrimitiveGameThreadPart(
     primData.TexCoordAccessorMap = std::move(loadResult.TexCoordAccessorMap);
     primData.PositionAccessor = std::move(loadResult.PositionAccessor);
     primData.IndexAccessor = std::move(loadResult.IndexAccessor);
+    primData.pPickingBvh = std::move(loadResult.pPickingBvh);
     primData.HighPrecisionNodeTransform = loadResult.transform;
     pCesiumPrimitive->UpdateTransformFromCesium(cesiumToUnrealTransform);
     pMesh->bUseDefaultCollision = false;
@@ -3119,7 +3535,13 @@ static void loadPrimitiveGameThreadPart(
     pMesh->TranslucencySortPriority =
         primData.pTilesetActor->GetTranslucencySortPriority();
 
-    pStaticMesh = NewObject<UStaticMesh>(pMesh, componentName);
+    CesiumTileObjectPool* pObjectPool = pTilesetActor->getTileObjectPool();
+    pStaticMesh = pObjectPool
+                      ? pObjectPool->acquireStaticMesh(*pMesh, componentName)
+                      : nullptr;
+    if (!pStaticMesh) {
+      pStaticMesh = NewObject<UStaticMesh>(pMesh, componentName);
+    }
     // Unreal will crash trying to generate ray tracing information for a static
     // mesh without triangles (and it doesn't make sense anyways!)
     switch (meshPrimitive.mode) {
@@ -3179,6 +3601,15 @@ static void loadPrimitiveGameThreadPart(
   UMaterialInstanceDynamic* pMaterialForGltfPrimitive = nullptr;
   ICesium3DTilesetLifecycleEventReceiver* pLifecycleEventReceiver =
       pTilesetActor->GetLifecycleEventReceiver();
+
+  // A lifecycle event receiver may customize each primitive's material, and
+  // raster overlays and LOD transitions give every primitive its own parameter
+  // values, so there's no point in sharing in those cases.
+  TSharedPtr<CesiumMaterialInstanceCache> pMaterialCache;
+  if (!pLifecycleEventReceiver && !pTilesetActor->GetUseLodTransitions() &&
+      !pTilesetActor->FindComponentByClass<UCesiumRasterOverlay>()) {
+    pMaterialCache = pTilesetActor->getMaterialInstanceCache();
+  }
   {
     TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::SetupMaterial)
     ensure(pUserDesignatedMaterial);
@@ -3208,10 +3639,19 @@ static void loadPrimitiveGameThreadPart(
     } else {
       // Same as ICesium3DTilesetLifecycleEventReceiver::CreateMaterial's
       // default implementation
-      pMaterialForGltfPrimitive = UMaterialInstanceDynamic::Create(
-          pBaseMaterial,
-          nullptr,
-          ImportedSlotName);
+      if (pMaterialCache) {
+        pMaterialForGltfPrimitive = pMaterialCache->acquireSpare(pBaseMaterial);
+      }
+      CesiumTileObjectPool* pObjectPool = pTilesetActor->getTileObjectPool();
+      if (!pMaterialForGltfPrimitive && pObjectPool) {
+        pMaterialForGltfPrimitive = pObjectPool->acquireMaterial(pBaseMaterial);
+      }
+      if (!pMaterialForGltfPrimitive) {
+        pMaterialForGltfPrimitive = UMaterialInstanceDynamic::Create(
+            pBaseMaterial,
+            nullptr,
+            ImportedSlotName);
+      }
     }
 
     pMaterialForGltfPrimitive->SetFlags(
@@ -3407,6 +3847,15 @@ static void loadPrimitiveGameThreadPart(
 
   pMaterialForGltfPrimitive->TwoSided = true;
 
+  if (pMaterialCache) {
+    UMaterialInstanceDynamic* pSharedMaterial =
+        pMaterialCache->share(pMaterialForGltfPrimitive);
+    if (pSharedMaterial) {
+      pMaterialForGltfPrimitive = pSharedMaterial;
+      primData.pSharedMaterialCache = pMaterialCache;
+    }
+  }
+
   pStaticMesh->AddMaterial(pMaterialForGltfPrimitive);
 
   pStaticMesh->SetLightingGuid();
@@ -3457,6 +3906,13 @@ static void loadPrimitiveGameThreadPart(
     pMesh->RegisterComponent();
   }
 
+  accumulatePrimitiveMemoryStatistics(
+      loadResult,
+      primData,
+      textureCounter,
+      pGltf->MemoryStatistics);
+  addStreamedTextures(loadResult, pGltf->StreamedTextures);
+
   // Call the observer callback (if any) once all is done
   if (pLifecycleEventReceiver) {
     pLifecycleEventReceiver->OnTileMeshPrimitiveLoaded(*pCesiumPrimitive);
@@ -3528,6 +3984,8 @@ UCesiumGltfComponent::CreateOffGameThread(
     encodeMetadataGameThreadPart(*Gltf->EncodedMetadata_DEPRECATED);
   }
 
+  TextureMemoryCounter textureCounter{*Gltf};
+
   for (LoadedNodeResult& node : pReal->loadModelResult.nodeResults) {
     if (node.meshResult) {
       for (LoadedPrimitiveResult& primitive :
@@ -3541,22 +3999,135 @@ UCesiumGltfComponent::CreateOffGameThread(
             createNavCollision,
             pTilesetActor,
             node.InstanceTransforms,
-            node.pInstanceFeatures);
+            node.pInstanceFeatures,
+            textureCounter);
       }
     }
   }
 
+  pTilesetActor->registerStreamedTextures(Gltf->StreamedTextures);
+
   if (ICesium3DTilesetLifecycleEventReceiver* Receiver =
           pTilesetActor->GetLifecycleEventReceiver()) {
     Receiver->OnTileLoaded(*Gltf);
   }
 
+  // Raster overlays need the tile's vertex data in order to upsample it, so
+  // the buffers are retained for tilesets that have overlays. An overlay that
+  // is added later reloads the tileset.
+  if (pTilesetActor->GetReleaseGltfBuffersAfterLoad() &&
+      !pTilesetActor->FindComponentByClass<UCesiumRasterOverlay>()) {
+    pTilesetActor->notifyGltfBuffersReleased();
+    for (USceneComponent* pSceneComponent : Gltf->GetAttachChildren()) {
+      if (auto* pCesiumPrimitive = Cast<ICesiumPrimitive>(pSceneComponent)) {
+        pCesiumPrimitive->getPrimitiveData().releaseGltfVertexData();
+      }
+    }
+    releaseRenderOnlyGltfBuffers(model);
+  }
+
+  accumulateModelMemoryStatistics(
+      model,
+      Gltf->EncodedMetadata,
+      textureCounter,
+      Gltf->MemoryStatistics);
+
   Gltf->SetVisibility(false, true);
   Gltf->SetCollisionEnabled(ECollisionEnabled::NoCollision);
   return Gltf;
 }
 
+void UCesiumGltfComponent::RequestTextureMips(double ScreenSize, uint64 Frame) {
+  for (const TSharedPtr<FCesiumStreamedTextureResource>& pTexture :
+       this->StreamedTextures) {
+    pTexture->RequestScreenSize(ScreenSize, Frame);
+  }
+}
+
+void UCesiumGltfComponent::UpdateTextureStreaming(
+    uint64 Frame,
+    bool bMemoryPressure) {
+  for (const TSharedPtr<FCesiumStreamedTextureResource>& pTexture :
+       this->StreamedTextures) {
+    pTexture->UpdateStreaming(Frame, bMemoryPressure);
+  }
+}
+
+void UCesiumGltfComponent::EvictGpuResources(uint64 Frame) {
+  if (this->GpuResourcesEvicted) {
+    return;
+  }
+
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::EvictGpuResources)
+
+  // Only the buffers that are actually released are counted, since some
+  // meshes of the tile may have to keep theirs.
+  this->EvictedGpuBytes = 0;
+  for (USceneComponent* pChild : this->GetAttachChildren()) {
+    UStaticMesh* pStaticMesh = getEvictableStaticMesh(pChild);
+    if (pStaticMesh) {
+      this->EvictedGpuBytes += computeGpuBufferBytes(*pStaticMesh);
+      pStaticMesh->ReleaseResources();
+    }
+  }
+
+  // Textures shared with tiles on screen keep the mips those tiles requested.
+  this->UpdateTextureStreaming(Frame, true);
+
+  this->GpuResourcesEvicted = true;
+  INC_MEMORY_STAT_BY(STAT_CesiumEvictedTileGpuMemory, this->EvictedGpuBytes);
+}
+
+int64 UCesiumGltfComponent::GetEvictableGpuBytes() const {
+  if (this->GpuResourcesEvicted) {
+    return 0;
+  }
+
+  int64 bytes = 0;
+  for (const USceneComponent* pChild : this->GetAttachChildren()) {
+    const UStaticMesh* pStaticMesh = getEvictableStaticMesh(pChild);
+    if (pStaticMesh) {
+      bytes += computeGpuBufferBytes(*pStaticMesh);
+    }
+  }
+  return bytes;
+}
+
+void UCesiumGltfComponent::RestoreGpuResources() {
+  if (!this->GpuResourcesEvicted) {
+    return;
+  }
+
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::RestoreGpuResources)
+
+  for (USceneComponent* pChild : this->GetAttachChildren()) {
+    UStaticMeshComponent* pMesh = Cast<UStaticMeshComponent>(pChild);
+    if (!pMesh || !Cast<ICesiumPrimitive>(pMesh)) {
+      continue;
+    }
+
+    // The buffers are uploaded from their CPU copies. The commands that
+    // release them were enqueued first, so they can be initialized again
+    // right away.
+    UStaticMesh* pStaticMesh = pMesh->GetStaticMesh();
+    FStaticMeshRenderData* pRenderData =
+        pStaticMesh ? pStaticMesh->GetRenderData() : nullptr;
+    if (pRenderData && !pRenderData->IsInitialized()) {
+      pStaticMesh->InitResources();
+    }
+  }
+
+  this->GpuResourcesEvicted = false;
+  DEC_MEMORY_STAT_BY(STAT_CesiumEvictedTileGpuMemory, this->EvictedGpuBytes);
+  this->EvictedGpuBytes = 0;
+}
+
 void UCesiumGltfComponent::OnVisibilityChanged() {
+  // However the tile is shown, its meshes need their buffers to be drawn.
+  if (this->GetVisibleFlag()) {
+    this->RestoreGpuResources();
+  }
+
   USceneComponent::OnVisibilityChanged();
   ICesium3DTilesetLifecycleEventReceiver* pLifecycleEventReceiver =
       GetTilesetActor().GetLifecycleEventReceiver();
@@ -3650,6 +4221,11 @@ void forEachPrimitiveComponent(UCesiumGltfComponent* pGltf, Func&& f) {
         continue;
       }
 
+      // The caller is going to change the material's parameters.
+      pMaterial = CesiumMaterialInstanceCache::makeMaterialUnique(
+          *pPrimitive,
+          pMaterial);
+
       UMaterialInterface* pBaseMaterial = pMaterial->Parent;
       UMaterialInstance* pBaseAsMaterialInstance =
           Cast<UMaterialInstance>(pBaseMaterial);
@@ -3666,6 +4242,47 @@ void forEachPrimitiveComponent(UCesiumGltfComponent* pGltf, Func&& f) {
 
 } // namespace
 
+TSharedRef<const CesiumRasterOverlayParameterNames>
+UCesiumGltfComponent::GetRasterOverlayParameterNames(
+    const std::string& overlayName) {
+  // Overlay names rarely change, so the names derived from them are created
+  // once per overlay rather than for every primitive of every tile.
+  CesiumRasterOverlayParameterNameCache& cache =
+      this->GetTilesetActor().getRasterOverlayParameterNameCache();
+  TSharedPtr<const CesiumRasterOverlayParameterNames> pNames =
+      cache.find(overlayName);
+  if (!pNames) {
+    TSharedRef<const CesiumRasterOverlayParameterNames> pNewNames =
+        MakeShared<CesiumRasterOverlayParameterNames>(
+            CesiumRasterOverlayParameterNames{
+                UTF8_TO_TCHAR(overlayName.c_str()),
+                createSafeName(overlayName, "_Texture"),
+                createSafeName(overlayName, "_TranslationScale"),
+                createSafeName(overlayName, "_TextureCoordinateIndex")});
+    cache.add(overlayName, pNewNames);
+    return pNewNames;
+  }
+  return pNames.ToSharedRef();
+}
+
+UCesiumGltfComponent::RasterTileUpdate&
+UCesiumGltfComponent::FindOrAddRasterTileUpdate(
+    const CesiumRasterOverlays::RasterOverlayTile& rasterTile) {
+  TSharedRef<const CesiumRasterOverlayParameterNames> pNames =
+      this->GetRasterOverlayParameterNames(rasterTile.getOverlay().getName());
+
+  // The names are compared rather than the pointers, because an overlay that
+  // is removed and added again gets new ones.
+  for (RasterTileUpdate& update : this->PendingRasterTileUpdates) {
+    if (update.pNames->texture == pNames->texture) {
+      return update;
+    }
+  }
+
+  return this->PendingRasterTileUpdates.Add_GetRef(
+      RasterTileUpdate{pNames, nullptr, std::nullopt, -1, false});
+}
+
 void UCesiumGltfComponent::AttachRasterTile(
     const Cesium3DTilesSelection::Tile& tile,
     const CesiumRasterOverlays::RasterOverlayTile& rasterTile,
@@ -3673,108 +4290,346 @@ void UCesiumGltfComponent::AttachRasterTile(
     const glm::dvec2& translation,
     const glm::dvec2& scale,
     int32 textureCoordinateID) {
-  FVector4 translationAndScale(translation.x, translation.y, scale.x, scale.y);
+  RasterTileUpdate& update = this->FindOrAddRasterTileUpdate(rasterTile);
+  update.pTexture = pTexture;
+  update.translationAndScale =
+      FVector4(translation.x, translation.y, scale.x, scale.y);
+  update.textureCoordinateID = textureCoordinateID;
+
+  const std::any& rendererOptions =
+      rasterTile.getOverlay().getOptions().rendererOptions;
+  auto ppOptions =
+      std::any_cast<FRasterOverlayRendererOptions*>(&rendererOptions);
+  const FRasterOverlayRendererOptions* pOptions =
+      ppOptions ? *ppOptions : nullptr;
+
+  // The composite is sRGB color, so overlays holding data aren't blended into
+  // it.
+  update.dynamic =
+      pOptions &&
+      (pOptions->dynamic || !pOptions->sRGB ||
+       pOptions->channels != ECesiumRasterOverlayChannels::RGBA);
+}
+
+void UCesiumGltfComponent::DetachRasterTile(
+    const Cesium3DTilesSelection::Tile& tile,
+    const CesiumRasterOverlays::RasterOverlayTile& rasterTile,
+    UTexture2D* pTexture) {
+  // Only the texture is cleared, so the parameters set by an earlier
+  // attachment in the same batch still apply.
+  RasterTileUpdate& update = this->FindOrAddRasterTileUpdate(rasterTile);
+  update.pTexture = this->Transparent1x1;
+}
+
+void UCesiumGltfComponent::ResolveCompositedRasterLayers(
+    const UCesiumMaterialUserData& CesiumData,
+    TArray<CesiumRasterOverlayCompositor::Composite>& Composites,
+    TArray<RasterTileUpdate>& LayerParameters) {
+  using namespace CesiumRasterOverlayCompositor;
+
+  const int32 layerCount = CesiumData.LayerNames.Num();
+
+  // Layers that don't belong to an overlay are left with a null texture, so
+  // that they aren't touched.
+  LayerParameters.Reset();
+  LayerParameters.SetNum(layerCount);
+
+  TArray<LayerInput> inputs;
+  inputs.Reserve(layerCount);
+  for (int32 layer = 0; layer < layerCount; ++layer) {
+    LayerInput& input = inputs.Add_GetRef(LayerInput{LayerKind::Live, -1});
+    for (const RasterTileUpdate& attached : this->AttachedRasterTiles) {
+      if (attached.pNames->layerName != CesiumData.LayerNames[layer]) {
+        continue;
+      }
+      LayerParameters[layer] = attached;
+      if (attached.pTexture == this->Transparent1x1) {
+        input.kind = LayerKind::Empty;
+      } else if (!attached.dynamic && attached.translationAndScale) {
+        input.kind = LayerKind::Composited;
+        input.textureCoordinateID = attached.textureCoordinateID;
+      }
+      break;
+    }
+  }
+
+  // Until the tileset has been updated with a camera, the size of the
+  // composites isn't known, so the overlays are shown in their own layers.
+  const double screenPixels = this->GetTilesetActor().getLargestViewportSize();
+  if (screenPixels <= 0.0) {
+    return;
+  }
+
+  for (const Run& run : findRuns(inputs)) {
+    TArray<Layer, TInlineAllocator<MaximumLayerCount>> layers;
+    for (int32 layer = run.firstLayer;
+         layer < run.firstLayer + run.layerCount;
+         ++layer) {
+      RasterTileUpdate& parameters = LayerParameters[layer];
+      if (inputs[layer].kind == LayerKind::Composited) {
+        layers.Add(
+            Layer{parameters.pTexture, *parameters.translationAndScale});
+      }
+      parameters.pTexture = this->Transparent1x1;
+    }
+
+    // Primitives whose materials have the same run share its composite, so
+    // each one is only rendered once.
+    const int32 textureCoordinateID =
+        inputs[run.firstLayer].textureCoordinateID;
+    int32 index = findComposite(Composites, layers, textureCoordinateID);
+    if (index == INDEX_NONE) {
+      index = Composites.Num();
+      UTextureRenderTarget2D* pExisting =
+          this->RasterOverlayComposites.IsValidIndex(index)
+              ? this->RasterOverlayComposites[index]
+              : nullptr;
+      Composites.Add(Composite{
+          layers,
+          textureCoordinateID,
+          CesiumRasterOverlayCompositor::composite(
+              *this,
+              layers,
+              pExisting,
+              screenPixels)});
+    }
+    UTextureRenderTarget2D* pComposite = Composites[index].pTarget;
+
+    // The composite covers the whole geometry tile, and takes the place of
+    // the run's bottom layer.
+    RasterTileUpdate& anchor = LayerParameters[run.firstLayer];
+    anchor.pTexture = pComposite;
+    anchor.translationAndScale = FVector4(0.0, 0.0, 1.0, 1.0);
+  }
+}
+
+void UCesiumGltfComponent::RebuildRasterOverlayComposites() {
+  // The attached overlay tiles are applied again, without replacing any
+  // changes that are already pending.
+  for (const RasterTileUpdate& attached : this->AttachedRasterTiles) {
+    const bool pending = this->PendingRasterTileUpdates.ContainsByPredicate(
+        [&attached](const RasterTileUpdate& update) {
+          return update.pNames->texture == attached.pNames->texture;
+        });
+    if (!pending) {
+      this->PendingRasterTileUpdates.Add(attached);
+    }
+  }
+}
+
+void UCesiumGltfComponent::ApplyRasterTileUpdates() {
+  if (this->PendingRasterTileUpdates.IsEmpty()) {
+    return;
+  }
+
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::ApplyRasterTileUpdates)
+
+  static const FName TextureName = TEXT("Texture");
+  static const FName TranslationScaleName = TEXT("TranslationScale");
+  static const FName TextureCoordinateIndexName =
+      TEXT("TextureCoordinateIndex");
+
+  TArray<RasterTileUpdate> updates = MoveTemp(this->PendingRasterTileUpdates);
+  this->PendingRasterTileUpdates.Reset();
+
+  // Composites depend on every overlay attached to the tile, not just the
+  // ones that changed, so those are tracked as well.
+  const bool composite = this->GetTilesetActor().GetCompositeRasterOverlays();
+  if (composite) {
+    for (const RasterTileUpdate& update : updates) {
+      RasterTileUpdate* pAttached = this->AttachedRasterTiles.FindByPredicate(
+          [&update](const RasterTileUpdate& attached) {
+            return attached.pNames->texture == update.pNames->texture;
+          });
+      if (!pAttached) {
+        this->AttachedRasterTiles.Add(update);
+        continue;
+      }
+      pAttached->pTexture = update.pTexture;
+      if (update.translationAndScale) {
+        pAttached->translationAndScale = update.translationAndScale;
+        pAttached->textureCoordinateID = update.textureCoordinateID;
+        pAttached->dynamic = update.dynamic;
+      }
+    }
+  }
+
+  // The primitives of a tile almost always share the same base material, so
+  // the material layers that map to each overlay are only looked up when the
+  // material user data changes.
+  UCesiumMaterialUserData* pLayersResolvedFor = nullptr;
+  TArray<TArray<int32, TInlineAllocator<1>>> layerIndices;
+  layerIndices.SetNum(updates.Num());
+
+  // When compositing, the parameters of every material layer are resolved
+  // instead, from all of the attached overlays.
+  TArray<RasterTileUpdate> layerParameters;
+  TArray<CesiumRasterOverlayCompositor::Composite> composites;
+
+  auto getTextureCoordinateIndex = [](const CesiumPrimitiveData& primData,
+                                      const RasterTileUpdate& update) {
+    check(
+        update.textureCoordinateID >= 0 &&
+        update.textureCoordinateID <
+            primData.overlayTextureCoordinateIDToUVIndex.size());
+    return static_cast<float>(
+        primData
+            .overlayTextureCoordinateIDToUVIndex[update.textureCoordinateID]);
+  };
 
   forEachPrimitiveComponent(
       this,
-      [&rasterTile, pTexture, &translationAndScale, textureCoordinateID](
+      [this,
+       composite,
+       &updates,
+       &pLayersResolvedFor,
+       &layerIndices,
+       &layerParameters,
+       &composites,
+       &getTextureCoordinateIndex](
           UCesiumGltfPrimitiveComponent* pPrimitive,
           UMaterialInstanceDynamic* pMaterial,
           UCesiumMaterialUserData* pCesiumData) {
         CesiumPrimitiveData& primData = pPrimitive->getPrimitiveData();
-        // If this material uses material layers and has the Cesium user data,
-        // set the parameters on each material layer that maps to this overlay
-        // tile.
-        if (pCesiumData) {
-          FString name(
-              UTF8_TO_TCHAR(rasterTile.getOverlay().getName().c_str()));
-
-          for (int32 i = 0; i < pCesiumData->LayerNames.Num(); ++i) {
-            if (pCesiumData->LayerNames[i] != name) {
+
+        if (composite && pCesiumData) {
+          if (pCesiumData != pLayersResolvedFor) {
+            this->ResolveCompositedRasterLayers(
+                *pCesiumData,
+                composites,
+                layerParameters);
+            pLayersResolvedFor = pCesiumData;
+          }
+
+          for (int32 layer = 0; layer < layerParameters.Num(); ++layer) {
+            const RasterTileUpdate& parameters = layerParameters[layer];
+            if (!parameters.pTexture) {
               continue;
             }
-
             pMaterial->SetTextureParameterValueByInfo(
                 FMaterialParameterInfo(
-                    "Texture",
-                    EMaterialParameterAssociation::LayerParameter,
-                    i),
-                pTexture);
-            pMaterial->SetVectorParameterValueByInfo(
-                FMaterialParameterInfo(
-                    "TranslationScale",
-                    EMaterialParameterAssociation::LayerParameter,
-                    i),
-                translationAndScale);
-            check(
-                textureCoordinateID >= 0 &&
-                textureCoordinateID <
-                    primData.overlayTextureCoordinateIDToUVIndex.size());
-            pMaterial->SetScalarParameterValueByInfo(
-                FMaterialParameterInfo(
-                    "TextureCoordinateIndex",
+                    TextureName,
                     EMaterialParameterAssociation::LayerParameter,
-                    i),
-                static_cast<float>(primData.overlayTextureCoordinateIDToUVIndex
-                                       [textureCoordinateID]));
+                    layer),
+                parameters.pTexture);
+            if (parameters.translationAndScale) {
+              pMaterial->SetVectorParameterValueByInfo(
+                  FMaterialParameterInfo(
+                      TranslationScaleName,
+                      EMaterialParameterAssociation::LayerParameter,
+                      layer),
+                  *parameters.translationAndScale);
+              pMaterial->SetScalarParameterValueByInfo(
+                  FMaterialParameterInfo(
+                      TextureCoordinateIndexName,
+                      EMaterialParameterAssociation::LayerParameter,
+                      layer),
+                  getTextureCoordinateIndex(primData, parameters));
+            }
           }
-        } else {
-          pMaterial->SetTextureParameterValue(
-              createSafeName(rasterTile.getOverlay().getName(), "_Texture"),
-              pTexture);
-          pMaterial->SetVectorParameterValue(
-              createSafeName(
-                  rasterTile.getOverlay().getName(),
-                  "_TranslationScale"),
-              translationAndScale);
-          pMaterial->SetScalarParameterValue(
-              createSafeName(
-                  rasterTile.getOverlay().getName(),
-                  "_TextureCoordinateIndex"),
-              static_cast<float>(primData.overlayTextureCoordinateIDToUVIndex
-                                     [textureCoordinateID]));
+          return;
         }
-      });
-}
 
-void UCesiumGltfComponent::DetachRasterTile(
-    const Cesium3DTilesSelection::Tile& tile,
-    const CesiumRasterOverlays::RasterOverlayTile& rasterTile,
-    UTexture2D* pTexture) {
-  forEachPrimitiveComponent(
-      this,
-      [this, &rasterTile, pTexture](
-          UCesiumGltfPrimitiveComponent* pPrimitive,
-          UMaterialInstanceDynamic* pMaterial,
-          UCesiumMaterialUserData* pCesiumData) {
-        // If this material uses material layers and has the Cesium user data,
-        // clear the parameters on each material layer that maps to this
-        // overlay tile.
-        if (pCesiumData) {
-          FString name(
-              UTF8_TO_TCHAR(rasterTile.getOverlay().getName().c_str()));
-          for (int32 i = 0; i < pCesiumData->LayerNames.Num(); ++i) {
-            if (pCesiumData->LayerNames[i] != name) {
-              continue;
+        if (pCesiumData && pCesiumData != pLayersResolvedFor) {
+          for (int32 i = 0; i < updates.Num(); ++i) {
+            layerIndices[i].Reset();
+            for (int32 layer = 0; layer < pCesiumData->LayerNames.Num();
+                 ++layer) {
+              if (pCesiumData->LayerNames[layer] ==
+                  updates[i].pNames->layerName) {
+                layerIndices[i].Add(layer);
+              }
             }
+          }
+          pLayersResolvedFor = pCesiumData;
+        }
 
+        for (int32 i = 0; i < updates.Num(); ++i) {
+          const RasterTileUpdate& update = updates[i];
+
+          float textureCoordinateIndex = 0.0f;
+          if (update.translationAndScale) {
+            textureCoordinateIndex =
+                getTextureCoordinateIndex(primData, update);
+          }
+
+          // Without the Cesium user data, the overlay is passed through
+          // parameters named after it.
+          if (!pCesiumData) {
+            pMaterial->SetTextureParameterValue(
+                update.pNames->texture,
+                update.pTexture);
+            if (update.translationAndScale) {
+              pMaterial->SetVectorParameterValue(
+                  update.pNames->translationScale,
+                  *update.translationAndScale);
+              pMaterial->SetScalarParameterValue(
+                  update.pNames->textureCoordinateIndex,
+                  textureCoordinateIndex);
+            }
+            continue;
+          }
+
+          // Otherwise, set the parameters on each material layer that maps to
+          // this overlay.
+          for (int32 layer : layerIndices[i]) {
             pMaterial->SetTextureParameterValueByInfo(
                 FMaterialParameterInfo(
-                    "Texture",
+                    TextureName,
                     EMaterialParameterAssociation::LayerParameter,
-                    i),
-                this->Transparent1x1);
+                    layer),
+                update.pTexture);
+            if (update.translationAndScale) {
+              pMaterial->SetVectorParameterValueByInfo(
+                  FMaterialParameterInfo(
+                      TranslationScaleName,
+                      EMaterialParameterAssociation::LayerParameter,
+                      layer),
+                  *update.translationAndScale);
+              pMaterial->SetScalarParameterValueByInfo(
+                  FMaterialParameterInfo(
+                      TextureCoordinateIndexName,
+                      EMaterialParameterAssociation::LayerParameter,
+                      layer),
+                  textureCoordinateIndex);
+            }
           }
-        } else {
-          pMaterial->SetTextureParameterValue(
-              createSafeName(rasterTile.getOverlay().getName(), "_Texture"),
-              this->Transparent1x1);
         }
       });
+
+  if (composite) {
+    // Composites that are no longer needed are released.
+    this->RasterOverlayComposites.Reset(composites.Num());
+    for (const CesiumRasterOverlayCompositor::Composite& resolved :
+         composites) {
+      this->RasterOverlayComposites.Add(resolved.pTarget);
+    }
+
+    FCesium3DTilesetMemoryStatistics statistics = this->MemoryStatistics;
+    statistics.RasterOverlayCompositeBytes = 0;
+    for (const UTextureRenderTarget2D* pComposite :
+         this->RasterOverlayComposites) {
+      statistics.RasterOverlayCompositeBytes +=
+          CesiumRasterOverlayCompositor::computeBytes(
+              pComposite->SizeX,
+              pComposite->SizeY);
+    }
+    UnrealPrepareRendererResources::updateTileMemoryStatistics(
+        this->GetTilesetActor(),
+        this->MemoryStatistics,
+        statistics);
+  }
 }
 
 void UCesiumGltfComponent::SetCollisionEnabled(
     ECollisionEnabled::Type NewType) {
+  // Hit results from line traces and physics may be used to look up the hit
+  // mesh's render data, such as its materials, so a tile that can be hit
+  // needs its buffers even while it's hidden.
+  if (NewType != ECollisionEnabled::NoCollision) {
+    this->RestoreGpuResources();
+  }
+
   for (USceneComponent* pSceneComponent : this->GetAttachChildren()) {
     UCesiumGltfPrimitiveComponent* pPrimitive =
         Cast<UCesiumGltfPrimitiveComponent>(pSceneComponent);
@@ -3784,6 +4639,24 @@ void UCesiumGltfComponent::SetCollisionEnabled(
   }
 }
 
+/*static*/ void UCesiumGltfComponent::AddReferencedObjects(
+    UObject* InThis,
+    FReferenceCollector& Collector) {
+  UCesiumGltfComponent* pThis = CastChecked<UCesiumGltfComponent>(InThis);
+
+  // The overlay textures are owned by the raster overlay tiles, but a tile
+  // that is detached or freed may be garbage collected before its textures
+  // are removed from here.
+  for (RasterTileUpdate& update : pThis->PendingRasterTileUpdates) {
+    Collector.AddReferencedObject(update.pTexture, pThis);
+  }
+  for (RasterTileUpdate& attached : pThis->AttachedRasterTiles) {
+    Collector.AddReferencedObject(attached.pTexture, pThis);
+  }
+
+  Super::AddReferencedObjects(InThis, Collector);
+}
+
 void UCesiumGltfComponent::BeginDestroy() {
   // Clear everything we can in order to reduce memory usage, because this
   // UObject might not actually get deleted by the garbage collector until
@@ -3791,6 +4664,18 @@ void UCesiumGltfComponent::BeginDestroy() {
   this->Metadata = FCesiumModelMetadata();
   this->EncodedMetadata = EncodedFeaturesMetadata::EncodedModelMetadata();
 
+  ACesium3DTileset* pTileset = Cast<ACesium3DTileset>(this->GetOuter());
+  if (pTileset) {
+    pTileset->unregisterStreamedTextures(this->StreamedTextures);
+  }
+  this->StreamedTextures.Empty();
+
+  if (this->GpuResourcesEvicted) {
+    DEC_MEMORY_STAT_BY(STAT_CesiumEvictedTileGpuMemory, this->EvictedGpuBytes);
+    this->GpuResourcesEvicted = false;
+    this->EvictedGpuBytes = 0;
+  }
+
   PRAGMA_DISABLE_DEPRECATION_WARNINGS
   this->EncodedMetadata_DEPRECATED.reset();
   PRAGMA_ENABLE_DEPRECATION_WARNINGS
@@ -3830,6 +4715,9 @@ void UCesiumGltfComponent::UpdateFade(float fadePercentage, bool fadingIn) {
       continue;
     }
 
+    pMaterial =
+        CesiumMaterialInstanceCache::makeMaterialUnique(*pPrimitive, pMaterial);
+
     pMaterial->SetScalarParameterValueByInfo(
         FMaterialParameterInfo(
             "FadePercentage",
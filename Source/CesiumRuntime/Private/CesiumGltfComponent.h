@@ -4,9 +4,12 @@
 
 #include "Cesium3DTilesSelection/Tile.h"
 #include "Cesium3DTileset.h"
+#include "Cesium3DTilesetMemoryStatistics.h"
 #include "CesiumEncodedMetadataUtility.h"
 #include "CesiumLoadedTile.h"
 #include "CesiumModelMetadata.h"
+#include "CesiumRasterOverlayParameterNames.h"
+#include "CesiumTextureResource.h"
 #include "Components/PrimitiveComponent.h"
 #include "Components/SceneComponent.h"
 #include "CoreMinimal.h"
@@ -17,10 +20,14 @@
 #include <CesiumAsync/SharedFuture.h>
 #include <glm/mat4x4.hpp>
 #include <memory>
+#include <optional>
+#include <string>
 #include "CesiumGltfComponent.generated.h"
 
+class UCesiumMaterialUserData;
 class UMaterialInterface;
 class UTexture2D;
+class UTextureRenderTarget2D;
 class UStaticMeshComponent;
 
 namespace CreateGltfOptions {
@@ -39,6 +46,10 @@ namespace CesiumRasterOverlays {
 class RasterOverlayTile;
 }
 
+namespace CesiumRasterOverlayCompositor {
+struct Composite;
+}
+
 namespace CesiumGeometry {
 struct Rectangle;
 }
@@ -116,8 +127,82 @@ public:
       EncodedMetadata_DEPRECATED = std::nullopt;
   PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
+  /**
+   * The memory used by this tile's Unreal resources and retained glTF data,
+   * computed when the component is created.
+   */
+  FCesium3DTilesetMemoryStatistics MemoryStatistics{};
+
+  /**
+   * The textures used by this tile that wrap a resource from the
+   * CesiumTextureCache, which other tiles may use as well, with the memory
+   * each one uses. This memory is counted once per tileset by
+   * ACesium3DTileset::registerSharedTextures rather than in MemoryStatistics.
+   */
+  TMap<TSharedPtr<FCesiumTextureResource>, FCesium3DTilesetMemoryStatistics>
+      SharedTextures;
+
+  /**
+   * The textures used by this tile whose mips are streamed.
+   */
+  TArray<TSharedPtr<FCesiumStreamedTextureResource>> StreamedTextures;
+
+  /**
+   * Requests the mips of this tile's streamed textures that are needed to
+   * draw the tile at the given size on screen, in pixels.
+   */
+  void RequestTextureMips(double ScreenSize, uint64 Frame);
+
+  /**
+   * Uploads or drops mips of this tile's streamed textures to match the
+   * requests made by all tiles in the given frame.
+   */
+  void UpdateTextureStreaming(uint64 Frame, bool bMemoryPressure);
+
+  /**
+   * The frame in which this tile was last visible, or 0 if its tileset hasn't
+   * checked yet. Hidden tiles' GPU resources are evicted in order of this
+   * frame.
+   */
+  uint64 LastVisibleFrame = 0;
+
+  /**
+   * Gets the number of bytes of GPU memory that {@link EvictGpuResources}
+   * would release now. These are the vertex and index buffers of the tile's
+   * meshes, except those with Nanite data, a scene proxy, or collision, which
+   * keep their buffers. Returns 0 if the tile's resources are already evicted.
+   */
+  int64 GetEvictableGpuBytes() const;
+
+  /**
+   * Whether {@link EvictGpuResources} was called since the tile was last
+   * shown.
+   */
+  bool AreGpuResourcesEvicted() const { return GpuResourcesEvicted; }
+
+  /**
+   * Releases the GPU vertex and index buffers of this tile's meshes, which
+   * must have been created with CPU copies, and drops the finer mips of its
+   * streamed textures that no tile requested in the given frame. The tile must
+   * be hidden, and is restored with {@link RestoreGpuResources} when it is
+   * shown again.
+   */
+  void EvictGpuResources(uint64 Frame);
+
+  /**
+   * Uploads the vertex and index buffers released by
+   * {@link EvictGpuResources} again. This does nothing if they weren't
+   * released. It is called whenever the tile is made visible or its collision
+   * is enabled, so that nothing can draw or hit an evicted mesh.
+   */
+  void RestoreGpuResources();
+
   void UpdateTransformFromCesium(const glm::dmat4& CesiumToUnrealTransform);
 
+  /**
+   * Records that a raster overlay tile is to be attached to this tile's
+   * primitives. Call ApplyRasterTileUpdates to update their materials.
+   */
   void AttachRasterTile(
       const Cesium3DTilesSelection::Tile& Tile,
       const CesiumRasterOverlays::RasterOverlayTile& RasterTile,
@@ -126,14 +211,37 @@ public:
       const glm::dvec2& Scale,
       int32_t TextureCoordinateID);
 
+  /**
+   * Records that a raster overlay tile is to be detached from this tile's
+   * primitives. Call ApplyRasterTileUpdates to update their materials.
+   */
   void DetachRasterTile(
       const Cesium3DTilesSelection::Tile& Tile,
       const CesiumRasterOverlays::RasterOverlayTile& RasterTile,
       UTexture2D* Texture);
 
+  /**
+   * Updates the materials of this tile's primitives with the raster overlay
+   * tiles attached and detached since the last call. Each material parameter
+   * is set at most once, no matter how many times the corresponding overlay
+   * changed in between.
+   */
+  void ApplyRasterTileUpdates();
+
+  /**
+   * Records that this tile's raster overlay composites are to be rendered
+   * again, such as when the viewport that bounds their size grows. Call
+   * ApplyRasterTileUpdates to rebuild them. This does nothing unless the
+   * tileset composites its raster overlays.
+   */
+  void RebuildRasterOverlayComposites();
+
   UFUNCTION(BlueprintCallable, Category = "Collision")
   virtual void SetCollisionEnabled(ECollisionEnabled::Type NewType);
 
+  static void
+  AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
   virtual void BeginDestroy() override;
   virtual void OnVisibilityChanged() override;
 
@@ -147,6 +255,49 @@ public:
   void UpdateFade(float fadePercentage, bool fadingIn);
 
 private:
+  struct RasterTileUpdate {
+    TSharedPtr<const CesiumRasterOverlayParameterNames> pNames;
+    UTexture2D* pTexture;
+
+    // Only set if the overlay was attached, rather than just detached.
+    std::optional<FVector4> translationAndScale;
+    int32 textureCoordinateID;
+
+    // Whether the overlay is kept in its own material layer when overlays are
+    // composited, because it changes often or doesn't hold sRGB color.
+    bool dynamic;
+  };
+
+  TSharedRef<const CesiumRasterOverlayParameterNames>
+  GetRasterOverlayParameterNames(const std::string& overlayName);
+
+  RasterTileUpdate& FindOrAddRasterTileUpdate(
+      const CesiumRasterOverlays::RasterOverlayTile& rasterTile);
+
+  void ResolveCompositedRasterLayers(
+      const UCesiumMaterialUserData& CesiumData,
+      TArray<CesiumRasterOverlayCompositor::Composite>& Composites,
+      TArray<RasterTileUpdate>& LayerParameters);
+
   UPROPERTY()
   UTexture2D* Transparent1x1 = nullptr;
+
+  bool GpuResourcesEvicted = false;
+
+  // The bytes of the buffers released by the last EvictGpuResources, while
+  // they stay evicted.
+  int64 EvictedGpuBytes = 0;
+
+  // At most one per overlay. The textures are reported to the garbage
+  // collector in AddReferencedObjects.
+  TArray<RasterTileUpdate> PendingRasterTileUpdates;
+
+  // The overlay tiles currently attached to this tile, one per overlay. These
+  // are only tracked when the tileset composites its raster overlays, because
+  // the composites are rebuilt from all of them whenever one changes. Their
+  // textures are reported in AddReferencedObjects.
+  TArray<RasterTileUpdate> AttachedRasterTiles;
+
+  UPROPERTY()
+  TArray<UTextureRenderTarget2D*> RasterOverlayComposites;
 };
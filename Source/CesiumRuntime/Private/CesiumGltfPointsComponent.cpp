@@ -9,7 +9,8 @@
 UCesiumGltfPointsComponent::UCesiumGltfPointsComponent()
     : UsesAdditiveRefinement(false),
       GeometricError(0),
-      Dimensions(glm::vec3(0)) {}
+      Dimensions(glm::vec3(0)),
+      PointsInProgressiveOrder(false) {}
 
 UCesiumGltfPointsComponent::~UCesiumGltfPointsComponent() {}
 
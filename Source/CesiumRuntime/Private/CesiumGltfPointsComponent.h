@@ -28,6 +28,10 @@ public:
   // error.
   glm::vec3 Dimensions;
 
+  // Whether the points have been sorted so that they can be decimated by
+  // drawing a prefix of them.
+  bool PointsInProgressiveOrder;
+
   // Override UPrimitiveComponent interface.
   virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
 };
@@ -2,14 +2,42 @@
 
 #include "CesiumGltfPointsSceneProxy.h"
 #include "CesiumGltfPointsComponent.h"
+#include "CesiumPointCloudUtility.h"
+#include "CesiumStats.h"
 #include "DataDrivenShaderPlatformInfo.h"
 #include "Engine/StaticMesh.h"
+#include "PrimitiveSceneInfo.h"
 #include "RHIResources.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "SceneInterface.h"
 #include "SceneView.h"
 #include "StaticMeshResources.h"
 
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Point Cloud Static Mesh Builds"),
+    STAT_CesiumPointCloudStaticMeshBuilds,
+    STATGROUP_Cesium);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Point Cloud Dynamic Meshes"),
+    STAT_CesiumPointCloudDynamicMeshes,
+    STATGROUP_Cesium);
+
+namespace {
+// The number of consecutive frames that the dynamic path must use the same
+// depth multiplier before the view-dependent mesh is drawn statically with it.
+constexpr int32 StableDepthMultiplierFrameCount = 3;
+
+// The number of static LODs drawn for decimated points. Each LOD has a quarter
+// of the points of the previous one.
+constexpr int32 NumDecimationLODs = 4;
+
+float GetDepthMultiplier(const FSceneView* View) {
+  float SSEDenominator = 2.0f * tanf(0.5f * FMath::DegreesToRadians(View->FOV));
+  return static_cast<float>(View->UnconstrainedViewRect.Height()) /
+         SSEDenominator;
+}
+} // namespace
+
 FCesiumGltfPointsSceneProxyTilesetData::FCesiumGltfPointsSceneProxyTilesetData()
     : PointCloudShading(),
       MaximumScreenSpaceError(0.0),
@@ -45,22 +73,90 @@ FCesiumGltfPointsSceneProxy::FCesiumGltfPointsSceneProxy(
       AttenuationVertexFactory(
           InSceneInterfaceParams.RHIFeatureLevelType,
           &RenderData->LODResources[0].VertexBuffers.PositionVertexBuffer),
-      AttenuationIndexBuffer(NumPoints, bAttenuationSupported),
+      AttenuationIndexBuffer(nullptr),
       Material(InComponent->GetMaterial(0)),
       MaterialRelevance(
-          InSceneInterfaceParams.GetMaterialRelevance(InComponent)) {}
+          InSceneInterfaceParams.GetMaterialRelevance(InComponent)),
+      StaticUserData(),
+      StaticDepthMultiplier(0.0f),
+      CandidateDepthMultiplier(0.0f),
+      CandidateViewHeight(0),
+      CandidateFrameNumber(0),
+      CandidateFrameCount(0),
+      StaticViewHeight(0),
+      bPointsInProgressiveOrder(InComponent->PointsInProgressiveOrder) {}
 
 FCesiumGltfPointsSceneProxy::~FCesiumGltfPointsSceneProxy() {}
 
 void FCesiumGltfPointsSceneProxy::CreateRenderThreadResources(
     FRHICommandListBase& RHICmdList) {
   AttenuationVertexFactory.InitResource(RHICmdList);
-  AttenuationIndexBuffer.InitResource(RHICmdList);
+  if (bAttenuationSupported) {
+    AttenuationIndexBuffer =
+        FCesiumPointAttenuationIndexBuffer::Acquire(RHICmdList, NumPoints);
+  }
 }
 
 void FCesiumGltfPointsSceneProxy::DestroyRenderThreadResources() {
   AttenuationVertexFactory.ReleaseResource();
-  AttenuationIndexBuffer.ReleaseResource();
+  FCesiumPointAttenuationIndexBuffer::Release(AttenuationIndexBuffer);
+  AttenuationIndexBuffer = nullptr;
+}
+
+void FCesiumGltfPointsSceneProxy::DrawStaticElements(
+    FStaticPrimitiveDrawInterface* PDI) {
+  if (DependsOnView()) {
+    if (CandidateFrameCount >= StableDepthMultiplierFrameCount) {
+      StaticDepthMultiplier = CandidateDepthMultiplier;
+      StaticViewHeight = CandidateViewHeight;
+    }
+
+    if (StaticDepthMultiplier <= 0.0f) {
+      // No view has settled on a depth multiplier yet, so every view uses the
+      // dynamic path.
+      return;
+    }
+  }
+
+  // The renderer caches the mesh draw commands of these meshes, so this is
+  // only counted when they're rebuilt, not every frame.
+  INC_DWORD_STAT(STAT_CesiumPointCloudStaticMeshBuilds);
+
+  const bool useAttenuation = UsesAttenuation();
+
+  FMeshBatch Mesh;
+  if (useAttenuation) {
+    InitPointAttenuationUserData(StaticUserData, StaticDepthMultiplier);
+    CreateMeshWithAttenuation(Mesh, NumPoints);
+    Mesh.Elements[0].UserData = &StaticUserData;
+  } else {
+    CreateMesh(Mesh, NumPoints);
+  }
+
+  if (!UsesDecimation()) {
+    PDI->DrawMesh(Mesh, FLT_MAX);
+    return;
+  }
+
+  // The renderer picks the last LOD whose screen size is at least the screen
+  // size of the bounds. LOD N is used once the points would be 1/2^N pixels
+  // apart, at which point only 1/4^N of them are needed.
+  const float OnePixelScreenSize =
+      2.0f * GetBounds().SphereRadius /
+      (float(StaticViewHeight) * GetGeometricError() * 100.0f);
+  for (int32 LOD = 0; LOD < NumDecimationLODs; ++LOD) {
+    const float PointSpacingInPixels = 1.0f / float(1 << LOD);
+    SetNumPointsToDraw(
+        Mesh,
+        CesiumPointCloudUtility::computeProgressivePointCount(
+            NumPoints,
+            PointSpacingInPixels),
+        useAttenuation);
+    Mesh.LODIndex = LOD;
+    PDI->DrawMesh(
+        Mesh,
+        LOD == 0 ? FLT_MAX : OnePixelScreenSize * PointSpacingInPixels);
+  }
 }
 
 void FCesiumGltfPointsSceneProxy::GetDynamicMeshElements(
@@ -70,19 +166,31 @@ void FCesiumGltfPointsSceneProxy::GetDynamicMeshElements(
     FMeshElementCollector& Collector) const {
   QUICK_SCOPE_CYCLE_COUNTER(STAT_GltfPointsSceneProxy_GetDynamicMeshElements);
 
-  const bool useAttenuation =
-      bAttenuationSupported && TilesetData.PointCloudShading.Attenuation;
+  const bool useAttenuation = UsesAttenuation();
+  const bool useDecimation = UsesDecimation();
 
   for (int32 ViewIndex = 0; ViewIndex < Views.Num(); ViewIndex++) {
     if (VisibilityMap & (1 << ViewIndex)) {
       const FSceneView* View = Views[ViewIndex];
+      const float DepthMultiplier = GetDepthMultiplier(View);
+      const int32 NumPointsToDraw =
+          useDecimation ? GetNumPointsToDraw(View, DepthMultiplier) : NumPoints;
+
       FMeshBatch& Mesh = Collector.AllocateMesh();
       if (useAttenuation) {
-        CreateMeshWithAttenuation(Mesh, View, Collector);
+        CreateMeshWithAttenuation(Mesh, NumPointsToDraw);
+        Mesh.Elements[0].PrimitiveUniformBuffer = GetUniformBuffer();
+        CreatePointAttenuationUserData(
+            Mesh.Elements[0],
+            DepthMultiplier,
+            Collector);
       } else {
-        CreateMesh(Mesh);
+        CreateMesh(Mesh, NumPointsToDraw);
       }
       Collector.AddMesh(ViewIndex, Mesh);
+      INC_DWORD_STAT(STAT_CesiumPointCloudDynamicMeshes);
+
+      TrackDepthMultiplier(View, DepthMultiplier);
     }
   }
 }
@@ -91,10 +199,13 @@ FPrimitiveViewRelevance
 FCesiumGltfPointsSceneProxy::GetViewRelevance(const FSceneView* View) const {
   FPrimitiveViewRelevance Result;
   Result.bDrawRelevance = IsShown(View);
-  // Always render dynamically; the appearance of the points can change
-  // via point cloud shading.
-  Result.bDynamicRelevance = true;
-  Result.bStaticRelevance = false;
+  // The cached static mesh is only valid for views that would compute the same
+  // attenuation parameters and decimation LODs. Other views render dynamically
+  // until the parameters settle and the static mesh is rebuilt.
+  const bool bUseStaticPath = !DependsOnView() ||
+                              GetDepthMultiplier(View) == StaticDepthMultiplier;
+  Result.bDynamicRelevance = !bUseStaticPath;
+  Result.bStaticRelevance = bUseStaticPath;
 
   Result.bRenderCustomDepth = ShouldRenderCustomDepth();
   Result.bRenderInMainPass = ShouldRenderInMainPass();
@@ -117,6 +228,43 @@ uint32 FCesiumGltfPointsSceneProxy::GetMemoryFootprint(void) const {
 void FCesiumGltfPointsSceneProxy::UpdateTilesetData(
     const FCesiumGltfPointsSceneProxyTilesetData& InTilesetData) {
   TilesetData = InTilesetData;
+
+  // The static mesh depends on the point cloud shading, so rebuild it with the
+  // new settings.
+  RequestStaticMeshUpdate();
+}
+
+bool FCesiumGltfPointsSceneProxy::UsesAttenuation() const {
+  return AttenuationIndexBuffer != nullptr &&
+         TilesetData.PointCloudShading.Attenuation;
+}
+
+bool FCesiumGltfPointsSceneProxy::UsesDecimation() const {
+  // The spacing between points is estimated from the geometric error, so
+  // points without one can't be decimated.
+  return bPointsInProgressiveOrder &&
+         TilesetData.PointCloudShading.Decimation && GetGeometricError() > 0.0f;
+}
+
+bool FCesiumGltfPointsSceneProxy::DependsOnView() const {
+  return UsesAttenuation() || UsesDecimation();
+}
+
+int32 FCesiumGltfPointsSceneProxy::GetNumPointsToDraw(
+    const FSceneView* View,
+    float DepthMultiplier) const {
+  const FBoxSphereBounds& Bounds = GetBounds();
+  const double Distance = FMath::Max(
+      FVector::Dist(View->ViewMatrices.GetViewOrigin(), Bounds.Origin) -
+          Bounds.SphereRadius,
+      1.0);
+
+  // Like in the attenuation shader, the geometric error is in meters.
+  const float PointSpacingInPixels =
+      GetGeometricError() * DepthMultiplier / float(Distance / 100.0);
+  return CesiumPointCloudUtility::computeProgressivePointCount(
+      NumPoints,
+      PointSpacingInPixels);
 }
 
 float FCesiumGltfPointsSceneProxy::GetGeometricError() const {
@@ -136,15 +284,9 @@ float FCesiumGltfPointsSceneProxy::GetGeometricError() const {
   return FMath::Pow(Volume / NumPoints, 1.0f / 3.0f);
 }
 
-void FCesiumGltfPointsSceneProxy::CreatePointAttenuationUserData(
-    FMeshBatchElement& BatchElement,
-    const FSceneView* View,
-    FMeshElementCollector& Collector) const {
-  FCesiumPointAttenuationBatchElementUserDataWrapper* UserDataWrapper =
-      &Collector.AllocateOneFrameResource<
-          FCesiumPointAttenuationBatchElementUserDataWrapper>();
-
-  FCesiumPointAttenuationBatchElementUserData& UserData = UserDataWrapper->Data;
+void FCesiumGltfPointsSceneProxy::InitPointAttenuationUserData(
+    FCesiumPointAttenuationBatchElementUserData& UserData,
+    float DepthMultiplier) const {
   const FLocalVertexFactory& OriginalVertexFactory =
       RenderData->LODVertexFactories[0].VertexFactory;
 
@@ -169,21 +311,76 @@ void FCesiumGltfPointsSceneProxy::CreatePointAttenuationUserData(
   float GeometricError = GetGeometricError();
   GeometricError *= PointCloudShading.GeometricErrorScale;
 
-  // Depth Multiplier
-  float SSEDenominator = 2.0f * tanf(0.5f * FMath::DegreesToRadians(View->FOV));
-  float DepthMultiplier =
-      static_cast<float>(View->UnconstrainedViewRect.Height()) / SSEDenominator;
-
   UserData.AttenuationParameters =
       FVector3f(MaximumPointSize, GeometricError, DepthMultiplier);
+}
+
+void FCesiumGltfPointsSceneProxy::CreatePointAttenuationUserData(
+    FMeshBatchElement& BatchElement,
+    float DepthMultiplier,
+    FMeshElementCollector& Collector) const {
+  FCesiumPointAttenuationBatchElementUserDataWrapper* UserDataWrapper =
+      &Collector.AllocateOneFrameResource<
+          FCesiumPointAttenuationBatchElementUserDataWrapper>();
+
+  InitPointAttenuationUserData(UserDataWrapper->Data, DepthMultiplier);
 
   BatchElement.UserData = &UserDataWrapper->Data;
 }
 
+void FCesiumGltfPointsSceneProxy::TrackDepthMultiplier(
+    const FSceneView* View,
+    float DepthMultiplier) const {
+  // Scene captures often have a different field of view than the main view,
+  // so let them render dynamically rather than rebuilding the static mesh
+  // back and forth.
+  if (View->bIsSceneCapture || !View->Family) {
+    return;
+  }
+
+  const uint32 FrameNumber = View->Family->FrameNumber;
+  if (DepthMultiplier != CandidateDepthMultiplier) {
+    CandidateDepthMultiplier = DepthMultiplier;
+    CandidateViewHeight = View->UnconstrainedViewRect.Height();
+    CandidateFrameNumber = FrameNumber;
+    CandidateFrameCount = 1;
+    return;
+  }
+
+  if (FrameNumber == CandidateFrameNumber) {
+    return;
+  }
+
+  CandidateFrameNumber = FrameNumber;
+  if (++CandidateFrameCount == StableDepthMultiplierFrameCount) {
+    RequestStaticMeshUpdate();
+  }
+}
+
+void FCesiumGltfPointsSceneProxy::RequestStaticMeshUpdate() const {
+  // This is null until the proxy has been added to the scene, in which case
+  // the static mesh will be drawn for the first time soon anyway.
+  FPrimitiveSceneInfo* PrimitiveSceneInfo = GetPrimitiveSceneInfo();
+  if (PrimitiveSceneInfo) {
+    PrimitiveSceneInfo->BeginDeferredUpdateStaticMeshes();
+  }
+}
+
+void FCesiumGltfPointsSceneProxy::SetNumPointsToDraw(
+    FMeshBatch& Mesh,
+    int32 NumPointsToDraw,
+    bool bWithAttenuation) const {
+  // Each attenuated point is drawn as a quad made of two triangles.
+  FMeshBatchElement& BatchElement = Mesh.Elements[0];
+  BatchElement.NumPrimitives =
+      bWithAttenuation ? NumPointsToDraw * 2 : NumPointsToDraw;
+  BatchElement.MaxVertexIndex =
+      bWithAttenuation ? NumPointsToDraw * 4 - 1 : NumPointsToDraw - 1;
+}
+
 void FCesiumGltfPointsSceneProxy::CreateMeshWithAttenuation(
     FMeshBatch& Mesh,
-    const FSceneView* View,
-    FMeshElementCollector& Collector) const {
+    int32 NumPointsToDraw) const {
   Mesh.VertexFactory = &AttenuationVertexFactory;
   Mesh.MaterialRenderProxy = Material->GetRenderProxy();
   Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
@@ -195,17 +392,15 @@ void FCesiumGltfPointsSceneProxy::CreateMeshWithAttenuation(
   Mesh.bWireframe = false;
 
   FMeshBatchElement& BatchElement = Mesh.Elements[0];
-  BatchElement.IndexBuffer = &AttenuationIndexBuffer;
-  BatchElement.NumPrimitives = NumPoints * 2;
+  BatchElement.IndexBuffer = AttenuationIndexBuffer;
   BatchElement.FirstIndex = 0;
   BatchElement.MinVertexIndex = 0;
-  BatchElement.MaxVertexIndex = NumPoints * 4 - 1;
-  BatchElement.PrimitiveUniformBuffer = GetUniformBuffer();
-
-  CreatePointAttenuationUserData(BatchElement, View, Collector);
+  SetNumPointsToDraw(Mesh, NumPointsToDraw, true);
 }
 
-void FCesiumGltfPointsSceneProxy::CreateMesh(FMeshBatch& Mesh) const {
+void FCesiumGltfPointsSceneProxy::CreateMesh(
+    FMeshBatch& Mesh,
+    int32 NumPointsToDraw) const {
   Mesh.VertexFactory = &RenderData->LODVertexFactories[0].VertexFactory;
   Mesh.MaterialRenderProxy = Material->GetRenderProxy();
   Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
@@ -218,8 +413,7 @@ void FCesiumGltfPointsSceneProxy::CreateMesh(FMeshBatch& Mesh) const {
 
   FMeshBatchElement& BatchElement = Mesh.Elements[0];
   BatchElement.IndexBuffer = &RenderData->LODResources[0].IndexBuffer;
-  BatchElement.NumPrimitives = NumPoints;
   BatchElement.FirstIndex = 0;
   BatchElement.MinVertexIndex = 0;
-  BatchElement.MaxVertexIndex = BatchElement.NumPrimitives - 1;
+  SetNumPointsToDraw(Mesh, NumPointsToDraw, false);
 }
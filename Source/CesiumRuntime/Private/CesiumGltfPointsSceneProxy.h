@@ -47,6 +47,8 @@ protected:
 
   virtual void DestroyRenderThreadResources() override;
 
+  virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override;
+
   virtual void GetDynamicMeshElements(
       const TArray<const FSceneView*>& Views,
       const FSceneViewFamily& ViewFamily,
@@ -70,23 +72,68 @@ private:
   // its ACesium3DTileset.
   FCesiumGltfPointsSceneProxyTilesetData TilesetData;
 
-  // The vertex factory and index buffer for point attenuation.
+  // The vertex factory and shared index buffer for point attenuation. The
+  // index buffer is null if attenuation isn't supported.
   FCesiumPointAttenuationVertexFactory AttenuationVertexFactory;
-  FCesiumPointAttenuationIndexBuffer AttenuationIndexBuffer;
+  FCesiumPointAttenuationIndexBuffer* AttenuationIndexBuffer;
 
   UMaterialInterface* Material;
   FMaterialRelevance MaterialRelevance;
 
+  // The user data of the attenuated mesh drawn in DrawStaticElements. Unlike
+  // the user data of dynamic meshes, this must live as long as the cached mesh
+  // draw commands that are built from it.
+  FCesiumPointAttenuationBatchElementUserData StaticUserData;
+
+  // The depth multiplier that the static mesh was built with, or 0 if a
+  // view-dependent mesh hasn't been drawn statically yet. Views with a
+  // different depth multiplier use the dynamic path.
+  float StaticDepthMultiplier;
+
+  // The depth multiplier most recently used by the dynamic path, the height of
+  // the view it was used for, and the number of consecutive frames it has been
+  // used for. Once it is stable, the static mesh is rebuilt with it.
+  mutable float CandidateDepthMultiplier;
+  mutable int32 CandidateViewHeight;
+  mutable uint32 CandidateFrameNumber;
+  mutable int32 CandidateFrameCount;
+
+  // The view height that the static decimation LODs were built for.
+  int32 StaticViewHeight;
+
+  // Whether the points were sorted on load so that any prefix of them covers
+  // the whole tile.
+  bool bPointsInProgressiveOrder;
+
+  bool UsesAttenuation() const;
+  bool UsesDecimation() const;
+
+  // Whether the mesh drawn for a view depends on the view's depth multiplier.
+  bool DependsOnView() const;
+
+  int32 GetNumPointsToDraw(const FSceneView* View, float DepthMultiplier) const;
+
   float GetGeometricError() const;
 
+  void InitPointAttenuationUserData(
+      FCesiumPointAttenuationBatchElementUserData& UserData,
+      float DepthMultiplier) const;
+
   void CreatePointAttenuationUserData(
       FMeshBatchElement& BatchElement,
-      const FSceneView* View,
+      float DepthMultiplier,
       FMeshElementCollector& Collector) const;
 
-  void CreateMeshWithAttenuation(
+  void
+  TrackDepthMultiplier(const FSceneView* View, float DepthMultiplier) const;
+
+  void RequestStaticMeshUpdate() const;
+
+  void SetNumPointsToDraw(
       FMeshBatch& Mesh,
-      const FSceneView* View,
-      FMeshElementCollector& Collector) const;
-  void CreateMesh(FMeshBatch& Mesh) const;
+      int32 NumPointsToDraw,
+      bool bWithAttenuation) const;
+
+  void CreateMeshWithAttenuation(FMeshBatch& Mesh, int32 NumPointsToDraw) const;
+  void CreateMesh(FMeshBatch& Mesh, int32 NumPointsToDraw) const;
 };
@@ -3,6 +3,7 @@
 #include "CesiumGltfPrimitiveComponent.h"
 #include "CalcBounds.h"
 #include "CesiumLifetime.h"
+#include "CesiumMaterialInstanceCache.h"
 #include "CesiumMaterialUserData.h"
 #include "Engine/Texture.h"
 #include "Materials/MaterialInstanceDynamic.h"
@@ -37,12 +38,16 @@ void destroyCesiumPrimitive(UStaticMeshComponent* pComponent) {
   // UObject might not actually get deleted by the garbage collector until
   // much later.
   auto* cesiumPrimitive = Cast<ICesiumPrimitive>(pComponent);
-  cesiumPrimitive->getPrimitiveData().destroy();
   UMaterialInstanceDynamic* pMaterial =
       Cast<UMaterialInstanceDynamic>(pComponent->GetMaterial(0));
-  if (pMaterial) {
+  // This must happen before the primitive data is destroyed, because that
+  // records whether the material is shared.
+  if (pMaterial && !CesiumMaterialInstanceCache::releaseSharedMaterial(
+                       *pComponent,
+                       pMaterial)) {
     CesiumLifetime::destroy(pMaterial);
   }
+  cesiumPrimitive->getPrimitiveData().destroy();
 
   UStaticMesh* pMesh = pComponent->GetStaticMesh();
   if (pMesh) {
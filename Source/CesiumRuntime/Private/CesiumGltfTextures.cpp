@@ -6,6 +6,8 @@
 #include "CesiumTextureUtility.h"
 #include "ExtensionImageAssetUnreal.h"
 #include <CesiumGltf/AccessorView.h>
+#include <CesiumGltf/ExtensionExtMeshFeatures.h>
+#include <CesiumGltf/ExtensionModelExtStructuralMetadata.h>
 #include <CesiumGltf/Model.h>
 #include <CesiumGltf/VertexAttributeSemantics.h>
 #include <CesiumGltfReader/GltfReader.h>
@@ -30,19 +32,28 @@ bool doesTextureUseMipmaps(
     const CesiumGltf::Model& gltf,
     const CesiumGltf::Texture& texture);
 
+// Determines which of the model's images are sampled as data, by feature ID
+// or property textures, and so must not be compressed lossily.
+std::vector<bool> findDataImages(const CesiumGltf::Model& gltf);
+
 // Creates a single texture in the load thread.
 SharedFuture<void> createTextureInLoadThread(
     const AsyncSystem& asyncSystem,
     CesiumGltf::Model& gltf,
     CesiumGltf::TextureInfo& textureInfo,
     bool sRGB,
-    const std::vector<bool>& imageNeedsMipmaps);
+    const std::vector<bool>& imageNeedsMipmaps,
+    ECesiumTextureCompression compression,
+    const std::vector<bool>& imageIsData,
+    bool streamMips);
 
 } // namespace
 
 /*static*/ CesiumAsync::Future<void> CesiumGltfTextures::createInWorkerThread(
     const CesiumAsync::AsyncSystem& asyncSystem,
-    CesiumGltf::Model& model) {
+    CesiumGltf::Model& model,
+    ECesiumTextureCompression compression,
+    bool streamMips) {
   // This array is parallel to model.images and indicates whether each image
   // requires mipmaps. An image requires mipmaps if any of its textures have a
   // sampler that will use them.
@@ -58,11 +69,21 @@ SharedFuture<void> createTextureInLoadThread(
     }
   }
 
+  std::vector<bool> imageIsData;
+  if (compression != ECesiumTextureCompression::None || streamMips) {
+    imageIsData = findDataImages(model);
+  }
+
   std::vector<SharedFuture<void>> futures;
 
   model.forEachPrimitiveInScene(
       -1,
-      [&imageNeedsMipmaps, &asyncSystem, &futures](
+      [&imageNeedsMipmaps,
+       &asyncSystem,
+       &futures,
+       compression,
+       &imageIsData,
+       streamMips](
           CesiumGltf::Model& gltf,
           CesiumGltf::Node& node,
           CesiumGltf::Mesh& mesh,
@@ -86,7 +107,10 @@ SharedFuture<void> createTextureInLoadThread(
                 gltf,
                 *pMaterial->pbrMetallicRoughness->baseColorTexture,
                 true,
-                imageNeedsMipmaps));
+                imageNeedsMipmaps,
+                compression,
+                imageIsData,
+                streamMips));
           }
           if (pMaterial->pbrMetallicRoughness->metallicRoughnessTexture) {
             futures.emplace_back(createTextureInLoadThread(
@@ -94,7 +118,10 @@ SharedFuture<void> createTextureInLoadThread(
                 gltf,
                 *pMaterial->pbrMetallicRoughness->metallicRoughnessTexture,
                 false,
-                imageNeedsMipmaps));
+                imageNeedsMipmaps,
+                compression,
+                imageIsData,
+                streamMips));
           }
         }
 
@@ -104,21 +131,30 @@ SharedFuture<void> createTextureInLoadThread(
               gltf,
               *pMaterial->emissiveTexture,
               true,
-              imageNeedsMipmaps));
+              imageNeedsMipmaps,
+              compression,
+              imageIsData,
+              streamMips));
         if (pMaterial->normalTexture)
           futures.emplace_back(createTextureInLoadThread(
               asyncSystem,
               gltf,
               *pMaterial->normalTexture,
               false,
-              imageNeedsMipmaps));
+              imageNeedsMipmaps,
+              ECesiumTextureCompression::None,
+              imageIsData,
+              streamMips));
         if (pMaterial->occlusionTexture)
           futures.emplace_back(createTextureInLoadThread(
               asyncSystem,
               gltf,
               *pMaterial->occlusionTexture,
               false,
-              imageNeedsMipmaps));
+              imageNeedsMipmaps,
+              compression,
+              imageIsData,
+              streamMips));
 
         // Initialize water mask if needed.
         auto onlyWaterIt = primitive.extras.find("OnlyWater");
@@ -146,7 +182,10 @@ SharedFuture<void> createTextureInLoadThread(
                     gltf,
                     waterMaskInfo,
                     false,
-                    imageNeedsMipmaps));
+                    imageNeedsMipmaps,
+                    ECesiumTextureCompression::None,
+                    imageIsData,
+                    streamMips));
               }
             }
           }
@@ -225,12 +264,55 @@ bool doesTextureUseMipmaps(
   }
 }
 
+std::vector<bool> findDataImages(const CesiumGltf::Model& gltf) {
+  std::vector<bool> imageIsData(gltf.images.size(), false);
+  auto markTexture = [&gltf, &imageIsData](int32_t textureIndex) {
+    const CesiumGltf::Texture* pTexture =
+        CesiumGltf::Model::getSafe(&gltf.textures, textureIndex);
+    if (pTexture && pTexture->source >= 0 &&
+        pTexture->source < imageIsData.size()) {
+      imageIsData[pTexture->source] = true;
+    }
+  };
+
+  for (const CesiumGltf::Mesh& mesh : gltf.meshes) {
+    for (const CesiumGltf::MeshPrimitive& primitive : mesh.primitives) {
+      const CesiumGltf::ExtensionExtMeshFeatures* pMeshFeatures =
+          primitive.getExtension<CesiumGltf::ExtensionExtMeshFeatures>();
+      if (!pMeshFeatures) {
+        continue;
+      }
+      for (const CesiumGltf::FeatureId& featureId : pMeshFeatures->featureIds) {
+        if (featureId.texture) {
+          markTexture(featureId.texture->index);
+        }
+      }
+    }
+  }
+
+  const CesiumGltf::ExtensionModelExtStructuralMetadata* pMetadata =
+      gltf.getExtension<CesiumGltf::ExtensionModelExtStructuralMetadata>();
+  if (pMetadata) {
+    for (const CesiumGltf::PropertyTexture& propertyTexture :
+         pMetadata->propertyTextures) {
+      for (const auto& [name, property] : propertyTexture.properties) {
+        markTexture(property.index);
+      }
+    }
+  }
+
+  return imageIsData;
+}
+
 SharedFuture<void> createTextureInLoadThread(
     const AsyncSystem& asyncSystem,
     CesiumGltf::Model& gltf,
     CesiumGltf::TextureInfo& textureInfo,
     bool sRGB,
-    const std::vector<bool>& imageNeedsMipmaps) {
+    const std::vector<bool>& imageNeedsMipmaps,
+    ECesiumTextureCompression compression,
+    const std::vector<bool>& imageIsData,
+    bool streamMips) {
   CesiumGltf::Texture* pTexture =
       CesiumGltf::Model::getSafe(&gltf.textures, textureInfo.index);
   if (pTexture == nullptr)
@@ -244,13 +326,20 @@ SharedFuture<void> createTextureInLoadThread(
   check(pTexture->source >= 0 && pTexture->source < imageNeedsMipmaps.size());
   bool needsMips = imageNeedsMipmaps[pTexture->source];
 
+  if (pTexture->source < imageIsData.size() && imageIsData[pTexture->source]) {
+    compression = ECesiumTextureCompression::None;
+    streamMips = false;
+  }
+
   const ExtensionImageAssetUnreal& extension =
       ExtensionImageAssetUnreal::getOrCreate(
           asyncSystem,
           *pImage->pAsset,
           sRGB,
           needsMips,
-          std::nullopt);
+          std::nullopt,
+          compression,
+          streamMips);
 
   return extension.getFuture();
 }
@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "CesiumTextureCompression.h"
 #include <CesiumAsync/Future.h>
 
 namespace CesiumAsync {
@@ -18,8 +19,19 @@ public:
    * Creates all of the texture resources that are required by the given glTF,
    * and adds `ExtensionImageCesiumUnreal` to each. This is intended to be
    * called from a worker thread.
+   *
+   * The `compression` is applied to color, emissive, metallic-roughness, and
+   * occlusion textures. Normal maps, water masks, and images that are also used
+   * by feature ID or property textures are never compressed, because the
+   * error introduced by BC1 / BC3 compression is too visible in them.
+   *
+   * If `streamMips` is true, only the coarsest mips of each mipmapped image
+   * are uploaded at first, and the rest are streamed in as needed. Images
+   * used by feature ID or property textures are never streamed.
    */
   static CesiumAsync::Future<void> createInWorkerThread(
       const CesiumAsync::AsyncSystem& asyncSystem,
-      CesiumGltf::Model& model);
+      CesiumGltf::Model& model,
+      ECesiumTextureCompression compression,
+      bool streamMips);
 };
@@ -0,0 +1,46 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumGpuEviction.h"
+
+namespace CesiumGpuEviction {
+
+TArray<int32> chooseTilesToEvict(
+    TArrayView<const HiddenTile> hiddenTiles,
+    uint64 frame,
+    uint64 delayFrames,
+    int64 maximumBytes) {
+  TArray<int32> result;
+
+  int64 hiddenBytes = 0;
+  TArray<int32> candidates;
+  for (int32 i = 0; i < hiddenTiles.Num(); ++i) {
+    const HiddenTile& tile = hiddenTiles[i];
+    hiddenBytes += tile.gpuBytes;
+    if (frame - tile.lastVisibleFrame >= delayFrames) {
+      candidates.Add(i);
+    }
+  }
+
+  if (hiddenBytes <= maximumBytes) {
+    return result;
+  }
+
+  // Evict the tiles that have been hidden the longest first, as they're the
+  // least likely to be shown again soon.
+  candidates.StableSort([hiddenTiles](int32 lhs, int32 rhs) {
+    return hiddenTiles[lhs].lastVisibleFrame <
+           hiddenTiles[rhs].lastVisibleFrame;
+  });
+
+  for (int32 i : candidates) {
+    if (hiddenBytes <= maximumBytes) {
+      break;
+    }
+    hiddenBytes -= hiddenTiles[i].gpuBytes;
+    result.Add(i);
+  }
+
+  return result;
+}
+
+} // namespace CesiumGpuEviction
@@ -0,0 +1,52 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "HAL/Platform.h"
+
+/**
+ * Chooses which hidden tiles release their GPU vertex and index buffers when
+ * a tileset's EvictHiddenTileGpuResources is enabled.
+ */
+namespace CesiumGpuEviction {
+
+/**
+ * A hidden tile whose GPU buffers have not been evicted yet.
+ */
+struct HiddenTile {
+  /**
+   * The number of bytes of GPU memory that evicting the tile would release.
+   */
+  int64 gpuBytes;
+
+  /**
+   * The frame in which the tile was last visible.
+   */
+  uint64 lastVisibleFrame;
+};
+
+/**
+ * Chooses the hidden tiles to evict so that the GPU buffers of the remaining
+ * ones take at most `maximumBytes`. Nothing is evicted while the hidden tiles
+ * fit within that limit. Otherwise, tiles are evicted in order of the frame in
+ * which they were last visible, oldest first, skipping those hidden for fewer
+ * than `delayFrames` frames, until the rest fit.
+ *
+ * @param hiddenTiles The hidden tiles whose buffers are still on the GPU.
+ * @param frame The current frame.
+ * @param delayFrames The number of frames that a tile must be hidden for
+ * before it may be evicted.
+ * @param maximumBytes The number of bytes that hidden tiles may keep on the
+ * GPU.
+ * @return The indices in `hiddenTiles` of the tiles to evict, in the order
+ * they should be evicted.
+ */
+TArray<int32> chooseTilesToEvict(
+    TArrayView<const HiddenTile> hiddenTiles,
+    uint64 frame,
+    uint64 delayFrames,
+    int64 maximumBytes);
+
+} // namespace CesiumGpuEviction
@@ -2,6 +2,8 @@
 
 #include "CesiumLifetime.h"
 #include "CesiumRuntime.h"
+#include "CesiumRuntimeSettings.h"
+#include "CesiumStats.h"
 #if WITH_EDITOR
 #include "Editor.h"
 #include "Editor/EditorEngine.h"
@@ -9,12 +11,27 @@
 #endif
 #include "Engine/StaticMesh.h"
 #include "Engine/Texture2D.h"
+#include "HAL/PlatformTime.h"
 #include "PhysicsEngine/BodySetup.h"
+#include "RenderingThread.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "StaticMeshResources.h"
 #include "UObject/Object.h"
 #include <algorithm>
 
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Objects Pending Destruction"),
+    STAT_CesiumPendingDestructionCount,
+    STATGROUP_Cesium);
+DECLARE_FLOAT_ACCUMULATOR_STAT(
+    TEXT("Oldest Pending Destruction Age (s)"),
+    STAT_CesiumOldestPendingDestructionAge,
+    STATGROUP_Cesium);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Objects Destroyed"),
+    STAT_CesiumObjectsDestroyed,
+    STATGROUP_Cesium);
+
 /*static*/
 AmortizedDestructor CesiumLifetime::amortizedDestructor = AmortizedDestructor();
 
@@ -72,31 +89,37 @@ bool AmortizedDestructor::IsTickableInEditor() const { return true; }
 TStatId AmortizedDestructor::GetStatId() const { return TStatId(); }
 
 void AmortizedDestructor::destroy(UObject* pObject) {
-  if (!runDestruction(pObject)) {
-    addToPending(pObject);
-  }
-}
-
-bool AmortizedDestructor::runDestruction(UObject* pObject) const {
-  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::RunDestruction)
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::BeginDestruction)
 
   if (!pObject) {
-    return true;
+    return;
   }
 
   pObject->MarkAsGarbage();
 
   if (pObject->HasAnyFlags(RF_FinishDestroyed)) {
     // Already done being destroyed.
-    return true;
+    return;
   }
 
   if (!pObject->HasAnyFlags(RF_BeginDestroyed)) {
     pObject->ConditionalBeginDestroy();
   }
 
-  if (!pObject->HasAnyFlags(RF_FinishDestroyed) &&
-      pObject->IsReadyForFinishDestroy()) {
+  // Finishing the destruction is what actually frees the object's memory, and
+  // can be expensive, so it's done in Tick within the time budget.
+  addToPending(pObject);
+}
+
+bool AmortizedDestructor::runDestruction(UObject* pObject) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::RunDestruction)
+
+  if (!pObject || pObject->HasAnyFlags(RF_FinishDestroyed)) {
+    // Already done being destroyed.
+    return true;
+  }
+
+  if (pObject->IsReadyForFinishDestroy()) {
     // Don't actually call ConditionalFinishDestroy here, because if we do the
     // UE garbage collector will freak out that it's already been called. The
     // IsReadyForFinishDestroy call is important, though. In some objects,
@@ -109,19 +132,72 @@ bool AmortizedDestructor::runDestruction(UObject* pObject) const {
 }
 
 void AmortizedDestructor::addToPending(UObject* pObject) {
-  _pending.Add(pObject);
+  _pending.Add(PendingObject{pObject, FPlatformTime::Seconds()});
 }
 
 void AmortizedDestructor::processPending() {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::ProcessPendingDestruction)
+
+  const double startTime = FPlatformTime::Seconds();
+  const double budget =
+      double(GetDefault<UCesiumRuntimeSettings>()->TileDestructionTimeBudget) /
+      1000.0;
+
+  int32 destroyedCount = 0;
+  int32 i = 0;
+  for (; i < _pending.Num(); ++i) {
+    // Always process at least one object so that the backlog drains even when
+    // a single object takes longer than the whole budget.
+    if (budget > 0.0 && i > 0 &&
+        FPlatformTime::Seconds() - startTime >= budget) {
+      break;
+    }
+
+    PendingObject& pending = _pending[i];
+    if (runDestruction(pending.pObject.Get(true))) {
+      ++destroyedCount;
+    } else {
+      _nextPending.Add(MoveTemp(pending));
+    }
+  }
+
+  // Objects that weren't reached this frame are newer than any that were
+  // reached but weren't ready, so appending them preserves the FIFO order.
+  for (; i < _pending.Num(); ++i) {
+    _nextPending.Add(MoveTemp(_pending[i]));
+  }
+
   std::swap(_nextPending, _pending);
-  _pending.Empty();
+  _nextPending.Reset();
+
+  flushBatchedReleases();
+
+  INC_DWORD_STAT_BY(STAT_CesiumObjectsDestroyed, destroyedCount);
+  SET_DWORD_STAT(STAT_CesiumPendingDestructionCount, _pending.Num());
+  SET_FLOAT_STAT(
+      STAT_CesiumOldestPendingDestructionAge,
+      _pending.IsEmpty() ? 0.0 : startTime - _pending[0].enqueueTime);
+}
 
-  for (TWeakObjectPtr<UObject> pObject : _nextPending) {
-    destroy(pObject.Get(true));
+void AmortizedDestructor::flushBatchedReleases() {
+  if (_platformDataToDelete.IsEmpty()) {
+    return;
   }
+
+  // The textures' resources are released by render commands that were
+  // enqueued before this one, so their data is no longer in use by the time
+  // it runs. Deleting it all in one command avoids a command per texture.
+  ENQUEUE_RENDER_COMMAND(Cesium_DeleteTexturePlatformData)
+  ([platformData = MoveTemp(_platformDataToDelete)](
+       FRHICommandListImmediate& RHICmdList) {
+    for (FTexturePlatformData* pPlatformData : platformData) {
+      delete pPlatformData;
+    }
+  });
+  _platformDataToDelete.Reset();
 }
 
-void AmortizedDestructor::finalizeDestroy(UObject* pObject) const {
+void AmortizedDestructor::finalizeDestroy(UObject* pObject) {
   // The freeing/clearing/destroying done here is normally done in these
   // objects' FinishDestroy method, but unfortunately we can't call that
   // directly without confusing the garbage collector if and when it _does_
@@ -132,7 +208,9 @@ void AmortizedDestructor::finalizeDestroy(UObject* pObject) const {
     pTexture2D->ReleaseResource();
     FTexturePlatformData* pPlatformData = pTexture2D->GetPlatformData();
     pTexture2D->SetPlatformData(nullptr);
-    delete pPlatformData;
+    if (pPlatformData) {
+      _platformDataToDelete.Add(pPlatformData);
+    }
   }
 
   UStaticMesh* pMesh = Cast<UStaticMesh>(pObject);
@@ -8,6 +8,7 @@
 
 class UObject;
 class UTexture;
+struct FTexturePlatformData;
 
 class AmortizedDestructor : FTickableGameObject {
 public:
@@ -19,13 +20,24 @@ public:
   void destroy(UObject* pObject);
 
 private:
-  bool runDestruction(UObject* pObject) const;
+  struct PendingObject {
+    TWeakObjectPtr<UObject> pObject;
+    double enqueueTime;
+  };
+
+  bool runDestruction(UObject* pObject);
   void addToPending(UObject* pObject);
   void processPending();
-  void finalizeDestroy(UObject* pObject) const;
+  void finalizeDestroy(UObject* pObject);
+  void flushBatchedReleases();
+
+  // In the order the objects were destroyed, so the oldest is at the front.
+  TArray<PendingObject> _pending;
+  TArray<PendingObject> _nextPending;
 
-  TArray<TWeakObjectPtr<UObject>> _pending;
-  TArray<TWeakObjectPtr<UObject>> _nextPending;
+  // Texture data to delete on the render thread once it has released the
+  // textures' resources.
+  TArray<FTexturePlatformData*> _platformDataToDelete;
 };
 
 class CesiumLifetime {
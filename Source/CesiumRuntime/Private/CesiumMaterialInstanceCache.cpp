@@ -0,0 +1,245 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumMaterialInstanceCache.h"
+#include "CesiumLifetime.h"
+#include "CesiumPrimitive.h"
+#include "CesiumStats.h"
+#include "Components/StaticMeshComponent.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Templates/TypeHash.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Shared Material Instances"),
+    STAT_CesiumSharedMaterials,
+    STATGROUP_Cesium);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Shared Material Instances Reused"),
+    STAT_CesiumSharedMaterialHits,
+    STATGROUP_Cesium);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Shared Material Instances Copied"),
+    STAT_CesiumSharedMaterialCopies,
+    STATGROUP_Cesium);
+
+namespace {
+bool canShare(const UMaterialInstanceDynamic& material) {
+  // Cesium never sets these kinds of parameters, so rather than comparing
+  // them, instances that have them are simply not shared.
+  return material.Parent && material.FontParameterValues.IsEmpty() &&
+         material.RuntimeVirtualTextureParameterValues.IsEmpty();
+}
+
+template <typename TParameterValue>
+void hashParameterValues(uint32& hash, const TArray<TParameterValue>& values) {
+  for (const TParameterValue& value : values) {
+    hash = HashCombineFast(hash, GetTypeHash(value.ParameterInfo));
+    hash = HashCombineFast(hash, GetTypeHash(value.ParameterValue));
+  }
+}
+
+template <typename TParameterValue>
+bool parameterValuesEqual(
+    const TArray<TParameterValue>& lhs,
+    const TArray<TParameterValue>& rhs) {
+  if (lhs.Num() != rhs.Num()) {
+    return false;
+  }
+
+  // Cesium always sets parameters in the same order, so equivalent instances
+  // will have them in the same order, too.
+  for (int32 i = 0; i < lhs.Num(); ++i) {
+    if (!(lhs[i].ParameterInfo == rhs[i].ParameterInfo) ||
+        lhs[i].ParameterValue != rhs[i].ParameterValue) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+uint32 computeSignature(const UMaterialInstanceDynamic& material) {
+  uint32 hash = GetTypeHash(material.Parent.Get());
+  hashParameterValues(hash, material.ScalarParameterValues);
+  hashParameterValues(hash, material.VectorParameterValues);
+  hashParameterValues(hash, material.DoubleVectorParameterValues);
+  hashParameterValues(hash, material.TextureParameterValues);
+  return hash;
+}
+
+bool isEquivalent(
+    const UMaterialInstanceDynamic& lhs,
+    const UMaterialInstanceDynamic& rhs) {
+  return lhs.Parent == rhs.Parent &&
+         parameterValuesEqual(
+             lhs.ScalarParameterValues,
+             rhs.ScalarParameterValues) &&
+         parameterValuesEqual(
+             lhs.VectorParameterValues,
+             rhs.VectorParameterValues) &&
+         parameterValuesEqual(
+             lhs.DoubleVectorParameterValues,
+             rhs.DoubleVectorParameterValues) &&
+         parameterValuesEqual(
+             lhs.TextureParameterValues,
+             rhs.TextureParameterValues);
+}
+} // namespace
+
+CesiumMaterialInstanceCache::CesiumMaterialInstanceCache()
+    : _entriesBySignature(), _signatureByMaterial(), _spares() {}
+
+CesiumMaterialInstanceCache::~CesiumMaterialInstanceCache() {
+  // The instances are left to the garbage collector, because this may be
+  // called while it is running.
+  DEC_DWORD_STAT_BY(STAT_CesiumSharedMaterials, this->getSharedMaterialCount());
+}
+
+UMaterialInstanceDynamic*
+CesiumMaterialInstanceCache::acquireSpare(UMaterialInterface* pParent) {
+  TObjectPtr<UMaterialInstanceDynamic> pSpare;
+  if (!this->_spares.RemoveAndCopyValue(pParent, pSpare)) {
+    return nullptr;
+  }
+
+  pSpare->ClearParameterValues();
+  return pSpare;
+}
+
+UMaterialInstanceDynamic*
+CesiumMaterialInstanceCache::share(UMaterialInstanceDynamic* pCandidate) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::ShareMaterialInstance)
+
+  if (!pCandidate || !canShare(*pCandidate)) {
+    return nullptr;
+  }
+
+  const uint32 signature = computeSignature(*pCandidate);
+  TArray<Entry>& entries = this->_entriesBySignature.FindOrAdd(signature);
+  for (Entry& entry : entries) {
+    if (isEquivalent(*entry.pMaterial, *pCandidate)) {
+      ++entry.users;
+      INC_DWORD_STAT(STAT_CesiumSharedMaterialHits);
+      this->keepSpare(pCandidate);
+      return entry.pMaterial;
+    }
+  }
+
+  entries.Add(Entry{pCandidate, 1});
+  this->_signatureByMaterial.Add(pCandidate, signature);
+  INC_DWORD_STAT(STAT_CesiumSharedMaterials);
+  return pCandidate;
+}
+
+/*static*/ bool CesiumMaterialInstanceCache::releaseSharedMaterial(
+    UStaticMeshComponent& component,
+    UMaterialInstanceDynamic* pMaterial) {
+  ICesiumPrimitive* pPrimitive = Cast<ICesiumPrimitive>(&component);
+  if (!pPrimitive) {
+    return false;
+  }
+
+  TSharedPtr<CesiumMaterialInstanceCache> pCache =
+      MoveTemp(pPrimitive->getPrimitiveData().pSharedMaterialCache);
+  if (!pCache) {
+    return false;
+  }
+
+  if (pMaterial && pCache->removeUser(pMaterial)) {
+    CesiumLifetime::destroy(pMaterial);
+  }
+
+  return true;
+}
+
+/*static*/ UMaterialInstanceDynamic*
+CesiumMaterialInstanceCache::makeMaterialUnique(
+    UStaticMeshComponent& component,
+    UMaterialInstanceDynamic* pMaterial) {
+  ICesiumPrimitive* pPrimitive = Cast<ICesiumPrimitive>(&component);
+  if (!pPrimitive || !pMaterial) {
+    return pMaterial;
+  }
+
+  TSharedPtr<CesiumMaterialInstanceCache> pCache =
+      MoveTemp(pPrimitive->getPrimitiveData().pSharedMaterialCache);
+  if (!pCache || pCache->removeUser(pMaterial)) {
+    // Nobody else uses this instance, so the primitive can have it.
+    return pMaterial;
+  }
+
+  UMaterialInstanceDynamic* pCopy = pCache->acquireSpare(pMaterial->Parent);
+  if (!pCopy) {
+    pCopy = UMaterialInstanceDynamic::Create(pMaterial->Parent, nullptr);
+  }
+  pCopy->SetFlags(
+      RF_Transient | RF_DuplicateTransient | RF_TextExportTransient);
+  pCopy->CopyParameterOverrides(pMaterial);
+  pCopy->TwoSided = true;
+
+  // The shared instance stays in the static mesh's material slot, but the
+  // override takes precedence.
+  component.SetMaterial(0, pCopy);
+
+  INC_DWORD_STAT(STAT_CesiumSharedMaterialCopies);
+  return pCopy;
+}
+
+void CesiumMaterialInstanceCache::AddReferencedObjects(
+    FReferenceCollector& Collector) {
+  for (auto& pair : this->_entriesBySignature) {
+    for (Entry& entry : pair.Value) {
+      Collector.AddReferencedObject(entry.pMaterial);
+    }
+  }
+  for (auto& pair : this->_spares) {
+    Collector.AddReferencedObject(pair.Value);
+  }
+}
+
+FString CesiumMaterialInstanceCache::GetReferencerName() const {
+  return TEXT("CesiumMaterialInstanceCache");
+}
+
+bool CesiumMaterialInstanceCache::removeUser(
+    UMaterialInstanceDynamic* pMaterial) {
+  const uint32* pSignature = this->_signatureByMaterial.Find(pMaterial);
+  if (!pSignature) {
+    return true;
+  }
+
+  const uint32 signature = *pSignature;
+  TArray<Entry>* pEntries = this->_entriesBySignature.Find(signature);
+  const int32 index = pEntries ? pEntries->IndexOfByPredicate(
+                                     [pMaterial](const Entry& entry) {
+                                       return entry.pMaterial == pMaterial;
+                                     })
+                               : INDEX_NONE;
+  if (index == INDEX_NONE) {
+    this->_signatureByMaterial.Remove(pMaterial);
+    return true;
+  }
+
+  Entry& entry = (*pEntries)[index];
+  if (--entry.users > 0) {
+    return false;
+  }
+
+  pEntries->RemoveAtSwap(index, 1, EAllowShrinking::No);
+  if (pEntries->IsEmpty()) {
+    this->_entriesBySignature.Remove(signature);
+  }
+  this->_signatureByMaterial.Remove(pMaterial);
+  DEC_DWORD_STAT(STAT_CesiumSharedMaterials);
+  return true;
+}
+
+void CesiumMaterialInstanceCache::keepSpare(
+    UMaterialInstanceDynamic* pMaterial) {
+  TObjectPtr<UMaterialInstanceDynamic>& pSpare =
+      this->_spares.FindOrAdd(pMaterial->Parent.Get());
+  if (pSpare) {
+    CesiumLifetime::destroy(pMaterial);
+  } else {
+    pSpare = pMaterial;
+  }
+}
@@ -0,0 +1,121 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "UObject/GCObject.h"
+#include "UObject/ObjectPtr.h"
+
+class UMaterialInstanceDynamic;
+class UMaterialInterface;
+class UStaticMeshComponent;
+
+/**
+ * @brief A per-tileset cache that allows primitives whose dynamic material
+ * instances have the same parent and the same parameter values to share a
+ * single instance.
+ *
+ * Each primitive that uses a shared instance holds a reference to the cache in
+ * its CesiumPrimitiveData. A shared instance must never be modified in place;
+ * code that needs to give a primitive its own parameter values, such as to
+ * attach a raster overlay tile or to fade the primitive in or out, must first
+ * call {@link makeMaterialUnique}.
+ *
+ * This class may only be used from the game thread.
+ */
+class CesiumMaterialInstanceCache : public FGCObject {
+public:
+  CesiumMaterialInstanceCache();
+  ~CesiumMaterialInstanceCache();
+
+  /**
+   * @brief Gets a spare material instance with the given parent, with all of
+   * its parameter values cleared. Spares are candidates that were found to
+   * duplicate an existing shared instance.
+   *
+   * @return The material instance, or nullptr if none is available.
+   */
+  UMaterialInstanceDynamic* acquireSpare(UMaterialInterface* pParent);
+
+  /**
+   * @brief Finds a shared material instance with the same parent and
+   * parameter values as the given candidate, or adds the candidate to this
+   * cache if there is none. Either way, the caller holds one reference to the
+   * returned instance, which must later be released with
+   * {@link releaseSharedMaterial}.
+   *
+   * If an equivalent instance is found, the candidate is kept as a spare and
+   * must no longer be used by the caller.
+   *
+   * @param pCandidate The fully-configured material instance of a primitive.
+   * @return The shared material instance, or nullptr if the candidate has
+   * parameters that can't be compared, in which case it isn't shared.
+   */
+  UMaterialInstanceDynamic* share(UMaterialInstanceDynamic* pCandidate);
+
+  /**
+   * @brief Gets the number of distinct shared material instances.
+   */
+  int32 getSharedMaterialCount() const {
+    return this->_signatureByMaterial.Num();
+  }
+
+  /**
+   * @brief Releases a primitive's reference to its material instance, if that
+   * instance is shared. The instance is destroyed once no primitive refers to
+   * it. The component's material slots are left as they are.
+   *
+   * @param component The primitive's component.
+   * @param pMaterial The primitive's material instance.
+   * @return true if the material was shared, in which case the caller must not
+   * destroy it; false if it is owned by the primitive.
+   */
+  static bool releaseSharedMaterial(
+      UStaticMeshComponent& component,
+      UMaterialInstanceDynamic* pMaterial);
+
+  /**
+   * @brief Ensures that a primitive's material instance isn't shared with any
+   * other primitive, so that its parameters can be modified.
+   *
+   * If the primitive is the last user of a shared instance, the instance is
+   * simply handed over to it. Otherwise, a copy with the same parent and
+   * parameter values is created and assigned to the component.
+   *
+   * @param component The primitive's component.
+   * @param pMaterial The primitive's current material instance.
+   * @return The material instance that the primitive now owns.
+   */
+  static UMaterialInstanceDynamic* makeMaterialUnique(
+      UStaticMeshComponent& component,
+      UMaterialInstanceDynamic* pMaterial);
+
+  // FGCObject overrides
+  virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+  virtual FString GetReferencerName() const override;
+
+private:
+  struct Entry {
+    TObjectPtr<UMaterialInstanceDynamic> pMaterial;
+    int32 users;
+  };
+
+  /**
+   * Removes one user of a shared instance. Returns true if that was the last
+   * user, in which case the instance has been removed from the cache but not
+   * destroyed.
+   */
+  bool removeUser(UMaterialInstanceDynamic* pMaterial);
+
+  void keepSpare(UMaterialInstanceDynamic* pMaterial);
+
+  // Instances whose parent and parameter values hash to the same signature.
+  TMap<uint32, TArray<Entry>> _entriesBySignature;
+
+  // The signature of each shared instance, used to find its entry.
+  TMap<UMaterialInstanceDynamic*, uint32> _signatureByMaterial;
+
+  // At most one spare instance per parent material.
+  TMap<UMaterialInterface*, TObjectPtr<UMaterialInstanceDynamic>> _spares;
+};
@@ -95,32 +95,21 @@ bool UCesiumMetadataPickingBlueprintLibrary::FindUVFromHit(
 
   const CesiumPrimitiveData& primData = pGltfComponent->getPrimitiveData();
 
-  if (primData.PositionAccessor.status() !=
-      CesiumGltf::AccessorViewStatus::Valid) {
+  if (primData.getVertexCount() == 0) {
     return false;
   }
 
-  auto accessorIt = primData.TexCoordAccessorMap.find(GltfTexCoordSetIndex);
-  if (accessorIt == primData.TexCoordAccessorMap.end()) {
-    return false;
-  }
-
-  auto VertexIndices = std::visit(
-      CesiumGltf::IndicesForFaceFromAccessor{
-          Hit.FaceIndex,
-          primData.PositionAccessor.size(),
-          primData.pMeshPrimitive->mode},
-      primData.IndexAccessor);
+  std::array<int64, 3> VertexIndices =
+      primData.getFaceVertexIndices(Hit.FaceIndex);
 
   // Adapted from UBodySetup::CalcUVAtLocation. Compute the barycentric
   // coordinates of the point relative to the face, then use those to
   // interpolate the UVs.
   std::array<FVector2D, 3> UVs;
-  const CesiumGltf::TexCoordAccessorType& accessor = accessorIt->second;
   for (size_t i = 0; i < UVs.size(); i++) {
-    auto maybeTexCoord = std::visit(
-        CesiumGltf::TexCoordFromAccessor{VertexIndices[i]},
-        accessor);
+    std::optional<glm::dvec2> maybeTexCoord = primData.getVertexTexCoord(
+        int32_t(GltfTexCoordSetIndex),
+        VertexIndices[i]);
     if (!maybeTexCoord) {
       return false;
     }
@@ -130,7 +119,12 @@ bool UCesiumMetadataPickingBlueprintLibrary::FindUVFromHit(
 
   std::array<FVector, 3> Positions;
   for (size_t i = 0; i < Positions.size(); i++) {
-    auto& Position = primData.PositionAccessor[VertexIndices[i]];
+    std::optional<FVector3f> maybePosition =
+        primData.getVertexPosition(VertexIndices[i]);
+    if (!maybePosition) {
+      return false;
+    }
+    const FVector3f& Position = *maybePosition;
     // The Y-component of glTF positions must be inverted, and the positions
     // must be scaled to match the UE meshes.
     Positions[i] = FVector(Position[0], -Position[1], Position[2]) *
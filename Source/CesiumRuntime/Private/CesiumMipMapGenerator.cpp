@@ -0,0 +1,553 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumMipMapGenerator.h"
+#include "Math/UnrealMathUtility.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <CesiumGltfReader/GltfReader.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS_NEON
+#include <arm_neon.h>
+#define CESIUM_MIPMAP_NEON 1
+#elif PLATFORM_ENABLE_VECTORINTRINSICS && PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define CESIUM_MIPMAP_SSE2 1
+#endif
+
+#if CESIUM_MIPMAP_NEON || CESIUM_MIPMAP_SSE2
+#define CESIUM_MIPMAP_SIMD 1
+#endif
+
+using namespace CesiumGltf;
+
+namespace {
+
+constexpr int32 MaximumChannels = 4;
+
+// Lookup tables for converting between 8-bit sRGB and 16-bit linear values.
+struct SrgbTables {
+  uint16 toLinear[256];
+  uint8 toSrgb[65536];
+};
+
+const SrgbTables& getSrgbTables() {
+  static const SrgbTables tables = []() {
+    SrgbTables result;
+    for (int32 i = 0; i < 256; ++i) {
+      const double srgb = i / 255.0;
+      const double linear = srgb <= 0.04045
+                                ? srgb / 12.92
+                                : std::pow((srgb + 0.055) / 1.055, 2.4);
+      result.toLinear[i] = uint16(std::lround(linear * 65535.0));
+    }
+    for (int32 i = 0; i < 65536; ++i) {
+      const double linear = i / 65535.0;
+      const double srgb = linear <= 0.0031308
+                              ? linear * 12.92
+                              : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+      result.toSrgb[i] = uint8(std::lround(srgb * 255.0));
+    }
+    return result;
+  }();
+  return tables;
+}
+
+// Determines which channels hold sRGB-encoded color. The last channel of two-
+// and four-channel images is alpha, which is always linear.
+void getColorChannels(int32 channels, bool sRGB, bool* pIsColor) {
+  const bool hasAlpha = channels == 2 || channels == 4;
+  for (int32 c = 0; c < channels; ++c) {
+    pIsColor[c] = sRGB && !(hasAlpha && c == channels - 1);
+  }
+}
+
+// Downsamples as many pixels of a row as possible with SIMD instructions, and
+// returns the number of destination pixels written. The source row must have
+// an even width.
+template <int32 Channels>
+int32 downsampleRowSimd(
+    const uint8* pRowA,
+    const uint8* pRowB,
+    int32 width,
+    uint8* pOut) {
+  int32 x = 0;
+#if CESIUM_MIPMAP_SSE2
+  // Each iteration reads 16 bytes from each row and writes 8.
+  constexpr int32 PixelsPerIteration = 8 / Channels;
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i ones = _mm_set1_epi16(1);
+  const __m128i two = _mm_set1_epi16(2);
+  for (; x + PixelsPerIteration <= width; x += PixelsPerIteration) {
+    const __m128i a = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(pRowA + 2 * x * Channels));
+    const __m128i b = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(pRowB + 2 * x * Channels));
+
+    // Sum the two rows in 16-bit lanes.
+    __m128i lo =
+        _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+    __m128i hi =
+        _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+
+    // Sum horizontally adjacent pixels.
+    __m128i sum;
+    if constexpr (Channels == 4) {
+      lo = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+      hi = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+      sum = _mm_unpacklo_epi64(lo, hi);
+    } else {
+      if constexpr (Channels == 2) {
+        // Reorder R0 G0 R1 G1 to R0 R1 G0 G1 so that adjacent lanes are pairs.
+        constexpr int32 Order = _MM_SHUFFLE(3, 1, 2, 0);
+        lo = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lo, Order), Order);
+        hi = _mm_shufflehi_epi16(_mm_shufflelo_epi16(hi, Order), Order);
+      }
+      sum = _mm_packs_epi32(_mm_madd_epi16(lo, ones), _mm_madd_epi16(hi, ones));
+    }
+
+    sum = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+    _mm_storel_epi64(
+        reinterpret_cast<__m128i*>(pOut + x * Channels),
+        _mm_packus_epi16(sum, sum));
+  }
+#elif CESIUM_MIPMAP_NEON
+  // Each iteration reads 16 pixels from each row and writes 8.
+  for (; x + 8 <= width; x += 8) {
+    const uint8* pA = pRowA + 2 * x * Channels;
+    const uint8* pB = pRowB + 2 * x * Channels;
+    uint8* pDestination = pOut + x * Channels;
+    if constexpr (Channels == 1) {
+      const uint16x8_t sum =
+          vaddq_u16(vpaddlq_u8(vld1q_u8(pA)), vpaddlq_u8(vld1q_u8(pB)));
+      vst1_u8(pDestination, vrshrn_n_u16(sum, 2));
+    } else if constexpr (Channels == 2) {
+      const uint8x16x2_t a = vld2q_u8(pA);
+      const uint8x16x2_t b = vld2q_u8(pB);
+      uint8x8x2_t result;
+      for (int32 c = 0; c < 2; ++c) {
+        result.val[c] = vrshrn_n_u16(
+            vaddq_u16(vpaddlq_u8(a.val[c]), vpaddlq_u8(b.val[c])),
+            2);
+      }
+      vst2_u8(pDestination, result);
+    } else {
+      const uint8x16x4_t a = vld4q_u8(pA);
+      const uint8x16x4_t b = vld4q_u8(pB);
+      uint8x8x4_t result;
+      for (int32 c = 0; c < 4; ++c) {
+        result.val[c] = vrshrn_n_u16(
+            vaddq_u16(vpaddlq_u8(a.val[c]), vpaddlq_u8(b.val[c])),
+            2);
+      }
+      vst4_u8(pDestination, result);
+    }
+  }
+#endif
+  return x;
+}
+
+// Averages 2x2 blocks of a row pair as-is. A source width of one is treated as
+// if the single column were repeated.
+void downsampleRowLinear(
+    const uint8* pRowA,
+    const uint8* pRowB,
+    int32 sourceWidth,
+    int32 channels,
+    uint8* pOut) {
+  const int32 width = FMath::Max(sourceWidth >> 1, 1);
+  int32 x = 0;
+  if (sourceWidth > 1) {
+    switch (channels) {
+    case 1:
+      x = downsampleRowSimd<1>(pRowA, pRowB, width, pOut);
+      break;
+    case 2:
+      x = downsampleRowSimd<2>(pRowA, pRowB, width, pOut);
+      break;
+    case 4:
+      x = downsampleRowSimd<4>(pRowA, pRowB, width, pOut);
+      break;
+    default:
+      break;
+    }
+  }
+
+  const int32 nextPixel = sourceWidth > 1 ? channels : 0;
+  for (; x < width; ++x) {
+    const uint8* pA = pRowA + 2 * x * channels;
+    const uint8* pB = pRowB + 2 * x * channels;
+    for (int32 c = 0; c < channels; ++c) {
+      const int32 sum =
+          pA[c] + pA[c + nextPixel] + pB[c] + pB[c + nextPixel] + 2;
+      pOut[x * channels + c] = uint8(sum >> 2);
+    }
+  }
+}
+
+// Converts a row to 16-bit linear values. Color channels are looked up in the
+// sRGB table, and other channels are kept as they are.
+template <int32 Channels>
+void decodeRowSrgb(
+    const uint8* pRow,
+    int32 width,
+    const bool* pIsColor,
+    uint16* pOut) {
+  const SrgbTables& tables = getSrgbTables();
+  for (int32 x = 0; x < width; ++x) {
+    for (int32 c = 0; c < Channels; ++c) {
+      const uint8 value = pRow[x * Channels + c];
+      pOut[x * Channels + c] = pIsColor[c] ? tables.toLinear[value] : value;
+    }
+  }
+}
+
+// Downsamples as many pixels of an sRGB row as possible with SIMD
+// instructions, and returns the number of destination pixels written. The
+// rows are decoded to linear values in the scratch buffer, which must have
+// room for both of them. The table lookups are scalar, but the averages are
+// computed four destination values at a time. The source row must have an
+// even width.
+template <int32 Channels>
+int32 downsampleRowSrgbSimd(
+    const uint8* pRowA,
+    const uint8* pRowB,
+    int32 width,
+    const bool* pIsColor,
+    uint16* pScratch,
+    uint8* pOut) {
+  int32 i = 0;
+#if CESIUM_MIPMAP_SIMD
+  const SrgbTables& tables = getSrgbTables();
+  const int32 count = width * Channels;
+  uint16* pLinearA = pScratch;
+  uint16* pLinearB = pScratch + 2 * count;
+  decodeRowSrgb<Channels>(pRowA, 2 * width, pIsColor, pLinearA);
+  decodeRowSrgb<Channels>(pRowB, 2 * width, pIsColor, pLinearB);
+
+  // Each iteration reads eight values from each row and writes four. The
+  // sums need more than 16 bits, so they are computed in 32-bit lanes.
+  for (; i + 4 <= count; i += 4) {
+    alignas(16) uint32 averages[4];
+#if CESIUM_MIPMAP_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i a =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(pLinearA + 2 * i));
+    const __m128i b =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(pLinearB + 2 * i));
+    const __m128i lo = _mm_add_epi32(
+        _mm_unpacklo_epi16(a, zero),
+        _mm_unpacklo_epi16(b, zero));
+    const __m128i hi = _mm_add_epi32(
+        _mm_unpackhi_epi16(a, zero),
+        _mm_unpackhi_epi16(b, zero));
+
+    // Split the values into the left and right pixels of each block.
+    __m128i left;
+    __m128i right;
+    if constexpr (Channels == 4) {
+      left = lo;
+      right = hi;
+    } else if constexpr (Channels == 2) {
+      left = _mm_unpacklo_epi64(lo, hi);
+      right = _mm_unpackhi_epi64(lo, hi);
+    } else {
+      const __m128 loFloats = _mm_castsi128_ps(lo);
+      const __m128 hiFloats = _mm_castsi128_ps(hi);
+      left = _mm_castps_si128(
+          _mm_shuffle_ps(loFloats, hiFloats, _MM_SHUFFLE(2, 0, 2, 0)));
+      right = _mm_castps_si128(
+          _mm_shuffle_ps(loFloats, hiFloats, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+
+    const __m128i sum =
+        _mm_add_epi32(_mm_add_epi32(left, right), _mm_set1_epi32(2));
+    _mm_store_si128(
+        reinterpret_cast<__m128i*>(averages),
+        _mm_srli_epi32(sum, 2));
+#elif CESIUM_MIPMAP_NEON
+    const uint16x8_t a = vld1q_u16(pLinearA + 2 * i);
+    const uint16x8_t b = vld1q_u16(pLinearB + 2 * i);
+    const uint32x4_t lo = vaddl_u16(vget_low_u16(a), vget_low_u16(b));
+    const uint32x4_t hi = vaddl_u16(vget_high_u16(a), vget_high_u16(b));
+
+    // Split the values into the left and right pixels of each block.
+    uint32x4_t left;
+    uint32x4_t right;
+    if constexpr (Channels == 4) {
+      left = lo;
+      right = hi;
+    } else if constexpr (Channels == 2) {
+      left = vcombine_u32(vget_low_u32(lo), vget_low_u32(hi));
+      right = vcombine_u32(vget_high_u32(lo), vget_high_u32(hi));
+    } else {
+      const uint32x4x2_t pairs = vuzpq_u32(lo, hi);
+      left = pairs.val[0];
+      right = pairs.val[1];
+    }
+
+    vst1q_u32(averages, vrshrq_n_u32(vaddq_u32(left, right), 2));
+#endif
+
+    // Four values are a whole number of pixels, so the channel of each value
+    // only depends on its position in the group.
+    for (int32 k = 0; k < 4; ++k) {
+      pOut[i + k] = pIsColor[k % Channels] ? tables.toSrgb[averages[k]]
+                                           : uint8(averages[k]);
+    }
+  }
+#endif
+  return i / Channels;
+}
+
+// Averages 2x2 blocks of a row pair, converting color channels to linear space
+// and back. If a scratch buffer is given, as much of the row as possible is
+// averaged with SIMD instructions.
+void downsampleRowSrgb(
+    const uint8* pRowA,
+    const uint8* pRowB,
+    int32 sourceWidth,
+    int32 channels,
+    const bool* pIsColor,
+    uint16* pScratch,
+    uint8* pOut) {
+  const SrgbTables& tables = getSrgbTables();
+  const int32 width = FMath::Max(sourceWidth >> 1, 1);
+  int32 x = 0;
+  if (sourceWidth > 1 && pScratch) {
+    switch (channels) {
+    case 1:
+      x = downsampleRowSrgbSimd<1>(
+          pRowA,
+          pRowB,
+          width,
+          pIsColor,
+          pScratch,
+          pOut);
+      break;
+    case 2:
+      x = downsampleRowSrgbSimd<2>(
+          pRowA,
+          pRowB,
+          width,
+          pIsColor,
+          pScratch,
+          pOut);
+      break;
+    case 4:
+      x = downsampleRowSrgbSimd<4>(
+          pRowA,
+          pRowB,
+          width,
+          pIsColor,
+          pScratch,
+          pOut);
+      break;
+    default:
+      break;
+    }
+  }
+
+  const int32 nextPixel = sourceWidth > 1 ? channels : 0;
+  for (; x < width; ++x) {
+    const uint8* pA = pRowA + 2 * x * channels;
+    const uint8* pB = pRowB + 2 * x * channels;
+    for (int32 c = 0; c < channels; ++c) {
+      if (pIsColor[c]) {
+        const uint32 sum = uint32(tables.toLinear[pA[c]]) +
+                           tables.toLinear[pA[c + nextPixel]] +
+                           tables.toLinear[pB[c]] +
+                           tables.toLinear[pB[c + nextPixel]] + 2;
+        pOut[x * channels + c] = tables.toSrgb[sum >> 2];
+      } else {
+        const int32 sum =
+            pA[c] + pA[c + nextPixel] + pB[c] + pB[c + nextPixel] + 2;
+        pOut[x * channels + c] = uint8(sum >> 2);
+      }
+    }
+  }
+}
+
+// Downsamples by averaging the source pixels under each destination pixel,
+// weighted by how much of each is covered. This handles odd sizes, where the
+// footprint of a destination pixel is not a whole number of source pixels.
+// Such images are rare, since only the levels of non-power-of-two images can
+// have odd sizes, so this is not vectorized.
+void downsampleArea(
+    const uint8* pSource,
+    int32 sourceWidth,
+    int32 sourceHeight,
+    int32 channels,
+    const bool* pIsColor,
+    uint8* pDestination) {
+  const SrgbTables& tables = getSrgbTables();
+  const int32 width = FMath::Max(sourceWidth >> 1, 1);
+  const int32 height = FMath::Max(sourceHeight >> 1, 1);
+  const double scaleX = double(sourceWidth) / width;
+  const double scaleY = double(sourceHeight) / height;
+
+  for (int32 y = 0; y < height; ++y) {
+    const double y0 = y * scaleY;
+    const double y1 = (y + 1) * scaleY;
+    for (int32 x = 0; x < width; ++x) {
+      const double x0 = x * scaleX;
+      const double x1 = (x + 1) * scaleX;
+
+      double sums[MaximumChannels] = {};
+      double totalWeight = 0.0;
+      for (int32 sy = int32(y0); sy < sourceHeight && sy < y1; ++sy) {
+        const double top = double(sy);
+        const double weightY = FMath::Min(y1, top + 1.0) - FMath::Max(y0, top);
+        for (int32 sx = int32(x0); sx < sourceWidth && sx < x1; ++sx) {
+          const double left = double(sx);
+          const double weight =
+              weightY * (FMath::Min(x1, left + 1.0) - FMath::Max(x0, left));
+          const uint8* pPixel =
+              pSource + (size_t(sy) * sourceWidth + sx) * channels;
+          for (int32 c = 0; c < channels; ++c) {
+            sums[c] +=
+                weight * (pIsColor[c] ? tables.toLinear[pPixel[c]] : pPixel[c]);
+          }
+          totalWeight += weight;
+        }
+      }
+
+      uint8* pOut = pDestination + (size_t(y) * width + x) * channels;
+      for (int32 c = 0; c < channels; ++c) {
+        const int32 average = int32(std::lround(sums[c] / totalWeight));
+        if (pIsColor[c]) {
+          pOut[c] = tables.toSrgb[FMath::Clamp(average, 0, 65535)];
+        } else {
+          pOut[c] = uint8(FMath::Clamp(average, 0, 255));
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+namespace CesiumMipMapGenerator {
+
+int32 computeMipCount(int32 width, int32 height) {
+  int32 count = 1;
+  while (width > 1 || height > 1) {
+    width = FMath::Max(width >> 1, 1);
+    height = FMath::Max(height >> 1, 1);
+    ++count;
+  }
+  return count;
+}
+
+void downsample(
+    const uint8* pSource,
+    int32 width,
+    int32 height,
+    int32 channels,
+    bool sRGB,
+    uint8* pDestination) {
+  check(channels >= 1 && channels <= MaximumChannels);
+
+  bool isColor[MaximumChannels];
+  getColorChannels(channels, sRGB, isColor);
+
+  const bool evenWidth = width == 1 || width % 2 == 0;
+  const bool evenHeight = height == 1 || height % 2 == 0;
+  if (!evenWidth || !evenHeight) {
+    downsampleArea(pSource, width, height, channels, isColor, pDestination);
+    return;
+  }
+
+  const size_t sourceRowBytes = size_t(width) * channels;
+  const size_t rowBytes = size_t(FMath::Max(width >> 1, 1)) * channels;
+  const int32 newHeight = FMath::Max(height >> 1, 1);
+
+  // The linear values of both source rows, for the SIMD sRGB path.
+  std::vector<uint16> scratch;
+#if CESIUM_MIPMAP_SIMD
+  if (sRGB && channels != 3) {
+    scratch.resize(2 * sourceRowBytes);
+  }
+#endif
+
+  for (int32 y = 0; y < newHeight; ++y) {
+    const uint8* pRowA = pSource + size_t(2 * y) * sourceRowBytes;
+    const uint8* pRowB = height > 1 ? pRowA + sourceRowBytes : pRowA;
+    uint8* pOut = pDestination + size_t(y) * rowBytes;
+    if (sRGB) {
+      downsampleRowSrgb(
+          pRowA,
+          pRowB,
+          width,
+          channels,
+          isColor,
+          scratch.empty() ? nullptr : scratch.data(),
+          pOut);
+    } else {
+      downsampleRowLinear(pRowA, pRowB, width, channels, pOut);
+    }
+  }
+}
+
+std::optional<std::string> generateMipMaps(ImageAsset& image, bool sRGB) {
+  if (image.mipPositions.size() > 1 ||
+      (image.width == 1 && image.height == 1)) {
+    // The image already has mipmaps, or doesn't need any.
+    return std::nullopt;
+  }
+
+  if (image.compressedPixelFormat != GpuCompressedPixelFormat::NONE) {
+    return "Unable to generate mipmaps, an uncompressed image is required.";
+  }
+
+  if (image.bytesPerChannel != 1 || image.channels < 1 ||
+      image.channels > MaximumChannels) {
+    return CesiumGltfReader::ImageDecoder::generateMipMaps(image);
+  }
+
+  if (image.width <= 0 || image.height <= 0) {
+    return "Unable to generate mipmaps, the image has no pixels.";
+  }
+
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::GenerateMipMaps)
+
+  const int32 channels = image.channels;
+  const size_t sourceOffset =
+      image.mipPositions.empty() ? 0 : image.mipPositions[0].byteOffset;
+  const size_t baseSize = size_t(image.width) * image.height * channels;
+  if (sourceOffset + baseSize > image.pixelData.size()) {
+    return "Unable to generate mipmaps, the image's pixel data is too small.";
+  }
+
+  const int32 mipCount = computeMipCount(image.width, image.height);
+  std::vector<ImageAssetMipPosition> mipPositions(mipCount);
+  size_t totalSize = 0;
+  for (int32 level = 0; level < mipCount; ++level) {
+    const size_t size = size_t(FMath::Max(image.width >> level, 1)) *
+                        FMath::Max(image.height >> level, 1) * channels;
+    mipPositions[level] = ImageAssetMipPosition{totalSize, size};
+    totalSize += size;
+  }
+
+  std::vector<std::byte> pixelData(totalSize);
+  std::memcpy(pixelData.data(), &image.pixelData[sourceOffset], baseSize);
+
+  uint8* pData = reinterpret_cast<uint8*>(pixelData.data());
+  for (int32 level = 1; level < mipCount; ++level) {
+    downsample(
+        pData + mipPositions[level - 1].byteOffset,
+        FMath::Max(image.width >> (level - 1), 1),
+        FMath::Max(image.height >> (level - 1), 1),
+        channels,
+        sRGB,
+        pData + mipPositions[level].byteOffset);
+  }
+
+  image.pixelData = std::move(pixelData);
+  image.mipPositions = std::move(mipPositions);
+
+  return std::nullopt;
+}
+
+} // namespace CesiumMipMapGenerator
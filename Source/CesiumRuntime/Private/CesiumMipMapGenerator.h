@@ -0,0 +1,65 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "HAL/Platform.h"
+#include <CesiumGltf/ImageAsset.h>
+#include <optional>
+#include <string>
+
+/**
+ * Generates mip chains for decoded 8-bit images on the CPU. This is a faster,
+ * gamma-correct replacement for
+ * `CesiumGltfReader::ImageDecoder::generateMipMaps` for the image formats that
+ * Cesium for Unreal creates textures from.
+ *
+ * Each level is a 2x2 box filter of the previous one, computed with SSE2 or
+ * NEON where available. Levels with an odd width or height, which a 2x2 box
+ * can't cover exactly, are filtered by area instead.
+ */
+namespace CesiumMipMapGenerator {
+
+/**
+ * Computes the number of levels in a full mip chain for an image of the given
+ * size, including the image itself and ending with a 1x1 level.
+ */
+int32 computeMipCount(int32 width, int32 height);
+
+/**
+ * Downsamples one level of a mip chain to the next, which is half its width
+ * and height (rounded down, but at least one pixel).
+ *
+ * @param pSource The source pixels, tightly packed in row-major order.
+ * @param width The width of the source in pixels.
+ * @param height The height of the source in pixels.
+ * @param channels The number of 8-bit channels, from 1 to 4.
+ * @param sRGB Whether the color channels are sRGB-encoded, in which case they
+ * are averaged in linear space. The alpha channel of two- and four-channel
+ * images is always averaged as-is.
+ * @param pDestination The pixels of the next level.
+ */
+void downsample(
+    const uint8* pSource,
+    int32 width,
+    int32 height,
+    int32 channels,
+    bool sRGB,
+    uint8* pDestination);
+
+/**
+ * Generates a full mip chain for the image, writing all of the levels to a
+ * single new allocation and setting `mipPositions` to match.
+ *
+ * Like `CesiumGltfReader::ImageDecoder::generateMipMaps`, this does nothing if
+ * the image already has mipmaps or is 1x1, and fails for GPU-compressed
+ * images. Images with more than one byte per channel or more than four
+ * channels are handed to that function instead.
+ *
+ * @param image The image for which to generate mipmaps.
+ * @param sRGB Whether the color channels of the image are sRGB-encoded.
+ * @return An error message if the mipmaps could not be generated.
+ */
+std::optional<std::string>
+generateMipMaps(CesiumGltf::ImageAsset& image, bool sRGB);
+
+} // namespace CesiumMipMapGenerator
@@ -0,0 +1,198 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumNaniteBuilder.h"
+#include "CesiumCommon.h"
+#include "CesiumRuntime.h"
+#include "RHI.h"
+#include "RenderUtils.h"
+#include "StaticMeshResources.h"
+#include <atomic>
+
+#if WITH_EDITOR
+#include "Modules/ModuleManager.h"
+#include "NaniteBuilder.h"
+#include "Rendering/NaniteResources.h"
+#endif
+
+namespace CesiumNaniteBuilder {
+
+namespace {
+std::atomic<bool> naniteBuilderLoaded = false;
+} // namespace
+
+void initialize() {
+#if WITH_EDITOR
+  check(IsInGameThread());
+  if (naniteBuilderLoaded) {
+    return;
+  }
+
+  if (!DoesPlatformSupportNanite(GMaxRHIShaderPlatform)) {
+    UE_LOG(
+        LogCesium,
+        Warning,
+        TEXT(
+            "Nanite is not supported on the current platform, so tilesets will be rendered without Nanite."));
+    return;
+  }
+
+  naniteBuilderLoaded =
+      FModuleManager::Get().LoadModule(TEXT("NaniteBuilder")) != nullptr;
+#else
+  UE_LOG(
+      LogCesium,
+      Warning,
+      TEXT(
+          "Nanite resources can only be built for tilesets in the Editor, so tilesets will be rendered without Nanite."));
+#endif
+}
+
+bool isNaniteBuildAvailable() { return naniteBuilderLoaded; }
+
+bool createBuildInput(
+    const FStaticMeshLODResources& lod,
+    NaniteBuildInput& result) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CreateNaniteBuildInput)
+
+  const FPositionVertexBuffer& positionBuffer =
+      lod.VertexBuffers.PositionVertexBuffer;
+  const FStaticMeshVertexBuffer& vertexBuffer =
+      lod.VertexBuffers.StaticMeshVertexBuffer;
+  const FColorVertexBuffer& colorBuffer = lod.VertexBuffers.ColorVertexBuffer;
+
+  const uint32 numVertices = positionBuffer.GetNumVertices();
+  if (numVertices == 0 || vertexBuffer.GetNumVertices() != numVertices ||
+      lod.Sections.Num() == 0) {
+    return false;
+  }
+
+  lod.IndexBuffer.GetCopy(result.indices);
+  if (result.indices.Num() == 0 || result.indices.Num() % 3 != 0) {
+    return false;
+  }
+
+  for (uint32 index : result.indices) {
+    if (index >= numVertices) {
+      return false;
+    }
+  }
+
+  const uint32 numTexCoords = vertexBuffer.GetNumTexCoords();
+  const bool hasColors = colorBuffer.GetNumVertices() == numVertices;
+
+  result.positions.SetNumUninitialized(numVertices);
+  result.tangentX.SetNumUninitialized(numVertices);
+  result.tangentY.SetNumUninitialized(numVertices);
+  result.tangentZ.SetNumUninitialized(numVertices);
+  result.texCoords.SetNum(numTexCoords);
+  for (TArray<FVector2f>& texCoords : result.texCoords) {
+    texCoords.SetNumUninitialized(numVertices);
+  }
+  if (hasColors) {
+    result.colors.SetNumUninitialized(numVertices);
+  } else {
+    result.colors.Empty();
+  }
+
+  for (uint32 i = 0; i < numVertices; ++i) {
+    result.positions[i] = positionBuffer.VertexPosition(i);
+    result.tangentX[i] = vertexBuffer.VertexTangentX(i);
+    result.tangentY[i] = vertexBuffer.VertexTangentY(i);
+    result.tangentZ[i] = vertexBuffer.VertexTangentZ(i);
+    for (uint32 uv = 0; uv < numTexCoords; ++uv) {
+      result.texCoords[uv][i] = vertexBuffer.GetVertexUV(i, uv);
+    }
+    if (hasColors) {
+      result.colors[i] = colorBuffer.VertexColor(i);
+    }
+  }
+
+  // Assign each triangle the material of the section that contains it.
+  const int32 numTriangles = result.indices.Num() / 3;
+  result.materialIndices.Init(0, numTriangles);
+  for (const FStaticMeshSection& section : lod.Sections) {
+    const int32 firstTriangle = int32(section.FirstIndex / 3);
+    const int32 lastTriangle =
+        FMath::Min(firstTriangle + int32(section.NumTriangles), numTriangles);
+    for (int32 triangle = firstTriangle; triangle < lastTriangle; ++triangle) {
+      result.materialIndices[triangle] = section.MaterialIndex;
+    }
+  }
+
+  return true;
+}
+
+bool buildNaniteResources(
+    NaniteBuildInput&& input,
+    FStaticMeshRenderData& renderData) {
+#if WITH_EDITOR
+  if (!isNaniteBuildAvailable() || renderData.LODResources.Num() == 0 ||
+      !renderData.NaniteResourcesPtr.IsValid()) {
+    return false;
+  }
+
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::BuildNaniteResources)
+
+  Nanite::IBuilderModule* pBuilder =
+      FModuleManager::GetModulePtr<Nanite::IBuilderModule>(
+          TEXT("NaniteBuilder"));
+  if (!pBuilder) {
+    return false;
+  }
+
+  Nanite::IBuilderModule::FInputMeshData inputMesh;
+  inputMesh.VertexBounds.Min = FVector3f(TNumericLimits<float>::Max());
+  inputMesh.VertexBounds.Max = FVector3f(TNumericLimits<float>::Lowest());
+  for (const FVector3f& position : input.positions) {
+    inputMesh.VertexBounds += position;
+  }
+
+  inputMesh.Vertices.Position = MoveTemp(input.positions);
+  inputMesh.Vertices.TangentX = MoveTemp(input.tangentX);
+  inputMesh.Vertices.TangentY = MoveTemp(input.tangentY);
+  inputMesh.Vertices.TangentZ = MoveTemp(input.tangentZ);
+  inputMesh.Vertices.UVs = MoveTemp(input.texCoords);
+  inputMesh.Vertices.Color = MoveTemp(input.colors);
+  inputMesh.NumTexCoords = uint32(inputMesh.Vertices.UVs.Num());
+  inputMesh.TriangleCounts.Add(uint32(input.indices.Num() / 3));
+  inputMesh.TriangleIndices = MoveTemp(input.indices);
+  inputMesh.MaterialIndices = MoveTemp(input.materialIndices);
+  inputMesh.Sections = renderData.LODResources[0].Sections;
+
+  FMeshNaniteSettings settings;
+  settings.bEnabled = true;
+
+  // The fallback mesh produced by the builder is discarded, because the
+  // existing LOD0 render data already serves that purpose.
+  Nanite::IBuilderModule::FOutputMeshData fallbackMesh;
+  Nanite::FResources resources;
+
+#if ENGINE_VERSION_5_5_OR_HIGHER
+  const bool built = pBuilder->Build(
+      resources,
+      inputMesh,
+      &fallbackMesh,
+      nullptr,
+      nullptr,
+      settings,
+      {});
+#else
+  const bool built = pBuilder->Build(
+      resources,
+      inputMesh,
+      MakeArrayView(&fallbackMesh, 1),
+      settings);
+#endif
+
+  if (!built || resources.PageStreamingStates.Num() == 0) {
+    return false;
+  }
+
+  *renderData.NaniteResourcesPtr = MoveTemp(resources);
+  return true;
+#else
+  return false;
+#endif
+}
+
+} // namespace CesiumNaniteBuilder
@@ -0,0 +1,96 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Math/Color.h"
+#include "Math/Vector.h"
+#include "Math/Vector2D.h"
+
+struct FStaticMeshLODResources;
+class FStaticMeshRenderData;
+
+/**
+ * Functions for building Nanite resources for the triangle meshes of glTF
+ * primitives. The mesh data is gathered from the classic LOD0 render data, so
+ * that the LOD0 data can continue to serve as the Nanite fallback mesh.
+ */
+namespace CesiumNaniteBuilder {
+
+/**
+ * The vertex and index data from which Nanite resources are built. This is a
+ * plain CPU copy of a single LOD of a static mesh.
+ */
+struct NaniteBuildInput {
+  TArray<FVector3f> positions;
+  TArray<FVector3f> tangentX;
+  TArray<FVector3f> tangentY;
+  TArray<FVector3f> tangentZ;
+
+  /**
+   * The texture coordinates, one array per texture coordinate channel. Each
+   * array has the same number of elements as `positions`.
+   */
+  TArray<TArray<FVector2f>> texCoords;
+
+  /**
+   * The vertex colors. This is empty if the mesh has no vertex colors.
+   */
+  TArray<FColor> colors;
+
+  /**
+   * The triangle list indices.
+   */
+  TArray<uint32> indices;
+
+  /**
+   * The material index of each triangle.
+   */
+  TArray<int32> materialIndices;
+};
+
+/**
+ * Loads the Nanite builder module. This must be called from the game thread
+ * before Nanite resources are built in worker threads.
+ */
+void initialize();
+
+/**
+ * Determines if Nanite resources can be built in this process. This requires
+ * Unreal's Nanite builder, which is only available in the Editor, as well as
+ * a shader platform that supports Nanite. It also requires that
+ * {@link initialize} has already been called. This function may be called
+ * from any thread.
+ */
+bool isNaniteBuildAvailable();
+
+/**
+ * Gathers the vertex and index data of a static mesh LOD into a
+ * {@link NaniteBuildInput}. The LOD's CPU-side buffers must still be
+ * accessible, i.e. its RHI resources must not have been initialized yet.
+ *
+ * @param lod The LOD resources, with a triangle list index buffer.
+ * @param result The build input to populate.
+ * @return True if the LOD contains a valid triangle list; false otherwise, in
+ * which case `result` is left in an unspecified state.
+ */
+bool createBuildInput(
+    const FStaticMeshLODResources& lod,
+    NaniteBuildInput& result);
+
+/**
+ * Builds Nanite resources from the given input and stores them in the render
+ * data. The render data's existing LOD resources are left unchanged so that
+ * they may be used as the fallback mesh. This may be called from any thread.
+ *
+ * @param input The mesh data from which to build the Nanite resources.
+ * @param renderData The render data to receive the Nanite resources.
+ * @return True if the Nanite resources were built. False if the Nanite builder
+ * is unavailable or the build failed, in which case the render data is left
+ * unchanged.
+ */
+bool buildNaniteResources(
+    NaniteBuildInput&& input,
+    FStaticMeshRenderData& renderData);
+
+} // namespace CesiumNaniteBuilder
@@ -34,17 +34,87 @@ FBufferRHIRef CreatePointAttenuationBuffer(
 }
 } // namespace
 
-void FCesiumPointAttenuationIndexBuffer::InitRHI(
-    FRHICommandListBase& RHICmdList) {
-  if (!bAttenuationSupported) {
+namespace {
+// The shared index buffers, keyed by point capacity. Only accessed from the
+// rendering thread.
+TMap<uint32, TUniquePtr<FCesiumPointAttenuationIndexBuffer>>
+    SharedAttenuationIndexBuffers;
+} // namespace
+
+/*static*/ uint32
+FCesiumPointAttenuationIndexBuffer::ComputePointCapacity(int32 NumPoints) {
+  if (NumPoints <= int32(MinimumPointCapacity)) {
+    return MinimumPointCapacity;
+  }
+
+  return FMath::Min(
+      FMath::RoundUpToPowerOfTwo(uint32(NumPoints)),
+      MaximumPointCapacity);
+}
+
+/*static*/ uint32 FCesiumPointAttenuationIndexBuffer::ChoosePointCapacity(
+    const TArray<uint32>& ExistingCapacities,
+    int32 NumPoints) {
+  uint32 Result = 0;
+  for (uint32 Capacity : ExistingCapacities) {
+    if (int64(Capacity) >= int64(NumPoints) &&
+        (Result == 0 || Capacity < Result)) {
+      Result = Capacity;
+    }
+  }
+
+  return Result != 0 ? Result : ComputePointCapacity(NumPoints);
+}
+
+/*static*/ uint64
+FCesiumPointAttenuationIndexBuffer::ComputeSizeInBytes(uint32 PointCapacity) {
+  return uint64(PointCapacity) * 6 * sizeof(uint32);
+}
+
+/*static*/ FCesiumPointAttenuationIndexBuffer*
+FCesiumPointAttenuationIndexBuffer::Acquire(
+    FRHICommandListBase& RHICmdList,
+    int32 NumPoints) {
+  check(IsInRenderingThread());
+
+  if (int64(NumPoints) > int64(MaximumPointCapacity)) {
+    return nullptr;
+  }
+
+  TArray<uint32> ExistingCapacities;
+  SharedAttenuationIndexBuffers.GenerateKeyArray(ExistingCapacities);
+  const uint32 Capacity = ChoosePointCapacity(ExistingCapacities, NumPoints);
+
+  TUniquePtr<FCesiumPointAttenuationIndexBuffer>& IndexBuffer =
+      SharedAttenuationIndexBuffers.FindOrAdd(Capacity);
+  if (!IndexBuffer) {
+    IndexBuffer = MakeUnique<FCesiumPointAttenuationIndexBuffer>(Capacity);
+    IndexBuffer->InitResource(RHICmdList);
+  }
+
+  ++IndexBuffer->NumUsers;
+  return IndexBuffer.Get();
+}
+
+/*static*/ void FCesiumPointAttenuationIndexBuffer::Release(
+    FCesiumPointAttenuationIndexBuffer* IndexBuffer) {
+  check(IsInRenderingThread());
+
+  if (!IndexBuffer || --IndexBuffer->NumUsers > 0) {
     return;
   }
 
+  IndexBuffer->ReleaseResource();
+  SharedAttenuationIndexBuffers.Remove(IndexBuffer->PointCapacity);
+}
+
+void FCesiumPointAttenuationIndexBuffer::InitRHI(
+    FRHICommandListBase& RHICmdList) {
   // This must be called from Rendering thread
   check(IsInRenderingThread());
 
-  const uint32 NumIndices = NumPoints * 6;
-  const uint32 Size = NumIndices * sizeof(uint32);
+  const uint32 NumIndices = PointCapacity * 6;
+  const uint32 Size = uint32(ComputeSizeInBytes(PointCapacity));
 
   IndexBufferRHI = CreatePointAttenuationBuffer(
       RHICmdList,
@@ -99,6 +169,11 @@ public:
       const FMeshBatchElement& BatchElement,
       FMeshDrawSingleShaderBindings& ShaderBindings,
       FVertexInputStreamArray& VertexStreams) const {
+    // When mesh draw commands are cached, these bindings are only gathered
+    // when the command is built. The user data of static meshes is owned by
+    // the scene proxy, and its buffers are the SRVs of the tile's static mesh,
+    // which live as long as the proxy. The proxy rebuilds its static meshes
+    // whenever the values in the user data change.
     FCesiumPointAttenuationBatchElementUserData* UserData =
         (FCesiumPointAttenuationBatchElementUserData*)BatchElement.UserData;
     if (UserData->PositionBuffer && PositionBuffer.IsBound()) {
@@ -226,4 +301,5 @@ IMPLEMENT_VERTEX_FACTORY_TYPE(
     "/Plugin/CesiumForUnreal/Private/CesiumPointAttenuationVertexFactory.ush",
     EVertexFactoryFlags::UsedWithMaterials |
         EVertexFactoryFlags::SupportsDynamicLighting |
-        EVertexFactoryFlags::SupportsPositionOnly);
+        EVertexFactoryFlags::SupportsPositionOnly |
+        EVertexFactoryFlags::SupportsCachingMeshDrawCommands);
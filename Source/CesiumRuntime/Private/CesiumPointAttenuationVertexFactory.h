@@ -14,21 +14,73 @@
 /**
  * This generates the indices necessary for point attenuation in a
  * FCesiumGltfPointsComponent.
+ *
+ * The indices only depend on the number of points, so rather than each
+ * component having its own index buffer, components share buffers whose
+ * capacities are powers of two. A component uses the smallest existing buffer
+ * that can hold its points, so most components end up sharing the buffer of
+ * the largest one.
  */
 class FCesiumPointAttenuationIndexBuffer : public FIndexBuffer {
 public:
-  FCesiumPointAttenuationIndexBuffer(
-      const int32& NumPoints,
-      const bool bAttenuationSupported)
-      : NumPoints(NumPoints), bAttenuationSupported(bAttenuationSupported) {}
+  /**
+   * The smallest number of points that a shared index buffer is created for.
+   */
+  static constexpr uint32 MinimumPointCapacity = 1024;
+
+  /**
+   * The largest number of points that a shared index buffer can be created
+   * for, such that its size in bytes fits in 32 bits.
+   */
+  static constexpr uint32 MaximumPointCapacity = 1u << 27;
+
+  /**
+   * Gets the number of points that a new index buffer would be created for in
+   * order to hold the given number of points.
+   */
+  static uint32 ComputePointCapacity(int32 NumPoints);
+
+  /**
+   * Chooses the capacity of the shared index buffer to use for the given
+   * number of points: the smallest of the existing capacities that is large
+   * enough, or the capacity of a new buffer if none is.
+   */
+  static uint32 ChoosePointCapacity(
+      const TArray<uint32>& ExistingCapacities,
+      int32 NumPoints);
+
+  /**
+   * Gets the size in bytes of an index buffer with the given point capacity.
+   */
+  static uint64 ComputeSizeInBytes(uint32 PointCapacity);
+
+  /**
+   * Gets a shared index buffer that can hold the given number of points,
+   * creating it if necessary. Each call must be balanced by a call to
+   * {@link Release}. Must be called from the rendering thread.
+   *
+   * @return The index buffer, or nullptr if there are too many points.
+   */
+  static FCesiumPointAttenuationIndexBuffer*
+  Acquire(FRHICommandListBase& RHICmdList, int32 NumPoints);
+
+  /**
+   * Releases a shared index buffer obtained from {@link Acquire}. The buffer is
+   * destroyed once it is no longer used. Must be called from the rendering
+   * thread.
+   */
+  static void Release(FCesiumPointAttenuationIndexBuffer* IndexBuffer);
+
+  explicit FCesiumPointAttenuationIndexBuffer(uint32 PointCapacity)
+      : PointCapacity(PointCapacity), NumUsers(0) {}
 
   virtual void InitRHI(FRHICommandListBase& RHICmdList) override;
 
 private:
-  // The number of points in the original point mesh. Not to be confused with
-  // the number of vertices in the attenuated point mesh.
-  const int32 NumPoints;
-  const bool bAttenuationSupported;
+  // The number of points that this buffer has indices for. Not to be confused
+  // with the number of vertices in the attenuated point mesh.
+  const uint32 PointCapacity;
+  int32 NumUsers;
 };
 
 /**
@@ -0,0 +1,112 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumPointCloudUtility.h"
+#include "Math/UnrealMathUtility.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <algorithm>
+
+namespace {
+// Spreads the lower 21 bits of the value out so that there are two zero bits
+// between each of them.
+uint64 spreadBits(uint64 value) {
+  value &= 0x1fffff;
+  value = (value | value << 32) & 0x1f00000000ffff;
+  value = (value | value << 16) & 0x1f0000ff0000ff;
+  value = (value | value << 8) & 0x100f00f00f00f00f;
+  value = (value | value << 4) & 0x10c30c30c30c30c3;
+  value = (value | value << 2) & 0x1249249249249249;
+  return value;
+}
+
+uint32 reverseBits(uint32 value) {
+  value = ((value >> 1) & 0x55555555) | ((value & 0x55555555) << 1);
+  value = ((value >> 2) & 0x33333333) | ((value & 0x33333333) << 2);
+  value = ((value >> 4) & 0x0f0f0f0f) | ((value & 0x0f0f0f0f) << 4);
+  value = ((value >> 8) & 0x00ff00ff) | ((value & 0x00ff00ff) << 8);
+  return (value >> 16) | (value << 16);
+}
+
+struct MortonPoint {
+  uint64 code;
+  uint32 index;
+};
+} // namespace
+
+namespace CesiumPointCloudUtility {
+
+void sortPointsProgressively(
+    TArray<uint32>& pointIndices,
+    TFunctionRef<FVector3f(uint32)> getPosition) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::SortPointsProgressively)
+
+  const int32 numPoints = pointIndices.Num();
+  if (numPoints < 2) {
+    return;
+  }
+
+  FVector3f min(TNumericLimits<float>::Max());
+  FVector3f max(TNumericLimits<float>::Lowest());
+  for (int32 i = 0; i < numPoints; ++i) {
+    const FVector3f position = getPosition(pointIndices[i]);
+    min = FVector3f::Min(min, position);
+    max = FVector3f::Max(max, position);
+  }
+
+  const float maxQuantized = float((1 << 21) - 1);
+  const FVector3f extent = max - min;
+  const FVector3f scale(
+      extent.X > 0.0f ? maxQuantized / extent.X : 0.0f,
+      extent.Y > 0.0f ? maxQuantized / extent.Y : 0.0f,
+      extent.Z > 0.0f ? maxQuantized / extent.Z : 0.0f);
+
+  TArray<MortonPoint> sorted;
+  sorted.SetNumUninitialized(numPoints);
+  for (int32 i = 0; i < numPoints; ++i) {
+    const FVector3f quantized = (getPosition(pointIndices[i]) - min) * scale;
+    sorted[i].code = spreadBits(uint64(quantized.X)) |
+                     (spreadBits(uint64(quantized.Y)) << 1) |
+                     (spreadBits(uint64(quantized.Z)) << 2);
+    sorted[i].index = pointIndices[i];
+  }
+
+  // Ties are broken by index so that the order doesn't depend on the sort.
+  std::sort(
+      sorted.GetData(),
+      sorted.GetData() + numPoints,
+      [](const MortonPoint& lhs, const MortonPoint& rhs) {
+        return lhs.code < rhs.code ||
+               (lhs.code == rhs.code && lhs.index < rhs.index);
+      });
+
+  // Bit reversal is a permutation of [0, 2^bits), so exactly numPoints of the
+  // reversed values are in range.
+  const uint32 bits = FMath::CeilLogTwo(uint32(numPoints));
+  const uint64 count = uint64(1) << bits;
+  int32 next = 0;
+  for (uint64 i = 0; i < count; ++i) {
+    const uint32 sortedIndex = reverseBits(uint32(i)) >> (32 - bits);
+    if (sortedIndex < uint32(numPoints)) {
+      pointIndices[next++] = sorted[sortedIndex].index;
+    }
+  }
+
+  check(next == numPoints);
+}
+
+int32 computeProgressivePointCount(
+    int32 numPoints,
+    float pointSpacingInPixels) {
+  if (pointSpacingInPixels >= 1.0f) {
+    return numPoints;
+  }
+
+  const int32 minimum = FMath::Min(numPoints, MinimumProgressivePointCount);
+  const double fraction =
+      double(pointSpacingInPixels) * double(pointSpacingInPixels);
+  const int32 count = int32(FMath::Min(
+      FMath::CeilToDouble(numPoints * fraction),
+      double(numPoints)));
+  return FMath::Max(count, minimum);
+}
+
+} // namespace CesiumPointCloudUtility
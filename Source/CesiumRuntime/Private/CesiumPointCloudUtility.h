@@ -0,0 +1,51 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Math/Vector.h"
+#include "Templates/Function.h"
+
+namespace CesiumPointCloudUtility {
+
+/**
+ * The number of points that is always drawn from a point cloud in progressive
+ * order, no matter how densely its points are packed on screen.
+ */
+constexpr int32 MinimumProgressivePointCount = 256;
+
+/**
+ * Reorders the given points so that every prefix of them covers the point
+ * cloud's extent as evenly as possible. This makes it possible to draw fewer
+ * points when they are dense on screen just by drawing a prefix of them.
+ *
+ * The points are first sorted along a Morton (Z-order) curve, which keeps
+ * points that are close in space close in the sorted order. They are then
+ * taken from the sorted order in bit-reversed order: the first point, then the
+ * one halfway along the curve, then the ones a quarter and three-quarters
+ * along, and so on.
+ *
+ * @param pointIndices The indices of the points, which are reordered in place.
+ * @param getPosition Gets the position of the point with a given index.
+ */
+void sortPointsProgressively(
+    TArray<uint32>& pointIndices,
+    TFunctionRef<FVector3f(uint32)> getPosition);
+
+/**
+ * Computes how many points of a point cloud in progressive order to draw so
+ * that neighboring points are about one pixel apart on screen.
+ *
+ * Point clouds are assumed to sample surfaces, so halving the spacing between
+ * points on screen quarters the number of points that are needed.
+ *
+ * @param numPoints The number of points in the point cloud.
+ * @param pointSpacingInPixels The distance between neighboring points on
+ * screen when all of them are drawn.
+ * @return The number of points to draw, which is never more than numPoints
+ * and never less than {@link MinimumProgressivePointCount} (unless numPoints
+ * is).
+ */
+int32 computeProgressivePointCount(int32 numPoints, float pointSpacingInPixels);
+
+} // namespace CesiumPointCloudUtility
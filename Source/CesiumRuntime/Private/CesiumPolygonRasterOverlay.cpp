@@ -15,6 +15,10 @@ using namespace CesiumRasterOverlays;
 UCesiumPolygonRasterOverlay::UCesiumPolygonRasterOverlay()
     : UCesiumRasterOverlay() {
   this->MaterialLayerKey = TEXT("Clipping");
+
+  // The clipping layer uses this overlay as a mask, so it can't be blended
+  // with the other overlays.
+  this->rendererOptions.dynamic = true;
 }
 
 std::unique_ptr<CesiumRasterOverlays::RasterOverlay>
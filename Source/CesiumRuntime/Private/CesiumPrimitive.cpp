@@ -1,6 +1,7 @@
 // Copyright 2020-2024 CesiumGS, Inc. and Contributors
 
 #include "CesiumPrimitive.h"
+#include <CesiumGltf/MeshPrimitive.h>
 
 void CesiumPrimitiveData::destroy() {
   this->Features = FCesiumPrimitiveFeatures();
@@ -23,6 +24,152 @@ void CesiumPrimitiveData::destroy() {
   std::unordered_map<int32_t, CesiumGltf::TexCoordAccessorType>
       emptyAccessorMap;
   this->TexCoordAccessorMap.swap(emptyAccessorMap);
+
+  this->pickingGeometry.reset();
+  this->pPickingBvh.Reset();
+  this->pSharedMaterialCache.Reset();
+}
+
+int64 CesiumPrimitiveData::getVertexCount() const {
+  if (this->pickingGeometry) {
+    return this->pickingGeometry->positions.Num();
+  }
+
+  return this->PositionAccessor.status() ==
+                 CesiumGltf::AccessorViewStatus::Valid
+             ? this->PositionAccessor.size()
+             : 0;
+}
+
+std::array<int64, 3>
+CesiumPrimitiveData::getFaceVertexIndices(int64 faceIndex) const {
+  if (this->pickingGeometry) {
+    const TArray<uint32>& faceIndices = this->pickingGeometry->faceIndices;
+    if (faceIndex < 0 || 3 * faceIndex + 2 >= faceIndices.Num()) {
+      return {-1, -1, -1};
+    }
+    std::array<int64, 3> result;
+    for (int64 i = 0; i < 3; ++i) {
+      const uint32 vertexIndex = faceIndices[3 * faceIndex + i];
+      result[i] = vertexIndex == MAX_uint32 ? -1 : int64(vertexIndex);
+    }
+    return result;
+  }
+
+  if (!this->pMeshPrimitive) {
+    return {-1, -1, -1};
+  }
+
+  return std::visit(
+      CesiumGltf::IndicesForFaceFromAccessor{
+          faceIndex,
+          this->PositionAccessor.size(),
+          this->pMeshPrimitive->mode},
+      this->IndexAccessor);
+}
+
+std::optional<FVector3f>
+CesiumPrimitiveData::getVertexPosition(int64 vertexIndex) const {
+  if (vertexIndex < 0 || vertexIndex >= this->getVertexCount()) {
+    return std::nullopt;
+  }
+
+  if (this->pickingGeometry) {
+    return this->pickingGeometry->positions[vertexIndex];
+  }
+
+  return this->PositionAccessor[vertexIndex];
+}
+
+std::optional<glm::dvec2> CesiumPrimitiveData::getVertexTexCoord(
+    int32_t gltfTexCoordSetIndex,
+    int64 vertexIndex) const {
+  if (this->pickingGeometry) {
+    auto texCoordIt =
+        this->pickingGeometry->texCoords.find(gltfTexCoordSetIndex);
+    if (texCoordIt == this->pickingGeometry->texCoords.end() ||
+        vertexIndex < 0 || vertexIndex >= texCoordIt->second.Num()) {
+      return std::nullopt;
+    }
+    const FVector2f& texCoord = texCoordIt->second[vertexIndex];
+    return glm::dvec2(texCoord.X, texCoord.Y);
+  }
+
+  auto accessorIt = this->TexCoordAccessorMap.find(gltfTexCoordSetIndex);
+  if (accessorIt == this->TexCoordAccessorMap.end()) {
+    return std::nullopt;
+  }
+
+  return std::visit(
+      CesiumGltf::TexCoordFromAccessor{vertexIndex},
+      accessorIt->second);
+}
+
+void CesiumPrimitiveData::releaseGltfVertexData() {
+  if (this->pickingGeometry) {
+    return;
+  }
+
+  PickingGeometry geometry;
+
+  const int64 vertexCount = this->getVertexCount();
+  geometry.positions.SetNumUninitialized(vertexCount);
+  for (int64 i = 0; i < vertexCount; ++i) {
+    geometry.positions[i] = this->PositionAccessor[i];
+  }
+
+  // Only faces of triangle primitives can be picked.
+  if (this->pMeshPrimitive && vertexCount > 0) {
+    int64 indexCount = std::visit(
+        CesiumGltf::CountFromAccessor{},
+        this->IndexAccessor);
+    if (std::holds_alternative<std::monostate>(this->IndexAccessor)) {
+      indexCount = vertexCount;
+    }
+
+    int64 faceCount = 0;
+    switch (this->pMeshPrimitive->mode) {
+    case CesiumGltf::MeshPrimitive::Mode::TRIANGLES:
+      faceCount = indexCount / 3;
+      break;
+    case CesiumGltf::MeshPrimitive::Mode::TRIANGLE_STRIP:
+    case CesiumGltf::MeshPrimitive::Mode::TRIANGLE_FAN:
+      faceCount = FMath::Max<int64>(indexCount - 2, 0);
+      break;
+    default:
+      break;
+    }
+
+    geometry.faceIndices.Reserve(3 * faceCount);
+    for (int64 face = 0; face < faceCount; ++face) {
+      std::array<int64, 3> vertexIndices = this->getFaceVertexIndices(face);
+      for (int64 vertexIndex : vertexIndices) {
+        geometry.faceIndices.Add(
+            vertexIndex >= 0 ? uint32(vertexIndex) : MAX_uint32);
+      }
+    }
+  }
+
+  for (const auto& [setIndex, accessor] : this->TexCoordAccessorMap) {
+    TArray<FVector2f>& texCoords = geometry.texCoords[setIndex];
+    texCoords.SetNumZeroed(vertexCount);
+    for (int64 i = 0; i < vertexCount; ++i) {
+      std::optional<glm::dvec2> maybeTexCoord =
+          std::visit(CesiumGltf::TexCoordFromAccessor{i}, accessor);
+      if (maybeTexCoord) {
+        texCoords[i] = FVector2f(maybeTexCoord->x, maybeTexCoord->y);
+      }
+    }
+  }
+
+  this->pickingGeometry = std::move(geometry);
+
+  // These view the glTF buffers, which are about to be released.
+  this->PositionAccessor = CesiumGltf::AccessorView<FVector3f>();
+  this->IndexAccessor = CesiumGltf::IndexAccessorType();
+  std::unordered_map<int32_t, CesiumGltf::TexCoordAccessorType>
+      emptyAccessorMap;
+  this->TexCoordAccessorMap.swap(emptyAccessorMap);
 }
 
 const CesiumGltf::MeshPrimitive* ICesiumPrimitive::GetMeshPrimitive() const {
@@ -9,8 +9,10 @@
 #include "CesiumPrimitiveFeatures.h"
 #include "CesiumPrimitiveMetadata.h"
 #include "CesiumRasterOverlays.h"
+#include "CesiumTriangleBvh.h"
 #include "EncodedFeaturesMetadata.h"
 #include <CesiumGltf/AccessorUtility.h>
+#include <array>
 #include <cstdint>
 #include <glm/mat4x4.hpp>
 #include <optional>
@@ -18,6 +20,8 @@
 
 #include "CesiumPrimitive.generated.h"
 
+class CesiumMaterialInstanceCache;
+
 namespace CesiumGltf {
 struct Model;
 struct MeshPrimitive;
@@ -100,6 +104,49 @@ public:
    */
   CesiumGltf::IndexAccessorType IndexAccessor;
 
+  /**
+   * A compact copy of the vertex data that is needed for picking. This is
+   * used in place of the accessors above once the glTF buffers they view have
+   * been released.
+   */
+  struct PickingGeometry {
+    /**
+     * The glTF positions of the primitive's vertices.
+     */
+    TArray<FVector3f> positions;
+
+    /**
+     * The vertex indices of each face, three per face, regardless of the
+     * primitive mode. Invalid indices are stored as MAX_uint32.
+     */
+    TArray<uint32> faceIndices;
+
+    /**
+     * Maps texture coordinate set indices in a glTF to copies of their values.
+     * Like TexCoordAccessorMap, this only contains the sets used by feature ID
+     * textures or property textures.
+     */
+    std::unordered_map<int32_t, TArray<FVector2f>> texCoords;
+  };
+
+  /**
+   * The compact picking geometry, if {@link releaseGltfVertexData} has been
+   * called.
+   */
+  std::optional<PickingGeometry> pickingGeometry;
+
+  /**
+   * The bounding volume hierarchy used to pick this primitive without physics,
+   * if one was built. It is expressed in the primitive's local space.
+   */
+  TSharedPtr<const CesiumTriangleBvh> pPickingBvh;
+
+  /**
+   * The cache that owns this primitive's material instance, if the instance
+   * is shared with other primitives. See CesiumMaterialInstanceCache.
+   */
+  TSharedPtr<CesiumMaterialInstanceCache> pSharedMaterialCache;
+
   std::optional<Cesium3DTilesSelection::BoundingVolume> boundingVolume;
 
   /**
@@ -120,6 +167,38 @@ public:
   static constexpr double positionScaleFactor = 1024.0;
 
   void destroy();
+
+  /**
+   * Gets the number of vertices in the glTF primitive, or 0 if the vertex
+   * positions are unavailable.
+   */
+  int64 getVertexCount() const;
+
+  /**
+   * Gets the indices of the vertices of the given face, accounting for the
+   * primitive mode. The indices will be -1 if the face does not exist.
+   */
+  std::array<int64, 3> getFaceVertexIndices(int64 faceIndex) const;
+
+  /**
+   * Gets the glTF position of the given vertex, if it exists.
+   */
+  std::optional<FVector3f> getVertexPosition(int64 vertexIndex) const;
+
+  /**
+   * Gets the value of the given texture coordinate set at the given vertex.
+   * Only the sets used by feature ID textures or property textures are
+   * available.
+   */
+  std::optional<glm::dvec2>
+  getVertexTexCoord(int32_t gltfTexCoordSetIndex, int64 vertexIndex) const;
+
+  /**
+   * Copies the vertex data needed for picking into {@link pickingGeometry} and
+   * clears the accessors that view the glTF buffers, so that those buffers can
+   * be released.
+   */
+  void releaseGltfVertexData();
 };
 
 UINTERFACE()
@@ -438,96 +438,56 @@ int32 UCesiumPropertyAttributePropertyBlueprintLibrary::GetInteger(
     UPARAM(ref) const FCesiumPropertyAttributeProperty& Property,
     int64 Index,
     int32 DefaultValue) {
-  return propertyAttributePropertyCallback<int32>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getInteger(
       Property._property,
-      Property._valueType,
-      Property._normalized,
-      [Index, DefaultValue](const auto& v) -> int32 {
-        // size() returns zero if the view is invalid.
-        if (Index < 0 || Index >= v.size()) {
-          return DefaultValue;
-        }
-        auto maybeValue = v.get(Index);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<int32, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      Index,
+      DefaultValue);
 }
 
 int64 UCesiumPropertyAttributePropertyBlueprintLibrary::GetInteger64(
     UPARAM(ref) const FCesiumPropertyAttributeProperty& Property,
     int64 Index,
     int64 DefaultValue) {
-  return propertyAttributePropertyCallback<int64>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getInteger64(
       Property._property,
-      Property._valueType,
-      Property._normalized,
-      [Index, DefaultValue](const auto& v) -> int64 {
-        // size() returns zero if the view is invalid.
-        if (Index < 0 || Index >= v.size()) {
-          return DefaultValue;
-        }
-        auto maybeValue = v.get(Index);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<int64, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      Index,
+      DefaultValue);
 }
 
 float UCesiumPropertyAttributePropertyBlueprintLibrary::GetFloat(
     UPARAM(ref) const FCesiumPropertyAttributeProperty& Property,
     int64 Index,
     float DefaultValue) {
-  return propertyAttributePropertyCallback<float>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getFloat(
       Property._property,
-      Property._valueType,
-      Property._normalized,
-      [Index, DefaultValue](const auto& v) -> float {
-        // size() returns zero if the view is invalid.
-        if (Index < 0 || Index >= v.size()) {
-          return DefaultValue;
-        }
-        auto maybeValue = v.get(Index);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<float, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      Index,
+      DefaultValue);
 }
 
 double UCesiumPropertyAttributePropertyBlueprintLibrary::GetFloat64(
     UPARAM(ref) const FCesiumPropertyAttributeProperty& Property,
     int64 Index,
     double DefaultValue) {
-  return propertyAttributePropertyCallback<double>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getFloat64(
       Property._property,
-      Property._valueType,
-      Property._normalized,
-      [Index, DefaultValue](const auto& v) -> double {
-        // size() returns zero if the view is invalid.
-        if (Index < 0 || Index >= v.size()) {
-          return DefaultValue;
-        }
-        auto maybeValue = v.get(Index);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<double, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      Index,
+      DefaultValue);
 }
 
 FIntPoint UCesiumPropertyAttributePropertyBlueprintLibrary::GetIntPoint(
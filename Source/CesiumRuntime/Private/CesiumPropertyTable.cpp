@@ -2,10 +2,34 @@
 
 #include "CesiumPropertyTable.h"
 
+#include <CesiumGltf/Model.h>
 #include <CesiumGltf/PropertyTableView.h>
 
 static FCesiumPropertyTableProperty EmptyPropertyTableProperty;
 
+namespace {
+std::span<const std::byte>
+getBufferViewData(const CesiumGltf::Model& model, int32_t bufferViewIndex) {
+  const CesiumGltf::BufferView* pBufferView =
+      CesiumGltf::Model::getSafe(&model.bufferViews, bufferViewIndex);
+  if (!pBufferView) {
+    return {};
+  }
+
+  const CesiumGltf::Buffer* pBuffer =
+      CesiumGltf::Model::getSafe(&model.buffers, pBufferView->buffer);
+  if (!pBuffer || pBufferView->byteOffset < 0 || pBufferView->byteLength < 0 ||
+      pBufferView->byteOffset + pBufferView->byteLength >
+          int64_t(pBuffer->cesium.data.size())) {
+    return {};
+  }
+
+  return std::span<const std::byte>(
+      pBuffer->cesium.data.data() + pBufferView->byteOffset,
+      size_t(pBufferView->byteLength));
+}
+} // namespace
+
 FCesiumPropertyTable::FCesiumPropertyTable(
     const CesiumGltf::Model& model,
     const CesiumGltf::PropertyTable& propertyTable,
@@ -34,7 +58,9 @@ FCesiumPropertyTable::FCesiumPropertyTable(
   propertyTableView.forEachProperty([&properties = _properties,
                                      &Schema = *pExtension->schema,
                                      &propertyTableView,
-                                     &pEnumCollection](
+                                     &pEnumCollection,
+                                     &model,
+                                     &propertyTable](
                                         const std::string& propertyName,
                                         auto propertyValue) mutable {
     FString key(UTF8_TO_TCHAR(propertyName.data()));
@@ -48,9 +74,20 @@ FCesiumPropertyTable::FCesiumPropertyTable(
           FString(UTF8_TO_TCHAR(pClassProperty->enumType.value().c_str())));
     }
 
-    properties.Add(
+    FCesiumPropertyTableProperty& property = properties.Add(
         key,
         FCesiumPropertyTableProperty(propertyValue, pEnumDefinition));
+
+    auto propertyIt = propertyTable.properties.find(propertyName);
+    if (propertyIt != propertyTable.properties.end()) {
+      const CesiumGltf::PropertyTableProperty& source = propertyIt->second;
+      property._source = {
+          getBufferViewData(model, source.values),
+          getBufferViewData(model, source.arrayOffsets),
+          getBufferViewData(model, source.stringOffsets),
+          source.arrayOffsetType,
+          source.stringOffsetType};
+    }
   });
 }
 
@@ -6,6 +6,8 @@
 
 #include <CesiumGltf/MetadataConversions.h>
 #include <CesiumGltf/PropertyTypeTraits.h>
+#include <limits>
+#include <type_traits>
 #include <utility>
 
 namespace {
@@ -837,6 +839,181 @@ TResult propertyTablePropertyCallback(
   }
 }
 
+/**
+ * Gets the values of many features of a property table property, converted to
+ * the given type. The type of the property is resolved once, and then the
+ * values are converted in a single loop.
+ *
+ * @param property The std::any containing the property.
+ * @param valueType The FCesiumMetadataValueType of the property.
+ * @param normalized Whether the property is normalized.
+ * @param count The number of values to get.
+ * @param getFeatureID A function that returns the ID of the feature whose
+ * value goes at the given index of the result.
+ * @param defaultValue The value to use for out-of-range feature IDs and for
+ * values that can't be converted.
+ *
+ * @tparam T The type of the values to get.
+ * @tparam TConversion The type to convert the values to with
+ * CesiumGltf::MetadataConversions, which must be the same as T or convertible
+ * to it.
+ * @tparam GetFeatureID The type of the function that returns the feature IDs.
+ */
+template <typename T, typename TConversion = T, typename GetFeatureID>
+TArray<T> getPropertyTablePropertyValues(
+    const std::any& property,
+    const FCesiumMetadataValueType& valueType,
+    bool normalized,
+    int32 count,
+    GetFeatureID&& getFeatureID,
+    T defaultValue) {
+  TArray<T> result;
+  if (count <= 0) {
+    return result;
+  }
+
+  result.SetNumUninitialized(count);
+  propertyTablePropertyCallback<void>(
+      property,
+      valueType,
+      normalized,
+      [count, &getFeatureID, defaultValue, &result](const auto& v) {
+        // size() returns zero if the view is invalid.
+        const int64 size = v.size();
+        T* pResult = result.GetData();
+        for (int32 i = 0; i < count; ++i) {
+          const int64 featureID = getFeatureID(i);
+          if (featureID < 0 || featureID >= size) {
+            pResult[i] = defaultValue;
+            continue;
+          }
+
+          auto maybeValue = v.get(featureID);
+          if (!maybeValue) {
+            pResult[i] = defaultValue;
+            continue;
+          }
+
+          auto value = *maybeValue;
+          pResult[i] = T(
+              CesiumGltf::MetadataConversions<TConversion, decltype(value)>::
+                  convert(value)
+                      .value_or(TConversion(defaultValue)));
+        }
+      });
+
+  return result;
+}
+
+/**
+ * Whether every value of type TFrom converts exactly to type T, so that a
+ * static_cast gives the same result as the metadata conversion without its
+ * range checks.
+ */
+template <typename T, typename TFrom>
+constexpr bool isExactScalarConversion() {
+  if constexpr (std::is_same_v<T, TFrom>) {
+    return true;
+  } else if constexpr (
+      !std::is_arithmetic_v<T> || !std::is_arithmetic_v<TFrom> ||
+      std::is_same_v<T, bool> || std::is_same_v<TFrom, bool>) {
+    return false;
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return std::numeric_limits<TFrom>::digits <=
+               std::numeric_limits<T>::digits &&
+           (std::is_integral_v<TFrom> ||
+            std::numeric_limits<TFrom>::max_exponent <=
+                std::numeric_limits<T>::max_exponent);
+  } else if constexpr (std::is_integral_v<TFrom>) {
+    return std::is_signed_v<T> == std::is_signed_v<TFrom>
+               ? sizeof(T) >= sizeof(TFrom)
+               : std::is_signed_v<T> && sizeof(T) > sizeof(TFrom);
+  } else {
+    return false;
+  }
+}
+
+/**
+ * Copies the raw values of all features of a scalar property table property
+ * into the given array, converted to the given type. This reads the property's
+ * buffer in a single loop with no per-feature type dispatch, so that the
+ * compiler can vectorize it for the common numeric types. Values of the same
+ * type, or of a type that converts exactly, are copied without the range
+ * checks of the metadata conversions.
+ *
+ * @param view The property table property view.
+ * @param outValues The array to copy the values into.
+ * @return True if the values were copied, or false if the view is not valid or
+ * the array is too small.
+ *
+ * @tparam T The type of the values to copy.
+ * @tparam TView The type of the property table property view.
+ */
+template <typename T, typename TView>
+bool copyRawScalarValues(const TView& view, TArrayView<T> outValues) {
+  if (view.status() != CesiumGltf::PropertyTablePropertyViewStatus::Valid) {
+    return false;
+  }
+
+  const int64 size = view.size();
+  if (size > outValues.Num()) {
+    return false;
+  }
+
+  using TRaw = std::decay_t<decltype(view.getRaw(0))>;
+
+  T* pOut = outValues.GetData();
+  if constexpr (isExactScalarConversion<T, TRaw>()) {
+    for (int64 i = 0; i < size; ++i) {
+      pOut[i] = static_cast<T>(view.getRaw(i));
+    }
+  } else {
+    for (int64 i = 0; i < size; ++i) {
+      pOut[i] =
+          CesiumGltf::MetadataConversions<T, TRaw>::convert(view.getRaw(i))
+              .value_or(T(0));
+    }
+  }
+
+  return true;
+}
+
+/**
+ * Copies the raw values of all features of a property table property into the
+ * given array, converted to the given type, if the property is a scalar
+ * property.
+ *
+ * @param property The std::any containing the property.
+ * @param valueType The FCesiumMetadataValueType of the property.
+ * @param normalized Whether the property is normalized.
+ * @param outValues The array to copy the values into.
+ * @return True if the values were copied.
+ *
+ * @tparam T The type of the values to copy.
+ */
+template <typename T>
+bool getPropertyTablePropertyRawScalarValues(
+    const std::any& property,
+    const FCesiumMetadataValueType& valueType,
+    bool normalized,
+    TArrayView<T> outValues) {
+  if (valueType.Type != ECesiumMetadataType::Scalar || valueType.bIsArray) {
+    return false;
+  }
+
+  auto copy = [outValues](const auto& view) {
+    return copyRawScalarValues(view, outValues);
+  };
+  return normalized ? scalarPropertyTablePropertyCallback<true, bool>(
+                          property,
+                          valueType,
+                          copy)
+                    : scalarPropertyTablePropertyCallback<false, bool>(
+                          property,
+                          valueType,
+                          copy);
+}
+
 } // namespace
 
 ECesiumPropertyTablePropertyStatus
@@ -940,96 +1117,168 @@ int32 UCesiumPropertyTablePropertyBlueprintLibrary::GetInteger(
     UPARAM(ref) const FCesiumPropertyTableProperty& Property,
     int64 FeatureID,
     int32 DefaultValue) {
-  return propertyTablePropertyCallback<int32>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getInteger(
       Property._property,
-      Property._valueType,
-      Property._normalized,
-      [FeatureID, DefaultValue](const auto& v) -> int32 {
-        // size() returns zero if the view is invalid.
-        if (FeatureID < 0 || FeatureID >= v.size()) {
-          return DefaultValue;
-        }
-        auto maybeValue = v.get(FeatureID);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<int32, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      FeatureID,
+      DefaultValue);
 }
 
 int64 UCesiumPropertyTablePropertyBlueprintLibrary::GetInteger64(
     UPARAM(ref) const FCesiumPropertyTableProperty& Property,
     int64 FeatureID,
     int64 DefaultValue) {
-  return propertyTablePropertyCallback<int64>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getInteger64(
       Property._property,
-      Property._valueType,
-      Property._normalized,
-      [FeatureID, DefaultValue](const auto& v) -> int64 {
-        // size() returns zero if the view is invalid.
-        if (FeatureID < 0 || FeatureID >= v.size()) {
-          return DefaultValue;
-        }
-        auto maybeValue = v.get(FeatureID);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<int64_t, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      FeatureID,
+      DefaultValue);
 }
 
 float UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat(
     UPARAM(ref) const FCesiumPropertyTableProperty& Property,
     int64 FeatureID,
     float DefaultValue) {
-  return propertyTablePropertyCallback<float>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getFloat(
       Property._property,
-      Property._valueType,
-      Property._normalized,
-      [FeatureID, DefaultValue](const auto& v) -> float {
-        // size() returns zero if the view is invalid.
-        if (FeatureID < 0 || FeatureID >= v.size()) {
-          return DefaultValue;
-        }
-        auto maybeValue = v.get(FeatureID);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<float, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      FeatureID,
+      DefaultValue);
 }
 
 double UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64(
     UPARAM(ref) const FCesiumPropertyTableProperty& Property,
     int64 FeatureID,
     double DefaultValue) {
-  return propertyTablePropertyCallback<double>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getFloat64(
+      Property._property,
+      FeatureID,
+      DefaultValue);
+}
+
+TArray<int32> UCesiumPropertyTablePropertyBlueprintLibrary::GetIntegerValues(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    int64 FirstFeatureID,
+    int32 Count,
+    int32 DefaultValue) {
+  return getPropertyTablePropertyValues<int32>(
       Property._property,
       Property._valueType,
       Property._normalized,
-      [FeatureID, DefaultValue](const auto& v) -> double {
-        // size() returns zero if the view is invalid.
-        if (FeatureID < 0 || FeatureID >= v.size()) {
-          return DefaultValue;
-        }
-        auto maybeValue = v.get(FeatureID);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<double, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      Count,
+      [FirstFeatureID](int32 i) { return FirstFeatureID + i; },
+      DefaultValue);
+}
+
+TArray<int32>
+UCesiumPropertyTablePropertyBlueprintLibrary::GetIntegerValuesForFeatures(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    const TArray<int64>& FeatureIDs,
+    int32 DefaultValue) {
+  return getPropertyTablePropertyValues<int32>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      FeatureIDs.Num(),
+      [&FeatureIDs](int32 i) { return FeatureIDs[i]; },
+      DefaultValue);
+}
+
+TArray<int64> UCesiumPropertyTablePropertyBlueprintLibrary::GetInteger64Values(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    int64 FirstFeatureID,
+    int32 Count,
+    int64 DefaultValue) {
+  return getPropertyTablePropertyValues<int64, int64_t>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      Count,
+      [FirstFeatureID](int32 i) { return FirstFeatureID + i; },
+      DefaultValue);
+}
+
+TArray<int64>
+UCesiumPropertyTablePropertyBlueprintLibrary::GetInteger64ValuesForFeatures(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    const TArray<int64>& FeatureIDs,
+    int64 DefaultValue) {
+  return getPropertyTablePropertyValues<int64, int64_t>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      FeatureIDs.Num(),
+      [&FeatureIDs](int32 i) { return FeatureIDs[i]; },
+      DefaultValue);
+}
+
+TArray<float> UCesiumPropertyTablePropertyBlueprintLibrary::GetFloatValues(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    int64 FirstFeatureID,
+    int32 Count,
+    float DefaultValue) {
+  return getPropertyTablePropertyValues<float>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      Count,
+      [FirstFeatureID](int32 i) { return FirstFeatureID + i; },
+      DefaultValue);
+}
+
+TArray<float>
+UCesiumPropertyTablePropertyBlueprintLibrary::GetFloatValuesForFeatures(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    const TArray<int64>& FeatureIDs,
+    float DefaultValue) {
+  return getPropertyTablePropertyValues<float>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      FeatureIDs.Num(),
+      [&FeatureIDs](int32 i) { return FeatureIDs[i]; },
+      DefaultValue);
+}
+
+TArray<double> UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64Values(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    int64 FirstFeatureID,
+    int32 Count,
+    double DefaultValue) {
+  return getPropertyTablePropertyValues<double>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      Count,
+      [FirstFeatureID](int32 i) { return FirstFeatureID + i; },
+      DefaultValue);
+}
+
+TArray<double>
+UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64ValuesForFeatures(
+    UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+    const TArray<int64>& FeatureIDs,
+    double DefaultValue) {
+  return getPropertyTablePropertyValues<double>(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      FeatureIDs.Num(),
+      [&FeatureIDs](int32 i) { return FeatureIDs[i]; },
+      DefaultValue);
 }
 
 FIntPoint UCesiumPropertyTablePropertyBlueprintLibrary::GetIntPoint(
@@ -1354,6 +1603,32 @@ FCesiumMetadataValue UCesiumPropertyTablePropertyBlueprintLibrary::GetRawValue(
       });
 }
 
+bool UCesiumPropertyTablePropertyBlueprintLibrary::GetRawFloatValues(
+    const FCesiumPropertyTableProperty& Property,
+    TArrayView<float> OutValues) {
+  return getPropertyTablePropertyRawScalarValues(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      OutValues);
+}
+
+bool UCesiumPropertyTablePropertyBlueprintLibrary::GetRawByteValues(
+    const FCesiumPropertyTableProperty& Property,
+    TArrayView<uint8> OutValues) {
+  return getPropertyTablePropertyRawScalarValues(
+      Property._property,
+      Property._valueType,
+      Property._normalized,
+      OutValues);
+}
+
+const FCesiumPropertyTablePropertySource&
+UCesiumPropertyTablePropertyBlueprintLibrary::GetSourceData(
+    const FCesiumPropertyTableProperty& Property) {
+  return Property._source;
+}
+
 bool UCesiumPropertyTablePropertyBlueprintLibrary::IsNormalized(
     UPARAM(ref) const FCesiumPropertyTableProperty& Property) {
   return Property._normalized;
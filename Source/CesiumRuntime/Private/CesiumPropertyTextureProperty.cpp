@@ -492,96 +492,56 @@ int32 UCesiumPropertyTexturePropertyBlueprintLibrary::GetInteger(
     UPARAM(ref) const FCesiumPropertyTextureProperty& Property,
     const FVector2D& UV,
     int32 DefaultValue) {
-  return propertyTexturePropertyCallback<int32>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getInteger(
       Property._property,
-      Property._valueType,
-      Property._normalized,
-      [&UV, DefaultValue](const auto& view) -> int32 {
-        if (view.status() !=
-            CesiumGltf::PropertyTexturePropertyViewStatus::Valid) {
-          return DefaultValue;
-        }
-        auto maybeValue = view.get(UV.X, UV.Y);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<int32, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      UV,
+      DefaultValue);
 }
 
 int64 UCesiumPropertyTexturePropertyBlueprintLibrary::GetInteger64(
     UPARAM(ref) const FCesiumPropertyTextureProperty& Property,
     const FVector2D& UV,
     int64 DefaultValue) {
-  return propertyTexturePropertyCallback<int64>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getInteger64(
       Property._property,
-      Property._valueType,
-      Property._normalized,
-      [&UV, DefaultValue](const auto& view) -> int64 {
-        if (view.status() !=
-            CesiumGltf::PropertyTexturePropertyViewStatus::Valid) {
-          return DefaultValue;
-        }
-        auto maybeValue = view.get(UV.X, UV.Y);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<int64, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      UV,
+      DefaultValue);
 }
 
 float UCesiumPropertyTexturePropertyBlueprintLibrary::GetFloat(
     UPARAM(ref) const FCesiumPropertyTextureProperty& Property,
     const FVector2D& UV,
     float DefaultValue) {
-  return propertyTexturePropertyCallback<float>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getFloat(
       Property._property,
-      Property._valueType,
-      Property._normalized,
-      [&UV, DefaultValue](const auto& view) -> float {
-        if (view.status() !=
-            CesiumGltf::PropertyTexturePropertyViewStatus::Valid) {
-          return DefaultValue;
-        }
-        auto maybeValue = view.get(UV.X, UV.Y);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<float, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      UV,
+      DefaultValue);
 }
 
 double UCesiumPropertyTexturePropertyBlueprintLibrary::GetFloat64(
     UPARAM(ref) const FCesiumPropertyTextureProperty& Property,
     const FVector2D& UV,
     double DefaultValue) {
-  return propertyTexturePropertyCallback<double>(
+  // Only valid properties have accessors.
+  if (!Property._pScalarAccessors) {
+    return DefaultValue;
+  }
+  return Property._pScalarAccessors->getFloat64(
       Property._property,
-      Property._valueType,
-      Property._normalized,
-      [&UV, DefaultValue](const auto& view) -> double {
-        if (view.status() !=
-            CesiumGltf::PropertyTexturePropertyViewStatus::Valid) {
-          return DefaultValue;
-        }
-        auto maybeValue = view.get(UV.X, UV.Y);
-        if (maybeValue) {
-          auto value = *maybeValue;
-          return CesiumGltf::MetadataConversions<double, decltype(value)>::
-              convert(value)
-                  .value_or(DefaultValue);
-        }
-        return DefaultValue;
-      });
+      UV,
+      DefaultValue);
 }
 
 FIntPoint UCesiumPropertyTexturePropertyBlueprintLibrary::GetIntPoint(
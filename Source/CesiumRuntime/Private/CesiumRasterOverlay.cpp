@@ -5,14 +5,75 @@
 #include "Cesium3DTilesSelection/Tileset.h"
 #include "Cesium3DTileset.h"
 #include "CesiumAsync/IAssetResponse.h"
+#include "CesiumGltfComponent.h"
+#include "CesiumMaterialUserData.h"
+#include "CesiumRasterOverlayParameterNames.h"
 #include "CesiumRasterOverlays/RasterOverlayLoadFailureDetails.h"
 #include "CesiumRuntime.h"
+#include "Materials/MaterialInstance.h"
 
 FCesiumRasterOverlayLoadFailure OnCesiumRasterOverlayLoadFailure{};
 
+namespace {
+const TCHAR* DefaultOverlayLayerPath = TEXT(
+    "/CesiumForUnreal/Materials/Layers/ML_CesiumRasterOverlay.ML_CesiumRasterOverlay");
+
+// Whether the material samples the overlay with the layer that ships with the
+// plugin, which reads all four channels of the overlay's texture.
+bool isSampledByDefaultLayer(
+    UMaterialInterface* pMaterial,
+    const FString& materialLayerKey) {
+  // Layer names are only available from the user data, which may be attached
+  // to a parent of the material.
+  const UCesiumMaterialUserData* pCesiumData = nullptr;
+  for (UMaterialInstance* pInstance = Cast<UMaterialInstance>(pMaterial);
+       pInstance && !pCesiumData;
+       pInstance = Cast<UMaterialInstance>(pInstance->Parent.Get())) {
+    pCesiumData = pInstance->GetAssetUserData<UCesiumMaterialUserData>();
+  }
+
+  FMaterialLayersFunctions layers;
+  if (!pCesiumData || !pMaterial->GetMaterialLayers(layers)) {
+    return false;
+  }
+
+  for (int32 i = 0; i < pCesiumData->LayerNames.Num(); ++i) {
+    if (pCesiumData->LayerNames[i] == materialLayerKey &&
+        layers.Layers.IsValidIndex(i) && layers.Layers[i] &&
+        layers.Layers[i]->GetPathName() == DefaultOverlayLayerPath) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Whether any of the materials of the tileset's tiles samples the overlay with
+// the layer that ships with the plugin.
+bool isSampledByDefaultLayer(
+    const ACesium3DTileset& tileset,
+    const FString& materialLayerKey) {
+  const UCesiumGltfComponent* pDefaults = GetDefault<UCesiumGltfComponent>();
+  UMaterialInterface* materials[] = {
+      tileset.GetMaterial() ? tileset.GetMaterial() : pDefaults->BaseMaterial,
+      tileset.GetTranslucentMaterial()
+          ? tileset.GetTranslucentMaterial()
+          : pDefaults->BaseMaterialWithTranslucency,
+      tileset.GetWaterMaterial() ? tileset.GetWaterMaterial()
+                                 : pDefaults->BaseMaterialWithWater};
+  for (UMaterialInterface* pMaterial : materials) {
+    if (pMaterial && isSampledByDefaultLayer(pMaterial, materialLayerKey)) {
+      return true;
+    }
+  }
+  return false;
+}
+} // namespace
+
 // Sets default values for this component's properties
 UCesiumRasterOverlay::UCesiumRasterOverlay()
-    : _pOverlay(nullptr), _overlaysBeingDestroyed(0) {
+    : _pOverlay(nullptr),
+      _overlaysBeingDestroyed(0),
+      _resolvedRendererOptions() {
   this->bAutoActivate = true;
 
   // Set this component to be initialized when the game starts, and to be ticked
@@ -42,6 +103,15 @@ void UCesiumRasterOverlay::AddToTileset() {
     return;
   }
 
+  // Tiles that released their glTF buffers after they were loaded can't be
+  // upsampled for this overlay, so load them again. The overlay is added when
+  // the tileset is recreated.
+  ACesium3DTileset* pActor = this->GetOwner<ACesium3DTileset>();
+  if (pActor && pActor->hasReleasedGltfBuffers()) {
+    pActor->RefreshTileset();
+    return;
+  }
+
   Cesium3DTilesSelection::Tileset* pTileset = FindTileset();
   if (!pTileset) {
     return;
@@ -54,7 +124,22 @@ void UCesiumRasterOverlay::AddToTileset() {
   options.maximumTextureSize = this->MaximumTextureSize;
   options.subTileCacheBytes = this->SubTileCacheBytes;
   options.showCreditsOnScreen = this->ShowCreditsOnScreen;
-  options.rendererOptions = &this->rendererOptions;
+
+  this->_resolvedRendererOptions = this->rendererOptions;
+  if (this->rendererOptions.channels != ECesiumRasterOverlayChannels::RGBA &&
+      pActor && isSampledByDefaultLayer(*pActor, this->MaterialLayerKey)) {
+    UE_LOG(
+        LogCesium,
+        Warning,
+        TEXT(
+            "Raster overlay %s keeps fewer than four channels, but the material layer %s of tileset %s reads all four, so the overlay will be uploaded as RGBA. Use a material layer that reads the overlay's value from its red channel instead."),
+        *this->GetName(),
+        *this->MaterialLayerKey,
+        *pActor->GetName());
+    this->_resolvedRendererOptions.channels =
+        ECesiumRasterOverlayChannels::RGBA;
+  }
+  options.rendererOptions = &this->_resolvedRendererOptions;
   options.loadErrorCallback =
       [this](const CesiumRasterOverlays::RasterOverlayLoadFailureDetails&
                  details) {
@@ -126,6 +211,14 @@ void UCesiumRasterOverlay::RemoveFromTileset() {
 
   this->OnRemove(pTileset, this->_pOverlay);
   pTileset->getOverlays().remove(this->_pOverlay);
+
+  // Tiles that the overlay was just detached from keep its parameter names
+  // until they have applied the change.
+  ACesium3DTileset* pActor = this->GetOwner<ACesium3DTileset>();
+  if (pActor) {
+    pActor->getRasterOverlayParameterNameCache().remove(
+        this->_pOverlay->getName());
+  }
   this->_pOverlay.reset();
 }
 
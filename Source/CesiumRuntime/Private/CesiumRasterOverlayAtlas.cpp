@@ -0,0 +1,527 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumRasterOverlayAtlas.h"
+#include "CesiumGltfComponent.h"
+#include "CesiumLifetime.h"
+#include "CesiumStats.h"
+#include "CesiumTextureResource.h"
+#include "Engine/Texture2D.h"
+#include "RenderingThread.h"
+#include "RHICommandList.h"
+#include "UObject/Package.h"
+#include <cstring>
+
+DECLARE_MEMORY_STAT(
+    TEXT("Raster Overlay Atlas Pages"),
+    STAT_CesiumRasterOverlayAtlasMemory,
+    STATGROUP_Cesium);
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Atlased Raster Overlay Tiles"),
+    STAT_CesiumAtlasedRasterOverlayTiles,
+    STATGROUP_Cesium);
+
+/*static*/ std::optional<CesiumRasterOverlayAtlas::Content>
+CesiumRasterOverlayAtlas::padImage(
+    CesiumGltf::ImageAsset& image,
+    bool useMipMaps) {
+  if (image.compressedPixelFormat !=
+          CesiumGltf::GpuCompressedPixelFormat::NONE ||
+      image.mipPositions.size() > 1 || image.bytesPerChannel != 1 ||
+      image.channels < 1 || image.channels > 4 || image.channels == 3 ||
+      image.width <= 0 || image.height <= 0) {
+    return std::nullopt;
+  }
+
+  // Padding the left and top by a whole texel of the last mip keeps the
+  // tile's texels from sharing a texel of any mip with the padding, and
+  // rounding up the right and bottom keeps every mip a whole number of
+  // compressed blocks.
+  const int32 mipCount = useMipMaps ? MaximumMipCount : 1;
+  const int32 offset = computePadding(mipCount);
+  const int32 granularity = computeGranularity(mipCount);
+  const int32 width = Align(image.width + 2 * offset, granularity);
+  const int32 height = Align(image.height + 2 * offset, granularity);
+  if (width > PageSize || height > PageSize) {
+    return std::nullopt;
+  }
+
+  const size_t texelSize = size_t(image.channels);
+  const size_t sourceOffset =
+      image.mipPositions.empty() ? 0 : image.mipPositions[0].byteOffset;
+  const size_t sourcePitch = size_t(image.width) * texelSize;
+  if (sourceOffset + sourcePitch * size_t(image.height) >
+      image.pixelData.size()) {
+    return std::nullopt;
+  }
+
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::PadRasterOverlayImage)
+
+  const size_t pitch = size_t(width) * texelSize;
+  std::vector<std::byte> pixelData(pitch * size_t(height));
+  for (int32 y = 0; y < height; ++y) {
+    const int32 sourceY = FMath::Clamp(y - offset, 0, image.height - 1);
+    const std::byte* pSource =
+        image.pixelData.data() + sourceOffset + sourcePitch * size_t(sourceY);
+    std::byte* pTarget = pixelData.data() + pitch * size_t(y);
+    for (int32 x = 0; x < offset; ++x) {
+      std::memcpy(pTarget + size_t(x) * texelSize, pSource, texelSize);
+    }
+    std::memcpy(pTarget + size_t(offset) * texelSize, pSource, sourcePitch);
+    const std::byte* pLast = pSource + sourcePitch - texelSize;
+    for (int32 x = offset + image.width; x < width; ++x) {
+      std::memcpy(pTarget + size_t(x) * texelSize, pLast, texelSize);
+    }
+  }
+
+  const Content content{offset, image.width, image.height};
+  image.width = width;
+  image.height = height;
+  image.pixelData.swap(pixelData);
+  image.mipPositions.clear();
+  return content;
+}
+
+/*static*/ std::optional<CesiumRasterOverlayAtlas::Image>
+CesiumRasterOverlayAtlas::takeImage(
+    CesiumGltf::ImageAsset& image,
+    const Content& content,
+    EPixelFormat format,
+    bool sRGB,
+    bool useMipMaps,
+    TextureFilter filter,
+    TextureGroup group) {
+  if (image.pixelData.empty() || image.width <= 0 || image.height <= 0 ||
+      image.width > PageSize || image.height > PageSize) {
+    return std::nullopt;
+  }
+
+  // An image whose mipmaps couldn't be generated is added without them, as it
+  // would be given its own texture without them, rather than falling back to
+  // a texture that would show its padding.
+  const int32 mipCount =
+      useMipMaps && int32(image.mipPositions.size()) >= MaximumMipCount
+          ? MaximumMipCount
+          : 1;
+
+  // Each copied mip of a compressed image must be a whole number of blocks,
+  // or its last row and column of blocks would spill into the next tile.
+  const FPixelFormatInfo& formatInfo = GPixelFormats[format];
+  for (int32 i = 0; i < mipCount; ++i) {
+    const int32 mipWidth = FMath::Max(image.width >> i, 1);
+    const int32 mipHeight = FMath::Max(image.height >> i, 1);
+    if (mipWidth % formatInfo.BlockSizeX != 0 ||
+        mipHeight % formatInfo.BlockSizeY != 0) {
+      return std::nullopt;
+    }
+  }
+
+  // Keep an accurate size for caching purposes, as texture creation does.
+  image.sizeBytes = int64_t(image.pixelData.size());
+
+  Image result{
+      image.width,
+      image.height,
+      content,
+      format,
+      sRGB,
+      filter,
+      group,
+      mipCount,
+      {},
+      {}};
+  result.mipPositions.swap(image.mipPositions);
+  result.pixelData.swap(image.pixelData);
+  return result;
+}
+
+CesiumRasterOverlayAtlas::CesiumRasterOverlayAtlas()
+    : _pages(), _entries(), _defragmentPending(false) {}
+
+CesiumRasterOverlayAtlas::~CesiumRasterOverlayAtlas() {
+  // The pages are left to the garbage collector, because this may be called
+  // while it is running.
+  for (const Page& page : this->_pages) {
+    DEC_MEMORY_STAT_BY(STAT_CesiumRasterOverlayAtlasMemory, page.sizeBytes);
+  }
+  DEC_DWORD_STAT_BY(STAT_CesiumAtlasedRasterOverlayTiles, this->_entries.Num());
+}
+
+int32 CesiumRasterOverlayAtlas::add(Image&& image) {
+  const PageFormat format{
+      image.format,
+      image.sRGB,
+      image.filter,
+      image.group,
+      image.mipCount};
+
+  int32 pageIndex = INDEX_NONE;
+  std::optional<CesiumAtlasAllocator::Block> block;
+  for (auto it = this->_pages.CreateIterator(); it; ++it) {
+    if (it->format == format) {
+      block = it->allocator.allocate(image.width, image.height);
+      if (block) {
+        pageIndex = it.GetIndex();
+        break;
+      }
+    }
+  }
+
+  if (!block) {
+    pageIndex = this->addPage(format);
+    block = this->_pages[pageIndex].allocator.allocate(
+        image.width,
+        image.height);
+    check(block);
+  }
+
+  const int32 handle = this->_entries.Add(Entry{
+      pageIndex,
+      *block,
+      image.width,
+      image.height,
+      image.content,
+      {}});
+  INC_DWORD_STAT(STAT_CesiumAtlasedRasterOverlayTiles);
+
+  ENQUEUE_RENDER_COMMAND(Cesium_CopyToRasterOverlayAtlas)
+  ([pResource = this->_pages[pageIndex].pTexture->GetResource(),
+    x = block->x,
+    y = block->y,
+    image = MoveTemp(image)](FRHICommandListImmediate& RHICmdList) {
+    FRHITexture* pTexture = pResource->TextureRHI;
+    if (!pTexture) {
+      return;
+    }
+
+    const FPixelFormatInfo& formatInfo = GPixelFormats[image.format];
+    for (int32 i = 0; i < image.mipCount; ++i) {
+      const uint32 mipWidth = uint32(FMath::Max(image.width >> i, 1));
+      const uint32 mipHeight = uint32(FMath::Max(image.height >> i, 1));
+      const size_t byteOffset =
+          image.mipPositions.empty() ? 0 : image.mipPositions[i].byteOffset;
+      const uint32 pitch =
+          FMath::DivideAndRoundUp(mipWidth, uint32(formatInfo.BlockSizeX)) *
+          formatInfo.BlockBytes;
+
+      RHIUpdateTexture2D(
+          pTexture,
+          uint32(i),
+          FUpdateTextureRegion2D(
+              uint32(x >> i),
+              uint32(y >> i),
+              0,
+              0,
+              mipWidth,
+              mipHeight),
+          pitch,
+          reinterpret_cast<const uint8*>(image.pixelData.data() + byteOffset));
+    }
+  });
+
+  return handle;
+}
+
+void CesiumRasterOverlayAtlas::remove(int32 handle) {
+  const Entry& entry = this->_entries[handle];
+  const int32 pageIndex = entry.page;
+  Page& page = this->_pages[pageIndex];
+  page.allocator.free(entry.block);
+
+  this->_entries.RemoveAt(handle);
+  DEC_DWORD_STAT(STAT_CesiumAtlasedRasterOverlayTiles);
+
+  if (page.allocator.getAllocationCount() == 0) {
+    this->destroyPage(pageIndex);
+  } else {
+    this->_defragmentPending = true;
+  }
+}
+
+void CesiumRasterOverlayAtlas::attach(
+    int32 handle,
+    UCesiumGltfComponent& gltf,
+    const Cesium3DTilesSelection::Tile& tile,
+    const CesiumRasterOverlays::RasterOverlayTile& rasterTile,
+    const glm::dvec2& translation,
+    const glm::dvec2& scale,
+    int32 textureCoordinateID) {
+  Entry& entry = this->_entries[handle];
+  const Attachment& attachment = entry.attachments.Add_GetRef(Attachment{
+      &gltf,
+      &tile,
+      &rasterTile,
+      translation,
+      scale,
+      textureCoordinateID});
+  this->attachToGltf(entry, attachment);
+}
+
+void CesiumRasterOverlayAtlas::detach(
+    int32 handle,
+    UCesiumGltfComponent& gltf,
+    const Cesium3DTilesSelection::Tile& tile,
+    const CesiumRasterOverlays::RasterOverlayTile& rasterTile) {
+  Entry& entry = this->_entries[handle];
+  entry.attachments.RemoveAllSwap([&](const Attachment& attachment) {
+    return attachment.pGltf.Get() == &gltf && attachment.pTile == &tile &&
+           attachment.pRasterTile == &rasterTile;
+  });
+  gltf.DetachRasterTile(
+      tile,
+      rasterTile,
+      this->_pages[entry.page].pTexture);
+}
+
+void CesiumRasterOverlayAtlas::defragment(
+    TArray<UCesiumGltfComponent*>& reattached) {
+  // Pages only become sparse when tiles are removed, so there's nothing new to
+  // try until then.
+  if (!this->_defragmentPending) {
+    return;
+  }
+  this->_defragmentPending = false;
+
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::DefragmentRasterOverlayAtlas)
+
+  // Find the sparsest page that has another page of the same kind to move its
+  // tiles to.
+  int32 sourceIndex = INDEX_NONE;
+  double sourceOccupancy = DefragmentOccupancy;
+  for (auto it = this->_pages.CreateConstIterator(); it; ++it) {
+    const double occupancy = it->allocator.getOccupancy();
+    if (occupancy >= sourceOccupancy) {
+      continue;
+    }
+    for (auto otherIt = this->_pages.CreateConstIterator(); otherIt;
+         ++otherIt) {
+      if (otherIt.GetIndex() != it.GetIndex() &&
+          otherIt->format == it->format) {
+        sourceIndex = it.GetIndex();
+        sourceOccupancy = occupancy;
+        break;
+      }
+    }
+  }
+  if (sourceIndex == INDEX_NONE) {
+    return;
+  }
+
+  // Find room for all of its tiles in the other pages, or give up.
+  struct Move {
+    int32 entry;
+    int32 page;
+    CesiumAtlasAllocator::Block block;
+  };
+  TArray<Move> moves;
+  const Page& source = this->_pages[sourceIndex];
+  for (auto entryIt = this->_entries.CreateConstIterator(); entryIt;
+       ++entryIt) {
+    if (entryIt->page != sourceIndex) {
+      continue;
+    }
+
+    std::optional<Move> move;
+    for (auto pageIt = this->_pages.CreateIterator(); pageIt && !move;
+         ++pageIt) {
+      if (pageIt.GetIndex() == sourceIndex ||
+          pageIt->format != source.format) {
+        continue;
+      }
+      std::optional<CesiumAtlasAllocator::Block> block =
+          pageIt->allocator.allocate(entryIt->width, entryIt->height);
+      if (block) {
+        move = Move{entryIt.GetIndex(), pageIt.GetIndex(), *block};
+      }
+    }
+
+    if (!move) {
+      for (const Move& undo : moves) {
+        this->_pages[undo.page].allocator.free(undo.block);
+      }
+      return;
+    }
+    moves.Add(*move);
+  }
+
+  // Copy the tiles on the GPU. The source page is destroyed below, but its
+  // resource is only released after this command runs.
+  struct Copy {
+    FTextureResource* pDestination;
+    CesiumAtlasAllocator::Block from;
+    CesiumAtlasAllocator::Block to;
+  };
+  TArray<Copy> copies;
+  for (const Move& move : moves) {
+    copies.Add(Copy{
+        this->_pages[move.page].pTexture->GetResource(),
+        this->_entries[move.entry].block,
+        move.block});
+  }
+
+  ENQUEUE_RENDER_COMMAND(Cesium_DefragmentRasterOverlayAtlas)
+  ([pSource = source.pTexture->GetResource(),
+    mipCount = source.format.mipCount,
+    copies = MoveTemp(copies)](FRHICommandListImmediate& RHICmdList) {
+    FRHITexture* pSourceTexture = pSource->TextureRHI;
+    if (!pSourceTexture) {
+      return;
+    }
+
+    for (const Copy& copy : copies) {
+      FRHITexture* pDestinationTexture = copy.pDestination->TextureRHI;
+      if (!pDestinationTexture) {
+        continue;
+      }
+
+      RHICmdList.Transition(
+          {FRHITransitionInfo(
+               pSourceTexture,
+               ERHIAccess::SRVMask,
+               ERHIAccess::CopySrc),
+           FRHITransitionInfo(
+               pDestinationTexture,
+               ERHIAccess::SRVMask,
+               ERHIAccess::CopyDest)});
+
+      for (int32 i = 0; i < mipCount; ++i) {
+        FRHICopyTextureInfo copyInfo;
+        copyInfo.Size =
+            FIntVector(copy.from.width >> i, copy.from.height >> i, 1);
+        copyInfo.SourcePosition =
+            FIntVector(copy.from.x >> i, copy.from.y >> i, 0);
+        copyInfo.DestPosition = FIntVector(copy.to.x >> i, copy.to.y >> i, 0);
+        copyInfo.SourceMipIndex = uint32(i);
+        copyInfo.DestMipIndex = uint32(i);
+        copyInfo.NumMips = 1;
+        RHICmdList.CopyTexture(pSourceTexture, pDestinationTexture, copyInfo);
+      }
+
+      RHICmdList.Transition(
+          {FRHITransitionInfo(
+               pSourceTexture,
+               ERHIAccess::CopySrc,
+               ERHIAccess::SRVMask),
+           FRHITransitionInfo(
+               pDestinationTexture,
+               ERHIAccess::CopyDest,
+               ERHIAccess::SRVMask)});
+    }
+  });
+
+  // Attach the moved tiles again with their new rectangles.
+  for (const Move& move : moves) {
+    Entry& entry = this->_entries[move.entry];
+    entry.page = move.page;
+    entry.block = move.block;
+    for (const Attachment& attachment : entry.attachments) {
+      if (attachment.pGltf.IsValid()) {
+        this->attachToGltf(entry, attachment);
+        reattached.AddUnique(attachment.pGltf.Get());
+      }
+    }
+  }
+
+  this->destroyPage(sourceIndex);
+}
+
+/*static*/ std::pair<glm::dvec2, glm::dvec2>
+CesiumRasterOverlayAtlas::computeTranslationAndScale(
+    const CesiumAtlasAllocator::Block& block,
+    const Content& content,
+    const glm::dvec2& translation,
+    const glm::dvec2& scale) {
+  // Overlay texture coordinates are computed as
+  // `textureCoordinates * scale + translation`, so mapping [0, 1] to the
+  // tile's rectangle afterward is another scale and translation. The padding
+  // around the rectangle stands in for clamping, so it isn't inset.
+  const double pageSize = double(PageSize);
+  const glm::dvec2 origin(
+      double(block.x + content.offset) / pageSize,
+      double(block.y + content.offset) / pageSize);
+  const glm::dvec2 size(
+      double(content.width) / pageSize,
+      double(content.height) / pageSize);
+  return {origin + size * translation, size * scale};
+}
+
+void CesiumRasterOverlayAtlas::AddReferencedObjects(
+    FReferenceCollector& Collector) {
+  for (Page& page : this->_pages) {
+    Collector.AddReferencedObject(page.pTexture);
+  }
+}
+
+FString CesiumRasterOverlayAtlas::GetReferencerName() const {
+  return TEXT("CesiumRasterOverlayAtlas");
+}
+
+int32 CesiumRasterOverlayAtlas::addPage(const PageFormat& format) {
+  UTexture2D* pTexture = NewObject<UTexture2D>(
+      GetTransientPackage(),
+      MakeUniqueObjectName(
+          GetTransientPackage(),
+          UTexture2D::StaticClass(),
+          "CesiumRasterOverlayAtlas"),
+      RF_Transient | RF_DuplicateTransient | RF_TextExportTransient);
+
+  pTexture->AddressX = TextureAddress::TA_Clamp;
+  pTexture->AddressY = TextureAddress::TA_Clamp;
+  pTexture->Filter = format.filter;
+  pTexture->LODGroup = format.group;
+  pTexture->SRGB = format.sRGB;
+  pTexture->NeverStream = true;
+
+  FCesiumTextureResourceUniquePtr pResource =
+      FCesiumTextureResource::CreateEmpty(
+          format.group,
+          uint32(PageSize),
+          uint32(PageSize),
+          format.format,
+          format.filter,
+          TextureAddress::TA_Clamp,
+          TextureAddress::TA_Clamp,
+          format.sRGB,
+          uint32(format.mipCount));
+  const int64 sizeBytes = int64(pResource->GetMemorySize());
+  INC_MEMORY_STAT_BY(STAT_CesiumRasterOverlayAtlasMemory, sizeBytes);
+
+  // Give the UTexture2D exclusive ownership of the resource.
+  pTexture->SetResource(pResource.Release());
+  ENQUEUE_RENDER_COMMAND(Cesium_InitResource)
+  ([pTexture, pTextureResource = pTexture->GetResource()](
+       FRHICommandListImmediate& RHICmdList) {
+    pTextureResource->SetTextureReference(
+        pTexture->TextureReference.TextureReferenceRHI);
+    pTextureResource->InitResource(FRHICommandListImmediate::Get());
+  });
+
+  return this->_pages.Add(Page{
+      format,
+      pTexture,
+      CesiumAtlasAllocator(PageSize, computeGranularity(format.mipCount)),
+      sizeBytes});
+}
+
+void CesiumRasterOverlayAtlas::destroyPage(int32 pageIndex) {
+  Page& page = this->_pages[pageIndex];
+  DEC_MEMORY_STAT_BY(STAT_CesiumRasterOverlayAtlasMemory, page.sizeBytes);
+  CesiumLifetime::destroy(page.pTexture);
+  this->_pages.RemoveAt(pageIndex);
+}
+
+void CesiumRasterOverlayAtlas::attachToGltf(
+    const Entry& entry,
+    const Attachment& attachment) const {
+  const auto [translation, scale] = computeTranslationAndScale(
+      entry.block,
+      entry.content,
+      attachment.translation,
+      attachment.scale);
+  attachment.pGltf->AttachRasterTile(
+      *attachment.pTile,
+      *attachment.pRasterTile,
+      this->_pages[entry.page].pTexture,
+      translation,
+      scale,
+      attachment.textureCoordinateID);
+}
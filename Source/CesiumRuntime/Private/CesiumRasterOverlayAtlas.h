@@ -0,0 +1,323 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "CesiumAtlasAllocator.h"
+#include "Containers/Array.h"
+#include "Containers/SparseArray.h"
+#include "Engine/TextureDefines.h"
+#include "PixelFormat.h"
+#include "UObject/GCObject.h"
+#include "UObject/ObjectPtr.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include <CesiumGltf/ImageAsset.h>
+#include <glm/vec2.hpp>
+#include <optional>
+#include <vector>
+
+class UCesiumGltfComponent;
+class UTexture2D;
+
+namespace Cesium3DTilesSelection {
+class Tile;
+}
+
+namespace CesiumRasterOverlays {
+class RasterOverlayTile;
+}
+
+/**
+ * @brief A per-tileset atlas of raster overlay tiles.
+ *
+ * Instead of each raster overlay tile getting its own texture, tiles are packed
+ * into large, shared atlas pages, so that the materials of many geometry tiles
+ * bind the same few textures. A page holds tiles with the same pixel format,
+ * sampler, and mip count. Space in a page is handed out by a
+ * {@link CesiumAtlasAllocator}, and tiles are copied into it on the render
+ * thread.
+ *
+ * An attached overlay tile's translation and scale are combined with its
+ * rectangle in the page, so the materials need no extra parameters. Tiles are
+ * padded with copies of their edge texels before their mipmaps are generated,
+ * so that filtering at their edges, in every mip, samples the padding as it
+ * would sample a clamped edge, rather than neighboring tiles.
+ *
+ * As overlay tiles are unloaded, pages can be left sparsely used. Pages whose
+ * tiles fit into the other pages of the same kind are emptied by
+ * {@link defragment}, which copies the tiles on the GPU, and are then
+ * destroyed.
+ *
+ * Apart from {@link takeImage}, this class may only be used from the game
+ * thread.
+ */
+class CesiumRasterOverlayAtlas : public FGCObject {
+public:
+  /**
+   * @brief The width and height of each page, in texels.
+   */
+  static constexpr int32 PageSize = 4096;
+
+  /**
+   * @brief The number of mips in pages for mipmapped tiles. Each additional
+   * mip doubles the granularity of the tiles' positions and sizes in the page.
+   * See {@link computeGranularity}.
+   */
+  static constexpr int32 MaximumMipCount = 5;
+
+  /**
+   * @brief The largest width and height of a compressed block, in texels.
+   * Padded images are sized so that each of their mips is a whole number of
+   * these blocks.
+   */
+  static constexpr int32 CompressedBlockSize = 4;
+
+  /**
+   * @brief Pages that are less full than this are emptied by
+   * {@link defragment} when their tiles fit in other pages.
+   */
+  static constexpr double DefragmentOccupancy = 0.25;
+
+  /**
+   * @brief Where a raster overlay tile's own texels are in its padded image.
+   */
+  struct Content {
+    /**
+     * @brief The number of texels of padding to the left of and above the
+     * tile.
+     */
+    int32 offset;
+
+    /**
+     * @brief The width of the tile, in texels.
+     */
+    int32 width;
+
+    /**
+     * @brief The height of the tile, in texels.
+     */
+    int32 height;
+  };
+
+  /**
+   * @brief The pixels of a raster overlay tile that is waiting to be added to
+   * the atlas.
+   */
+  struct Image {
+    /**
+     * @brief The width of the padded image, in texels.
+     */
+    int32 width;
+
+    /**
+     * @brief The height of the padded image, in texels.
+     */
+    int32 height;
+
+    Content content;
+    EPixelFormat format;
+    bool sRGB;
+    TextureFilter filter;
+    TextureGroup group;
+
+    /**
+     * @brief The number of mips to copy into the atlas, which is either 1 or
+     * {@link MaximumMipCount}.
+     */
+    int32 mipCount;
+
+    std::vector<CesiumGltf::ImageAssetMipPosition> mipPositions;
+    std::vector<std::byte> pixelData;
+  };
+
+  /**
+   * @brief Computes the number of texels of padding needed on each side of a
+   * tile, which is one texel in its last mip.
+   *
+   * @param mipCount The number of mips of the tile.
+   */
+  static int32 computePadding(int32 mipCount) { return 1 << (mipCount - 1); }
+
+  /**
+   * @brief Computes the multiple to which the positions and sizes of tiles in
+   * a page are rounded, which is one compressed block in its last mip. This
+   * keeps every mip of a tile a whole number of compressed blocks, none of
+   * which are shared with another tile.
+   *
+   * @param mipCount The number of mips of the page.
+   */
+  static int32 computeGranularity(int32 mipCount) {
+    return CompressedBlockSize << (mipCount - 1);
+  }
+
+  /**
+   * @brief Pads a raster overlay image with copies of its edge texels, before
+   * its mipmaps are generated, so that it can be added to an atlas. This may
+   * be called from any thread.
+   *
+   * The image is padded by {@link computePadding} texels to the left and
+   * above, and by at least that much to the right and below, so that its size
+   * is a multiple of {@link computeGranularity}.
+   *
+   * Images that are compressed, already have mipmaps, have more than one byte
+   * per channel, have three channels, or wouldn't fit in a page once padded
+   * are left unchanged, and should be given their own textures instead.
+   *
+   * @param image The image.
+   * @param useMipMaps Whether the image will be sampled with its mipmaps.
+   * @return Where the tile is in the padded image, or std::nullopt if it
+   * wasn't padded.
+   */
+  static std::optional<Content>
+  padImage(CesiumGltf::ImageAsset& image, bool useMipMaps);
+
+  /**
+   * @brief Takes the pixel data of a raster overlay image, after it is padded
+   * by {@link padImage}, its mipmaps are generated, and it is compressed, so
+   * that it can be added to an atlas. This may be called from any thread.
+   *
+   * Images larger than a page, or whose compressed blocks wouldn't line up
+   * with the blocks of the pages, are left unchanged, and should be given
+   * their own textures instead. Neither happens to an image padded by
+   * {@link padImage}. Images with too few mips are added without mipmaps.
+   *
+   * @param image The image.
+   * @param content Where the tile is in the padded image.
+   * @param format The pixel format of the image.
+   * @param sRGB Whether the image is sRGB-encoded.
+   * @param useMipMaps Whether the image is sampled with its mipmaps.
+   * @param filter The filtering to use when sampling the image.
+   * @param group The texture group of the image.
+   * @return The image to pass to {@link add}, or std::nullopt if it can't be
+   * added to an atlas.
+   */
+  static std::optional<Image> takeImage(
+      CesiumGltf::ImageAsset& image,
+      const Content& content,
+      EPixelFormat format,
+      bool sRGB,
+      bool useMipMaps,
+      TextureFilter filter,
+      TextureGroup group);
+
+  CesiumRasterOverlayAtlas();
+  ~CesiumRasterOverlayAtlas();
+
+  /**
+   * @brief Adds an image to a page with room for it, creating a new page if
+   * necessary.
+   *
+   * @return The handle of the tile in the atlas.
+   */
+  int32 add(Image&& image);
+
+  /**
+   * @brief Removes a tile from the atlas, destroying its page if it was the
+   * last tile in it. The tile must have been detached from all geometry tiles.
+   */
+  void remove(int32 handle);
+
+  /**
+   * @brief Attaches a tile of the atlas to a geometry tile with
+   * {@link UCesiumGltfComponent::AttachRasterTile}. The attachment is recorded
+   * so that it can be updated if the tile is moved to another page.
+   */
+  void attach(
+      int32 handle,
+      UCesiumGltfComponent& gltf,
+      const Cesium3DTilesSelection::Tile& tile,
+      const CesiumRasterOverlays::RasterOverlayTile& rasterTile,
+      const glm::dvec2& translation,
+      const glm::dvec2& scale,
+      int32 textureCoordinateID);
+
+  /**
+   * @brief Detaches a tile of the atlas from a geometry tile with
+   * {@link UCesiumGltfComponent::DetachRasterTile}.
+   */
+  void detach(
+      int32 handle,
+      UCesiumGltfComponent& gltf,
+      const Cesium3DTilesSelection::Tile& tile,
+      const CesiumRasterOverlays::RasterOverlayTile& rasterTile);
+
+  /**
+   * @brief Empties and destroys at most one sparsely-used page by moving its
+   * tiles to other pages. This does nothing unless a tile was removed since
+   * the last call.
+   *
+   * @param reattached Receives the geometry tiles whose raster overlays were
+   * attached again with new parameters. Their raster tile updates must be
+   * applied.
+   */
+  void defragment(TArray<UCesiumGltfComponent*>& reattached);
+
+  /**
+   * @brief Computes the translation and scale that map a geometry tile's
+   * texture coordinates to an overlay tile's rectangle in its page.
+   *
+   * @param block The overlay tile's block in the page.
+   * @param content Where the overlay tile is in its block.
+   * @param translation The translation to the overlay tile's own texture
+   * coordinates.
+   * @param scale The scale to the overlay tile's own texture coordinates.
+   * @return The translation and scale to the page's texture coordinates.
+   */
+  static std::pair<glm::dvec2, glm::dvec2> computeTranslationAndScale(
+      const CesiumAtlasAllocator::Block& block,
+      const Content& content,
+      const glm::dvec2& translation,
+      const glm::dvec2& scale);
+
+  int32 getPageCount() const { return this->_pages.Num(); }
+  int32 getTileCount() const { return this->_entries.Num(); }
+
+  // FGCObject overrides
+  virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+  virtual FString GetReferencerName() const override;
+
+private:
+  struct PageFormat {
+    EPixelFormat format;
+    bool sRGB;
+    TextureFilter filter;
+    TextureGroup group;
+    int32 mipCount;
+
+    bool operator==(const PageFormat& rhs) const = default;
+  };
+
+  struct Page {
+    PageFormat format;
+    TObjectPtr<UTexture2D> pTexture;
+    CesiumAtlasAllocator allocator;
+    int64 sizeBytes;
+  };
+
+  struct Attachment {
+    TWeakObjectPtr<UCesiumGltfComponent> pGltf;
+    const Cesium3DTilesSelection::Tile* pTile;
+    const CesiumRasterOverlays::RasterOverlayTile* pRasterTile;
+    glm::dvec2 translation;
+    glm::dvec2 scale;
+    int32 textureCoordinateID;
+  };
+
+  struct Entry {
+    int32 page;
+    CesiumAtlasAllocator::Block block;
+    int32 width;
+    int32 height;
+    Content content;
+    TArray<Attachment> attachments;
+  };
+
+  int32 addPage(const PageFormat& format);
+  void destroyPage(int32 page);
+  void attachToGltf(const Entry& entry, const Attachment& attachment) const;
+
+  TSparseArray<Page> _pages;
+  TSparseArray<Entry> _entries;
+
+  // Whether a tile was removed since the last call to defragment.
+  bool _defragmentPending;
+};
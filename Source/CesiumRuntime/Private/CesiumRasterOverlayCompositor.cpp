@@ -0,0 +1,263 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumRasterOverlayCompositor.h"
+#include "Engine/Texture.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "GenerateMips.h"
+#include "GlobalShader.h"
+#include "PixelShaderUtils.h"
+#include "RHIStaticStates.h"
+#include "RenderGraphBuilder.h"
+#include "RenderGraphUtils.h"
+#include "RenderTargetPool.h"
+#include "RenderingThread.h"
+#include "ShaderParameterStruct.h"
+#include "TextureResource.h"
+
+namespace {
+
+class FCesiumRasterOverlayCompositePS : public FGlobalShader {
+public:
+  DECLARE_GLOBAL_SHADER(FCesiumRasterOverlayCompositePS);
+  SHADER_USE_PARAMETER_STRUCT(FCesiumRasterOverlayCompositePS, FGlobalShader);
+
+  BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+  SHADER_PARAMETER_TEXTURE_ARRAY(
+      Texture2D,
+      Layers,
+      [CesiumRasterOverlayCompositor::MaximumLayerCount])
+  SHADER_PARAMETER_ARRAY(
+      FVector4f,
+      TranslationScales,
+      [CesiumRasterOverlayCompositor::MaximumLayerCount])
+  SHADER_PARAMETER_SAMPLER(SamplerState, LayerSampler)
+  SHADER_PARAMETER(FVector2f, OutputInvSize)
+  SHADER_PARAMETER(uint32, LayerCount)
+  RENDER_TARGET_BINDING_SLOTS()
+  END_SHADER_PARAMETER_STRUCT()
+
+  static void ModifyCompilationEnvironment(
+      const FGlobalShaderPermutationParameters& Parameters,
+      FShaderCompilerEnvironment& OutEnvironment) {
+    FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+    OutEnvironment.SetDefine(
+        TEXT("MAX_LAYERS"),
+        CesiumRasterOverlayCompositor::MaximumLayerCount);
+  }
+};
+
+IMPLEMENT_GLOBAL_SHADER(
+    FCesiumRasterOverlayCompositePS,
+    "/Plugin/CesiumForUnreal/Private/CesiumRasterOverlayComposite.usf",
+    "MainPS",
+    SF_Pixel);
+
+struct LayerResource {
+  FTextureResource* pResource;
+  FVector4f translationAndScale;
+};
+
+} // namespace
+
+namespace CesiumRasterOverlayCompositor {
+
+TArray<Run> findRuns(TArrayView<const LayerInput> layers) {
+  TArray<Run> runs;
+
+  int32 first = INDEX_NONE;
+  int32 last = INDEX_NONE;
+  int32 compositedCount = 0;
+  int32 textureCoordinateID = -1;
+
+  auto finishRun = [&]() {
+    if (compositedCount >= 2) {
+      runs.Add(Run{first, last - first + 1});
+    }
+    first = INDEX_NONE;
+    compositedCount = 0;
+  };
+
+  for (int32 i = 0; i < layers.Num(); ++i) {
+    const LayerInput& layer = layers[i];
+    if (layer.kind == LayerKind::Live) {
+      finishRun();
+      continue;
+    }
+    if (layer.kind == LayerKind::Empty) {
+      continue;
+    }
+
+    if (first != INDEX_NONE &&
+        (layer.textureCoordinateID != textureCoordinateID ||
+         compositedCount == MaximumLayerCount)) {
+      finishRun();
+    }
+    if (first == INDEX_NONE) {
+      first = i;
+      textureCoordinateID = layer.textureCoordinateID;
+    }
+    last = i;
+    ++compositedCount;
+  }
+  finishRun();
+
+  return runs;
+}
+
+int32 findComposite(
+    TArrayView<const Composite> composites,
+    TArrayView<const Layer> layers,
+    int32 textureCoordinateID) {
+  for (int32 i = 0; i < composites.Num(); ++i) {
+    const Composite& composite = composites[i];
+    if (composite.textureCoordinateID != textureCoordinateID ||
+        composite.layers.Num() != layers.Num()) {
+      continue;
+    }
+    bool same = true;
+    for (int32 layer = 0; same && layer < layers.Num(); ++layer) {
+      same = composite.layers[layer] == layers[layer];
+    }
+    if (same) {
+      return i;
+    }
+  }
+  return INDEX_NONE;
+}
+
+int32 computeSize(double texels, double screenPixels) {
+  const double target = FMath::Min(texels, screenPixels);
+  int32 size = MinimumSize;
+  while (size < MaximumSize && double(size) < target) {
+    size *= 2;
+  }
+  return size;
+}
+
+int64 computeBytes(int32 width, int32 height) {
+  // Composites are RGBA8 with a full mip chain, which adds a third to the
+  // size of the top level.
+  const int64 topLevelBytes = int64(width) * int64(height) * 4;
+  return topLevelBytes + topLevelBytes / 3;
+}
+
+UTextureRenderTarget2D* composite(
+    UObject& outer,
+    TArrayView<const Layer> layers,
+    UTextureRenderTarget2D* pExisting,
+    double screenPixels) {
+  check(layers.Num() <= MaximumLayerCount);
+
+  // Match the resolution of the most detailed overlay tile over the geometry
+  // tile, up to the size of the viewport.
+  double texelsX = 0.0;
+  double texelsY = 0.0;
+  TArray<LayerResource, TInlineAllocator<MaximumLayerCount>> resources;
+  for (const Layer& layer : layers) {
+    FTextureResource* pResource = layer.pTexture->GetResource();
+    if (!pResource) {
+      continue;
+    }
+    texelsX = FMath::Max(
+        texelsX,
+        double(pResource->GetSizeX()) *
+            FMath::Abs(layer.translationAndScale.Z));
+    texelsY = FMath::Max(
+        texelsY,
+        double(pResource->GetSizeY()) *
+            FMath::Abs(layer.translationAndScale.W));
+    resources.Add(LayerResource{
+        pResource,
+        FVector4f(layer.translationAndScale)});
+  }
+
+  const int32 width = computeSize(texelsX, screenPixels);
+  const int32 height = computeSize(texelsY, screenPixels);
+
+  UTextureRenderTarget2D* pTarget = pExisting;
+  if (!pTarget || pTarget->SizeX != width || pTarget->SizeY != height) {
+    pTarget = NewObject<UTextureRenderTarget2D>(
+        &outer,
+        NAME_None,
+        RF_Transient | RF_DuplicateTransient | RF_TextExportTransient);
+    pTarget->RenderTargetFormat = RTF_RGBA8_SRGB;
+    pTarget->ClearColor = FLinearColor::Transparent;
+    pTarget->AddressX = TextureAddress::TA_Clamp;
+    pTarget->AddressY = TextureAddress::TA_Clamp;
+    pTarget->bAutoGenerateMips = true;
+    pTarget->InitAutoFormat(width, height);
+  }
+
+  FTextureRenderTargetResource* pTargetResource =
+      pTarget->GameThread_GetRenderTargetResource();
+  if (!pTargetResource) {
+    return pTarget;
+  }
+
+  ENQUEUE_RENDER_COMMAND(Cesium_CompositeRasterOverlays)
+  ([pTargetResource, width, height, resources = MoveTemp(resources)](
+       FRHICommandListImmediate& RHICmdList) {
+    FRHITexture* pTargetTexture = pTargetResource->GetRenderTargetTexture();
+    if (!pTargetTexture) {
+      return;
+    }
+
+    FRDGBuilder GraphBuilder(RHICmdList);
+    FRDGTextureRef output = GraphBuilder.RegisterExternalTexture(
+        CreateRenderTarget(
+            pTargetTexture,
+            TEXT("CesiumRasterOverlayComposite")));
+
+    FCesiumRasterOverlayCompositePS::FParameters* pParameters =
+        GraphBuilder
+            .AllocParameters<FCesiumRasterOverlayCompositePS::FParameters>();
+
+    // Unused slots still need a texture bound, even though they're never
+    // sampled.
+    uint32 layerCount = 0;
+    for (int32 i = 0; i < MaximumLayerCount; ++i) {
+      pParameters->Layers[i] = GBlackTexture->TextureRHI;
+      pParameters->TranslationScales[i] = FVector4f(0.0f, 0.0f, 1.0f, 1.0f);
+    }
+    for (const LayerResource& layer : resources) {
+      if (!layer.pResource->TextureRHI) {
+        continue;
+      }
+      pParameters->Layers[layerCount] = layer.pResource->TextureRHI;
+      pParameters->TranslationScales[layerCount] = layer.translationAndScale;
+      ++layerCount;
+    }
+
+    pParameters->LayerSampler =
+        TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::
+            GetRHI();
+    pParameters->OutputInvSize = FVector2f(1.0f / width, 1.0f / height);
+    pParameters->LayerCount = layerCount;
+    pParameters->RenderTargets[0] =
+        FRenderTargetBinding(output, ERenderTargetLoadAction::ENoAction);
+
+    FGlobalShaderMap* pShaderMap = GetGlobalShaderMap(GMaxRHIFeatureLevel);
+    TShaderMapRef<FCesiumRasterOverlayCompositePS> pixelShader(pShaderMap);
+    FPixelShaderUtils::AddFullscreenPass(
+        GraphBuilder,
+        pShaderMap,
+        RDG_EVENT_NAME("CesiumRasterOverlayComposite"),
+        pixelShader,
+        pParameters,
+        FIntRect(0, 0, width, height));
+
+    if (output->Desc.NumMips > 1) {
+      FGenerateMips::Execute(
+          GraphBuilder,
+          GMaxRHIFeatureLevel,
+          output,
+          FGenerateMipsParams{SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp});
+    }
+
+    GraphBuilder.Execute();
+  });
+
+  return pTarget;
+}
+
+} // namespace CesiumRasterOverlayCompositor
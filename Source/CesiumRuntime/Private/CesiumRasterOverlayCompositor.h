@@ -0,0 +1,190 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/ArrayView.h"
+#include "HAL/Platform.h"
+#include "Math/Vector4.h"
+
+class UObject;
+class UTexture;
+class UTextureRenderTarget2D;
+
+/**
+ * Blends the raster overlays attached to a geometry tile into a single texture
+ * on the GPU, so that its material samples one texture rather than one per
+ * overlay layer.
+ *
+ * The overlays are blended with the "over" operator in the order of their
+ * material layers, from the bottom of the layer stack up, which gives the same
+ * result as blending the layers in the material. Each overlay tile is sampled
+ * with its own translation and scale, so the composite covers the geometry
+ * tile's texture coordinates from 0 to 1.
+ *
+ * Apart from {@link composite}, nothing here depends on the renderer.
+ */
+namespace CesiumRasterOverlayCompositor {
+
+/**
+ * The maximum number of overlays blended into one composite. Longer runs of
+ * layers are split into several composites.
+ */
+constexpr int32 MaximumLayerCount = 8;
+
+/**
+ * The smallest width or height of a composite, in texels.
+ */
+constexpr int32 MinimumSize = 64;
+
+/**
+ * The largest width or height of a composite, in texels.
+ */
+constexpr int32 MaximumSize = 2048;
+
+/**
+ * How a material layer takes part in compositing.
+ */
+enum class LayerKind : uint8 {
+  /**
+   * The layer doesn't belong to an overlay, or belongs to a dynamic one. It is
+   * left as it is, and layers on either side of it aren't blended together.
+   */
+  Live,
+
+  /**
+   * The layer belongs to an overlay with no tile attached, so it is
+   * transparent and may be skipped over.
+   */
+  Empty,
+
+  /**
+   * The layer belongs to an overlay whose tile may be blended into a
+   * composite.
+   */
+  Composited
+};
+
+/**
+ * A material layer to consider for compositing.
+ */
+struct LayerInput {
+  LayerKind kind;
+
+  /**
+   * The overlay texture coordinate set used by the layer's overlay tile. Only
+   * layers with the same set can be blended together.
+   */
+  int32 textureCoordinateID;
+};
+
+/**
+ * A run of adjacent material layers that are blended into one composite.
+ */
+struct Run {
+  /**
+   * The index of the run's first layer, which is always a
+   * {@link LayerKind::Composited} layer.
+   */
+  int32 firstLayer;
+
+  /**
+   * The number of layers in the run, including any empty layers between its
+   * first and last composited layers.
+   */
+  int32 layerCount;
+};
+
+/**
+ * An overlay tile to blend into a composite.
+ */
+struct Layer {
+  UTexture* pTexture;
+
+  /**
+   * The translation (XY) and scale (ZW) from the geometry tile's texture
+   * coordinates to the overlay tile's.
+   */
+  FVector4 translationAndScale;
+
+  bool operator==(const Layer& rhs) const = default;
+};
+
+/**
+ * A composite made for one run of material layers. Primitives of the same
+ * geometry tile whose materials have the same run share the composite.
+ */
+struct Composite {
+  /**
+   * The overlay tiles blended into the composite, from the bottom up.
+   */
+  TArray<Layer, TInlineAllocator<MaximumLayerCount>> layers;
+
+  /**
+   * The overlay texture coordinate set shared by the run's layers.
+   */
+  int32 textureCoordinateID;
+
+  UTextureRenderTarget2D* pTarget;
+};
+
+/**
+ * Finds the runs of material layers worth compositing. A run ends at a live
+ * layer, at a layer whose overlay uses other texture coordinates, or once it
+ * has {@link MaximumLayerCount} composited layers. Runs with fewer than two
+ * composited layers are left out, as compositing them would save nothing.
+ *
+ * @param layers The material's layers, from the bottom of the stack up.
+ * @return The runs, in layer order.
+ */
+TArray<Run> findRuns(TArrayView<const LayerInput> layers);
+
+/**
+ * Finds the composite of the given overlay tiles, sampled with the given
+ * texture coordinates.
+ *
+ * @return The index of the composite, or `INDEX_NONE` if there is none.
+ */
+int32 findComposite(
+    TArrayView<const Composite> composites,
+    TArrayView<const Layer> layers,
+    int32 textureCoordinateID);
+
+/**
+ * Computes the width or height of a composite that covers the given number of
+ * overlay texels, rounded up to a power of two between {@link MinimumSize} and
+ * {@link MaximumSize}.
+ *
+ * @param texels The number of overlay texels across the geometry tile.
+ * @param screenPixels The number of pixels across the largest viewport. A
+ * tile never covers more than the viewport before it is refined, so a
+ * composite is never made larger than needed to match it.
+ */
+int32 computeSize(double texels, double screenPixels);
+
+/**
+ * Computes the number of bytes used by a composite of the given size,
+ * including its mipmaps.
+ */
+int64 computeBytes(int32 width, int32 height);
+
+/**
+ * Blends overlay tiles into a render target on the render thread, then
+ * generates its mipmaps. This must be called from the game thread.
+ *
+ * @param outer The object that owns the render target.
+ * @param layers The overlay tiles to blend, from the bottom up. There may be
+ * at most {@link MaximumLayerCount}.
+ * @param pExisting A composite to render into again if it has the right size,
+ * or nullptr.
+ * @param screenPixels The number of pixels across the largest viewport, which
+ * bounds the size of the composite. See {@link computeSize}.
+ * @return The composite, which is either `pExisting` or a new render target.
+ */
+UTextureRenderTarget2D* composite(
+    UObject& outer,
+    TArrayView<const Layer> layers,
+    UTextureRenderTarget2D* pExisting,
+    double screenPixels);
+
+} // namespace CesiumRasterOverlayCompositor
@@ -0,0 +1,24 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumRasterOverlayParameterNames.h"
+
+TSharedPtr<const CesiumRasterOverlayParameterNames>
+CesiumRasterOverlayParameterNameCache::find(
+    const std::string& overlayName) const {
+  auto it = this->_namesByOverlay.find(overlayName);
+  if (it == this->_namesByOverlay.end()) {
+    return nullptr;
+  }
+  return it->second;
+}
+
+void CesiumRasterOverlayParameterNameCache::add(
+    const std::string& overlayName,
+    const TSharedRef<const CesiumRasterOverlayParameterNames>& pNames) {
+  this->_namesByOverlay.insert_or_assign(overlayName, pNames);
+}
+
+void CesiumRasterOverlayParameterNameCache::remove(
+    const std::string& overlayName) {
+  this->_namesByOverlay.erase(overlayName);
+}
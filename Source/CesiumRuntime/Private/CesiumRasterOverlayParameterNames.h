@@ -0,0 +1,78 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Containers/UnrealString.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/NameTypes.h"
+#include <string>
+#include <unordered_map>
+
+/**
+ * @brief The names, derived from a raster overlay's name, through which a
+ * tile's materials receive the overlay.
+ */
+struct CesiumRasterOverlayParameterNames {
+  /**
+   * The overlay's name, which is matched against the layer names of materials
+   * that use material layers.
+   */
+  FString layerName;
+
+  /**
+   * The names of the parameters that receive the overlay in materials that
+   * don't use material layers.
+   */
+  FName texture;
+  FName translationScale;
+  FName textureCoordinateIndex;
+};
+
+/**
+ * @brief A per-tileset cache of the parameter names of its raster overlays,
+ * so that they are created once per overlay rather than for every primitive of
+ * every tile.
+ *
+ * An overlay's names are removed when the overlay is removed from the tileset.
+ * Tiles that still refer to them keep them alive until they are done with
+ * them.
+ *
+ * This class may only be used from the game thread.
+ */
+class CesiumRasterOverlayParameterNameCache {
+public:
+  /**
+   * @brief Finds the names of the overlay with the given name.
+   *
+   * @return The names, or nullptr if they haven't been added.
+   */
+  TSharedPtr<const CesiumRasterOverlayParameterNames>
+  find(const std::string& overlayName) const;
+
+  /**
+   * @brief Adds the names of the overlay with the given name, replacing any
+   * that were added before.
+   */
+  void add(
+      const std::string& overlayName,
+      const TSharedRef<const CesiumRasterOverlayParameterNames>& pNames);
+
+  /**
+   * @brief Removes the names of the overlay with the given name, if there are
+   * any.
+   */
+  void remove(const std::string& overlayName);
+
+  /**
+   * @brief Gets the number of overlays whose names are in this cache.
+   */
+  int32 getOverlayCount() const {
+    return static_cast<int32>(this->_namesByOverlay.size());
+  }
+
+private:
+  std::unordered_map<
+      std::string,
+      TSharedRef<const CesiumRasterOverlayParameterNames>>
+      _namesByOverlay;
+};
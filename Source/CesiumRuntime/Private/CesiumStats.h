@@ -0,0 +1,11 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Stats/Stats.h"
+
+/**
+ * The group for the stats reported by Cesium for Unreal, which can be shown
+ * with the `stat Cesium` console command.
+ */
+DECLARE_STATS_GROUP(TEXT("Cesium"), STATGROUP_Cesium, STATCAT_Advanced);
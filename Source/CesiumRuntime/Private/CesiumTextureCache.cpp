@@ -0,0 +1,308 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumTextureCache.h"
+#include "CesiumStats.h"
+#include "Hash/xxhash.h"
+#include "RenderingThread.h"
+#include <CesiumGltf/ImageAsset.h>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Cached Image Textures"),
+    STAT_CesiumCachedImageTextures,
+    STATGROUP_Cesium);
+DECLARE_MEMORY_STAT(
+    TEXT("Cached Image Texture Memory"),
+    STAT_CesiumCachedImageTextureMemory,
+    STATGROUP_Cesium);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Image Textures Deduplicated"),
+    STAT_CesiumImageTextureCacheHits,
+    STATGROUP_Cesium);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Textures Reused By Source"),
+    STAT_CesiumSourceTextureCacheHits,
+    STATGROUP_Cesium);
+
+namespace {
+
+struct Key {
+  uint64 pixelHashLow;
+  uint64 pixelHashHigh;
+  int32 width;
+  int32 height;
+  int32 channels;
+  int32 bytesPerChannel;
+  int32 compressedPixelFormat;
+  int32 overridePixelFormat;
+  ECesiumTextureCompression compression;
+  bool sRGB;
+  bool needsMipMaps;
+  bool streamMips;
+
+  bool operator==(const Key& rhs) const = default;
+};
+
+struct KeyHash {
+  size_t operator()(const Key& key) const {
+    // The pixel hash is already well-distributed, and images that differ only
+    // in their settings are rare.
+    return size_t(key.pixelHashLow) ^
+           (size_t(key.sRGB) | size_t(key.needsMipMaps) << 1 |
+            size_t(key.streamMips) << 2);
+  }
+};
+
+struct SourceKeyHash {
+  size_t operator()(const FXxHash128& key) const {
+    return size_t(key.HashLow);
+  }
+};
+
+struct Cache {
+  std::mutex mutex;
+  std::unordered_map<Key, TWeakPtr<FCesiumTextureResource>, KeyHash> entries;
+
+  // The textures found by caller-supplied source keys, and the source keys of
+  // each texture, so that they can be removed along with it.
+  std::unordered_map<
+      FXxHash128,
+      TWeakPtr<FCesiumTextureResource>,
+      SourceKeyHash>
+      sourceEntries;
+  std::unordered_map<const FCesiumTextureResource*, std::vector<FXxHash128>>
+      sourceKeysByTexture;
+};
+
+Cache& getCache() {
+  static Cache cache;
+  return cache;
+}
+
+Key computeKey(
+    const CesiumGltf::ImageAsset& image,
+    bool sRGB,
+    bool needsMipMaps,
+    const std::optional<EPixelFormat>& overridePixelFormat,
+    ECesiumTextureCompression compression,
+    bool streamMips) {
+  FXxHash128Builder builder;
+  builder.Update(image.pixelData.data(), image.pixelData.size());
+  builder.Update(
+      image.mipPositions.data(),
+      image.mipPositions.size() * sizeof(CesiumGltf::ImageAssetMipPosition));
+  const FXxHash128 hash = builder.Finalize();
+
+  return Key{
+      hash.HashLow,
+      hash.HashHigh,
+      image.width,
+      image.height,
+      image.channels,
+      image.bytesPerChannel,
+      int32(image.compressedPixelFormat),
+      overridePixelFormat ? int32(*overridePixelFormat) : -1,
+      compression,
+      sRGB,
+      needsMipMaps,
+      streamMips};
+}
+
+void releasePixelData(CesiumGltf::ImageAsset& image, int64 sizeBytes) {
+  // Calling clear() isn't good enough because it won't actually release the
+  // memory.
+  std::vector<std::byte> pixelData;
+  image.pixelData.swap(pixelData);
+  std::vector<CesiumGltf::ImageAssetMipPosition> mipPositions;
+  image.mipPositions.swap(mipPositions);
+  image.sizeBytes = sizeBytes;
+}
+
+void removeFromCache(
+    const std::optional<Key>& maybeKey,
+    const FCesiumTextureResource* pTexture) {
+  Cache& cache = getCache();
+  std::scoped_lock lock(cache.mutex);
+
+  // If another texture with the same key was created after this one expired,
+  // it has already taken this one's place.
+  if (maybeKey) {
+    auto it = cache.entries.find(*maybeKey);
+    if (it != cache.entries.end() && !it->second.IsValid()) {
+      cache.entries.erase(it);
+    }
+  }
+
+  auto sourceKeysIt = cache.sourceKeysByTexture.find(pTexture);
+  if (sourceKeysIt == cache.sourceKeysByTexture.end()) {
+    return;
+  }
+
+  for (const FXxHash128& sourceKey : sourceKeysIt->second) {
+    auto it = cache.sourceEntries.find(sourceKey);
+    if (it != cache.sourceEntries.end() && !it->second.IsValid()) {
+      cache.sourceEntries.erase(it);
+    }
+  }
+  cache.sourceKeysByTexture.erase(sourceKeysIt);
+}
+
+} // namespace
+
+namespace CesiumTextureCache {
+
+TSharedPtr<FCesiumTextureResource> getOrCreate(
+    CesiumGltf::ImageAsset& image,
+    bool sRGB,
+    bool needsMipMaps,
+    const std::optional<EPixelFormat>& overridePixelFormat,
+    ECesiumTextureCompression compression,
+    bool streamMips) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::GetOrCreateCachedTexture)
+
+  Cache& cache = getCache();
+
+  std::optional<Key> maybeKey;
+  if (!image.pixelData.empty()) {
+    maybeKey = computeKey(
+        image,
+        sRGB,
+        needsMipMaps,
+        overridePixelFormat,
+        compression,
+        streamMips);
+
+    TSharedPtr<FCesiumTextureResource> pExisting;
+    {
+      std::scoped_lock lock(cache.mutex);
+      auto it = cache.entries.find(*maybeKey);
+      if (it != cache.entries.end()) {
+        pExisting = it->second.Pin();
+      }
+    }
+
+    if (pExisting) {
+      INC_DWORD_STAT(STAT_CesiumImageTextureCacheHits);
+      releasePixelData(image, int64(pExisting->GetMemorySize()));
+      return pExisting;
+    }
+  }
+
+  FCesiumTextureResourceUniquePtr pCreated = FCesiumTextureResource::CreateNew(
+      image,
+      TextureGroup::TEXTUREGROUP_World,
+      overridePixelFormat,
+      TextureFilter::TF_Default,
+      TextureAddress::TA_Clamp,
+      TextureAddress::TA_Clamp,
+      sRGB,
+      needsMipMaps,
+      compression,
+      streamMips);
+  if (!pCreated) {
+    return nullptr;
+  }
+
+  const uint64 memorySize = pCreated->GetMemorySize();
+  INC_DWORD_STAT(STAT_CesiumCachedImageTextures);
+  INC_MEMORY_STAT_BY(STAT_CesiumCachedImageTextureMemory, memorySize);
+
+  TSharedPtr<FCesiumTextureResource> pResource = MakeShareable(
+      pCreated.Release(),
+      [maybeKey, memorySize](FCesiumTextureResource* p) {
+        removeFromCache(maybeKey, p);
+        DEC_DWORD_STAT(STAT_CesiumCachedImageTextures);
+        DEC_MEMORY_STAT_BY(STAT_CesiumCachedImageTextureMemory, memorySize);
+        FCesiumTextureResource::Destroy(p);
+      });
+
+  // This texture resource, created for an ImageAsset, will never have a
+  // UTexture2D, so its resources are initialized here rather than when a
+  // texture is created for it. This is done before it's added to the cache so
+  // that no other thread can wrap it first.
+  ENQUEUE_RENDER_COMMAND(Cesium_InitResource)
+  ([pResource](FRHICommandListImmediate& RHICmdList) {
+    pResource->InitResource(RHICmdList);
+  });
+
+  if (!maybeKey) {
+    return pResource;
+  }
+
+  TSharedPtr<FCesiumTextureResource> pExisting;
+  {
+    std::scoped_lock lock(cache.mutex);
+    auto [it, inserted] = cache.entries.try_emplace(*maybeKey, pResource);
+    if (!inserted) {
+      pExisting = it->second.Pin();
+      if (!pExisting) {
+        it->second = pResource;
+      }
+    }
+  }
+
+  // If another thread created the same texture at the same time, the one
+  // that's already in the cache is used, and this one is destroyed. That must
+  // happen outside of the lock, which its deleter takes.
+  return pExisting ? pExisting : pResource;
+}
+
+TSharedPtr<FCesiumTextureResource> getOrCreate(
+    const FXxHash128& sourceKey,
+    TFunctionRef<TSharedPtr<FCesiumTextureResource>()> create) {
+  Cache& cache = getCache();
+
+  {
+    std::scoped_lock lock(cache.mutex);
+    auto it = cache.sourceEntries.find(sourceKey);
+    if (it != cache.sourceEntries.end()) {
+      TSharedPtr<FCesiumTextureResource> pExisting = it->second.Pin();
+      if (pExisting) {
+        INC_DWORD_STAT(STAT_CesiumSourceTextureCacheHits);
+        return pExisting;
+      }
+    }
+  }
+
+  TSharedPtr<FCesiumTextureResource> pCreated = create();
+  if (!pCreated) {
+    return nullptr;
+  }
+
+  TSharedPtr<FCesiumTextureResource> pExisting;
+  {
+    std::scoped_lock lock(cache.mutex);
+    auto [it, inserted] = cache.sourceEntries.try_emplace(sourceKey, pCreated);
+    if (!inserted) {
+      pExisting = it->second.Pin();
+      if (!pExisting) {
+        it->second = pCreated;
+      }
+    }
+
+    if (!pExisting) {
+      cache.sourceKeysByTexture[pCreated.Get()].push_back(sourceKey);
+    }
+  }
+
+  // If another thread created a texture with the same key at the same time,
+  // the one that's already in the cache is used. The created one is released
+  // outside of the lock, which its deleter takes.
+  return pExisting ? pExisting : pCreated;
+}
+
+int32 getTextureCount() {
+  Cache& cache = getCache();
+  std::scoped_lock lock(cache.mutex);
+  return int32(cache.entries.size());
+}
+
+int32 getSourceKeyCount() {
+  Cache& cache = getCache();
+  std::scoped_lock lock(cache.mutex);
+  return int32(cache.sourceEntries.size());
+}
+
+} // namespace CesiumTextureCache
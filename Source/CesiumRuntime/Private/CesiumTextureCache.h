@@ -0,0 +1,85 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "CesiumTextureResource.h"
+#include "Hash/xxhash.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+#include <optional>
+
+namespace CesiumGltf {
+struct ImageAsset;
+}
+
+/**
+ * A process-wide cache of the texture resources created for glTF images, keyed
+ * by a hash of their decoded pixels and the settings they are created with.
+ *
+ * Images are only shared through the tileset's asset depot when they have the
+ * same URI, so images embedded in many tiles, or referenced by several
+ * tilesets, would otherwise each be uploaded to the GPU. With this cache, an
+ * image whose pixels match those of a texture that is still in use is given
+ * that texture instead.
+ *
+ * Textures can also be found by a key that the caller derives from whatever
+ * the pixels are produced from, such as the data of an encoded metadata
+ * property, so that the pixels don't need to be produced again for a texture
+ * that is already in use.
+ *
+ * The cache only holds weak references. A texture is removed from it, along
+ * with any keys that refer to it, when the last shared pointer to it, usually
+ * held by an `ExtensionImageAssetUnreal` and the resources wrapping it, is
+ * released.
+ */
+namespace CesiumTextureCache {
+
+/**
+ * Gets the texture resource for an image from the cache, creating it with
+ * {@link FCesiumTextureResource::CreateNew} if no texture with the same
+ * pixels and settings is in use. A created resource is initialized on the
+ * render thread before it is added to the cache, so it may be wrapped as soon
+ * as this returns. This may be called from any thread.
+ *
+ * Either way, the image's `pixelData` is emptied and its `sizeBytes` is set,
+ * as if the resource had been created from it.
+ *
+ * @return The texture resource, or nullptr if it could not be created.
+ */
+TSharedPtr<FCesiumTextureResource> getOrCreate(
+    CesiumGltf::ImageAsset& image,
+    bool sRGB,
+    bool needsMipMaps,
+    const std::optional<EPixelFormat>& overridePixelFormat,
+    ECesiumTextureCompression compression,
+    bool streamMips);
+
+/**
+ * Gets the texture resource with the given source key from the cache. If no
+ * texture with this key is in use, `create` is called to produce one, and the
+ * key is added to the cache along with it. This may be called from any thread.
+ *
+ * The texture returned by `create` must have been created by the other
+ * overload of `getOrCreate`, so that the key is removed when the texture is.
+ * If it returns nullptr, nothing is added to the cache.
+ *
+ * @param sourceKey A hash of everything that the texture's pixels and
+ * settings are derived from.
+ * @param create The function that creates the texture.
+ * @return The texture resource, or nullptr if it could not be created.
+ */
+TSharedPtr<FCesiumTextureResource> getOrCreate(
+    const FXxHash128& sourceKey,
+    TFunctionRef<TSharedPtr<FCesiumTextureResource>()> create);
+
+/**
+ * Gets the number of textures currently in the cache.
+ */
+int32 getTextureCount();
+
+/**
+ * Gets the number of source keys currently in the cache.
+ */
+int32 getSourceKeyCount();
+
+} // namespace CesiumTextureCache
@@ -0,0 +1,483 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumTextureCompressor.h"
+#include "Math/UnrealMathUtility.h"
+#include "Math/Vector.h"
+#include "PixelFormat.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <algorithm>
+
+using namespace CesiumGltf;
+
+namespace {
+
+constexpr int32 PixelsPerBlock = 16;
+
+// The weight of the first endpoint in each of the four BC1 palette entries.
+constexpr float PaletteWeights[4] = {1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f};
+
+int32 quantizeChannel(float value, int32 maximum) {
+  return FMath::Clamp(FMath::RoundToInt(value * maximum / 255.0f), 0, maximum);
+}
+
+uint16 packColor565(const FVector3f& color) {
+  const int32 r = quantizeChannel(color.X, 31);
+  const int32 g = quantizeChannel(color.Y, 63);
+  const int32 b = quantizeChannel(color.Z, 31);
+  return uint16(r << 11 | g << 5 | b);
+}
+
+FVector3f unpackColor565(uint16 color) {
+  const int32 r = (color >> 11) & 0x1f;
+  const int32 g = (color >> 5) & 0x3f;
+  const int32 b = color & 0x1f;
+  return FVector3f(
+      float(r << 3 | r >> 2),
+      float(g << 2 | g >> 4),
+      float(b << 3 | b >> 2));
+}
+
+// Chooses the closest entry of the palette between the two endpoints for each
+// pixel, and returns the total squared error.
+float chooseColorIndices(
+    const FVector3f* pColors,
+    uint16 color0,
+    uint16 color1,
+    uint8* pIndices) {
+  const FVector3f endpoint0 = unpackColor565(color0);
+  const FVector3f endpoint1 = unpackColor565(color1);
+  FVector3f palette[4];
+  for (int32 i = 0; i < 4; ++i) {
+    palette[i] = endpoint0 * PaletteWeights[i] +
+                 endpoint1 * (1.0f - PaletteWeights[i]);
+  }
+
+  float totalError = 0.0f;
+  for (int32 i = 0; i < PixelsPerBlock; ++i) {
+    uint8 bestIndex = 0;
+    float bestError = FVector3f::DistSquared(pColors[i], palette[0]);
+    for (uint8 j = 1; j < 4; ++j) {
+      const float error = FVector3f::DistSquared(pColors[i], palette[j]);
+      if (error < bestError) {
+        bestError = error;
+        bestIndex = j;
+      }
+    }
+    pIndices[i] = bestIndex;
+    totalError += bestError;
+  }
+
+  return totalError;
+}
+
+// Chooses endpoints that span the bounding box of the colors, inset slightly
+// so that the interpolated palette entries land closer to the colors.
+void chooseEndpointsFast(
+    const FVector3f* pColors,
+    FVector3f& endpoint0,
+    FVector3f& endpoint1) {
+  FVector3f minimum = pColors[0];
+  FVector3f maximum = pColors[0];
+  for (int32 i = 1; i < PixelsPerBlock; ++i) {
+    minimum = minimum.ComponentMin(pColors[i]);
+    maximum = maximum.ComponentMax(pColors[i]);
+  }
+
+  const FVector3f inset = (maximum - minimum) / 16.0f;
+  endpoint0 = maximum - inset;
+  endpoint1 = minimum + inset;
+}
+
+// Chooses endpoints at the extremes of the colors along their principal axis.
+void chooseEndpointsPrincipalAxis(
+    const FVector3f* pColors,
+    FVector3f& endpoint0,
+    FVector3f& endpoint1) {
+  FVector3f mean = FVector3f::ZeroVector;
+  for (int32 i = 0; i < PixelsPerBlock; ++i) {
+    mean += pColors[i];
+  }
+  mean /= float(PixelsPerBlock);
+
+  // The covariance matrix is symmetric, so only six entries are needed.
+  float xx = 0.0f, xy = 0.0f, xz = 0.0f, yy = 0.0f, yz = 0.0f, zz = 0.0f;
+  for (int32 i = 0; i < PixelsPerBlock; ++i) {
+    const FVector3f d = pColors[i] - mean;
+    xx += d.X * d.X;
+    xy += d.X * d.Y;
+    xz += d.X * d.Z;
+    yy += d.Y * d.Y;
+    yz += d.Y * d.Z;
+    zz += d.Z * d.Z;
+  }
+
+  // Find the principal axis by power iteration.
+  FVector3f axis(1.0f, 1.0f, 1.0f);
+  for (int32 iteration = 0; iteration < 8; ++iteration) {
+    const FVector3f next(
+        xx * axis.X + xy * axis.Y + xz * axis.Z,
+        xy * axis.X + yy * axis.Y + yz * axis.Z,
+        xz * axis.X + yz * axis.Y + zz * axis.Z);
+    const float length = next.Size();
+    if (length < UE_SMALL_NUMBER) {
+      // The colors are all the same (or vary only perpendicular to the
+      // starting axis, which is equally fine).
+      break;
+    }
+    axis = next / length;
+  }
+  axis.Normalize();
+
+  float minimum = 0.0f;
+  float maximum = 0.0f;
+  for (int32 i = 0; i < PixelsPerBlock; ++i) {
+    const float t = FVector3f::DotProduct(pColors[i] - mean, axis);
+    minimum = FMath::Min(minimum, t);
+    maximum = FMath::Max(maximum, t);
+  }
+
+  endpoint0 = mean + axis * maximum;
+  endpoint1 = mean + axis * minimum;
+}
+
+// Solves for the endpoints that minimize the squared error of the colors, given
+// the palette entry chosen for each. Returns false if the system is singular,
+// which happens when every color uses the same palette entry.
+bool refineEndpoints(
+    const FVector3f* pColors,
+    const uint8* pIndices,
+    FVector3f& endpoint0,
+    FVector3f& endpoint1) {
+  float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+  FVector3f ax = FVector3f::ZeroVector;
+  FVector3f bx = FVector3f::ZeroVector;
+  for (int32 i = 0; i < PixelsPerBlock; ++i) {
+    const float a = PaletteWeights[pIndices[i]];
+    const float b = 1.0f - a;
+    aa += a * a;
+    bb += b * b;
+    ab += a * b;
+    ax += pColors[i] * a;
+    bx += pColors[i] * b;
+  }
+
+  const float determinant = aa * bb - ab * ab;
+  if (FMath::Abs(determinant) < UE_SMALL_NUMBER) {
+    return false;
+  }
+
+  const FVector3f zero = FVector3f::ZeroVector;
+  const FVector3f full(255.0f, 255.0f, 255.0f);
+  endpoint0 = ((ax * bb - bx * ab) / determinant).BoundToBox(zero, full);
+  endpoint1 = ((bx * aa - ax * ab) / determinant).BoundToBox(zero, full);
+  return true;
+}
+
+void writeColorBlock(
+    uint16 color0,
+    uint16 color1,
+    const uint8* pIndices,
+    uint8* pOut) {
+  uint32 indexBits = 0;
+  for (int32 i = 0; i < PixelsPerBlock; ++i) {
+    indexBits |= uint32(pIndices[i]) << (2 * i);
+  }
+
+  pOut[0] = uint8(color0);
+  pOut[1] = uint8(color0 >> 8);
+  pOut[2] = uint8(color1);
+  pOut[3] = uint8(color1 >> 8);
+  pOut[4] = uint8(indexBits);
+  pOut[5] = uint8(indexBits >> 8);
+  pOut[6] = uint8(indexBits >> 16);
+  pOut[7] = uint8(indexBits >> 24);
+}
+
+// Quantizes the endpoints and orders them so that the block decodes in
+// four-color mode, which requires color0 > color1. Returns the total error.
+float quantizeEndpoints(
+    const FVector3f* pColors,
+    const FVector3f& endpoint0,
+    const FVector3f& endpoint1,
+    uint16& color0,
+    uint16& color1,
+    uint8* pIndices) {
+  color0 = packColor565(endpoint0);
+  color1 = packColor565(endpoint1);
+  if (color0 < color1) {
+    std::swap(color0, color1);
+  }
+
+  if (color0 == color1) {
+    // A solid block. Every pixel uses color0, which is the same in both the
+    // four- and three-color modes.
+    const FVector3f solid = unpackColor565(color0);
+    float totalError = 0.0f;
+    for (int32 i = 0; i < PixelsPerBlock; ++i) {
+      pIndices[i] = 0;
+      totalError += FVector3f::DistSquared(pColors[i], solid);
+    }
+    return totalError;
+  }
+
+  return chooseColorIndices(pColors, color0, color1, pIndices);
+}
+
+void compressAlphaBlock(const uint8* pRgba, uint8* pOut) {
+  uint8 minimum = 255;
+  uint8 maximum = 0;
+  for (int32 i = 0; i < PixelsPerBlock; ++i) {
+    minimum = FMath::Min(minimum, pRgba[i * 4 + 3]);
+    maximum = FMath::Max(maximum, pRgba[i * 4 + 3]);
+  }
+
+  // With alpha0 > alpha1, the block decodes in eight-value mode. When the
+  // alphas are all the same, every pixel uses alpha0 instead.
+  pOut[0] = maximum;
+  pOut[1] = minimum;
+
+  uint64 indexBits = 0;
+  if (maximum != minimum) {
+    float palette[8];
+    palette[0] = float(maximum);
+    palette[1] = float(minimum);
+    for (int32 i = 2; i < 8; ++i) {
+      palette[i] = (float(8 - i) * maximum + float(i - 1) * minimum) / 7.0f;
+    }
+
+    for (int32 i = 0; i < PixelsPerBlock; ++i) {
+      const float alpha = float(pRgba[i * 4 + 3]);
+      uint64 bestIndex = 0;
+      float bestError = FMath::Abs(alpha - palette[0]);
+      for (uint64 j = 1; j < 8; ++j) {
+        const float error = FMath::Abs(alpha - palette[j]);
+        if (error < bestError) {
+          bestError = error;
+          bestIndex = j;
+        }
+      }
+      indexBits |= bestIndex << (3 * i);
+    }
+  }
+
+  for (int32 i = 0; i < 6; ++i) {
+    pOut[2 + i] = uint8(indexBits >> (8 * i));
+  }
+}
+
+void compressColorBlock(
+    const uint8* pRgba,
+    ECesiumTextureCompression compression,
+    uint8* pOut) {
+  FVector3f colors[PixelsPerBlock];
+  for (int32 i = 0; i < PixelsPerBlock; ++i) {
+    colors[i] = FVector3f(pRgba[i * 4], pRgba[i * 4 + 1], pRgba[i * 4 + 2]);
+  }
+
+  FVector3f endpoint0, endpoint1;
+  if (compression == ECesiumTextureCompression::HighQuality) {
+    chooseEndpointsPrincipalAxis(colors, endpoint0, endpoint1);
+  } else {
+    chooseEndpointsFast(colors, endpoint0, endpoint1);
+  }
+
+  uint16 color0, color1;
+  uint8 indices[PixelsPerBlock];
+  float error =
+      quantizeEndpoints(colors, endpoint0, endpoint1, color0, color1, indices);
+
+  if (compression == ECesiumTextureCompression::HighQuality) {
+    for (int32 iteration = 0; iteration < 2 && error > 0.0f; ++iteration) {
+      if (!refineEndpoints(colors, indices, endpoint0, endpoint1)) {
+        break;
+      }
+
+      uint16 refinedColor0, refinedColor1;
+      uint8 refinedIndices[PixelsPerBlock];
+      const float refinedError = quantizeEndpoints(
+          colors,
+          endpoint0,
+          endpoint1,
+          refinedColor0,
+          refinedColor1,
+          refinedIndices);
+      if (refinedError >= error) {
+        break;
+      }
+
+      error = refinedError;
+      color0 = refinedColor0;
+      color1 = refinedColor1;
+      FMemory::Memcpy(indices, refinedIndices, sizeof(indices));
+    }
+  }
+
+  writeColorBlock(color0, color1, indices, pOut);
+}
+
+bool isOpaque(const uint8* pRgba, size_t numPixels) {
+  for (size_t i = 0; i < numPixels; ++i) {
+    if (pRgba[i * 4 + 3] != 255) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Gets the position of the given mip level, treating an image without
+// mipPositions as having a single level spanning all of its pixel data.
+ImageAssetMipPosition getMipPosition(const ImageAsset& image, int32 level) {
+  if (image.mipPositions.empty()) {
+    return ImageAssetMipPosition{0, image.pixelData.size()};
+  }
+  return image.mipPositions[level];
+}
+
+} // namespace
+
+namespace CesiumTextureCompressor {
+
+void compressBlockBC1(
+    const uint8* pRgba,
+    ECesiumTextureCompression compression,
+    uint8* pOut) {
+  compressColorBlock(pRgba, compression, pOut);
+}
+
+void compressBlockBC3(
+    const uint8* pRgba,
+    ECesiumTextureCompression compression,
+    uint8* pOut) {
+  compressAlphaBlock(pRgba, pOut);
+  compressColorBlock(pRgba, compression, pOut + 8);
+}
+
+int64 computeCompressedSize(int32 blockBytes, int32 width, int32 height) {
+  const int64 blocksX = FMath::Max<int64>(1, (int64(width) + 3) / 4);
+  const int64 blocksY = FMath::Max<int64>(1, (int64(height) + 3) / 4);
+  return blocksX * blocksY * blockBytes;
+}
+
+bool canCompress(const ImageAsset& image) {
+  if (image.compressedPixelFormat != GpuCompressedPixelFormat::NONE ||
+      image.channels != 4 || image.bytesPerChannel != 1) {
+    return false;
+  }
+
+  if (image.width <= 0 || image.height <= 0 || image.width % 4 != 0 ||
+      image.height % 4 != 0) {
+    return false;
+  }
+
+  const int32 numLevels =
+      image.mipPositions.empty() ? 1 : int32(image.mipPositions.size());
+  for (int32 level = 0; level < numLevels; ++level) {
+    const ImageAssetMipPosition position = getMipPosition(image, level);
+    const size_t width = size_t(FMath::Max(image.width >> level, 1));
+    const size_t height = size_t(FMath::Max(image.height >> level, 1));
+    if (position.byteSize != width * height * 4 ||
+        position.byteOffset + position.byteSize > image.pixelData.size()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool compressImage(
+    ImageAsset& image,
+    ECesiumTextureCompression compression,
+    bool bc1Supported,
+    bool bc3Supported) {
+  if (compression == ECesiumTextureCompression::None || !canCompress(image)) {
+    return false;
+  }
+
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CompressTexture)
+
+  const ImageAssetMipPosition basePosition = getMipPosition(image, 0);
+  const bool opaque = isOpaque(
+      reinterpret_cast<const uint8*>(&image.pixelData[basePosition.byteOffset]),
+      basePosition.byteSize / 4);
+
+  GpuCompressedPixelFormat format;
+  int32 blockBytes;
+  void (*compressBlock)(const uint8*, ECesiumTextureCompression, uint8*);
+  if (opaque && bc1Supported) {
+    format = GpuCompressedPixelFormat::BC1_RGB;
+    blockBytes = BC1BlockBytes;
+    compressBlock = compressBlockBC1;
+  } else if (bc3Supported) {
+    format = GpuCompressedPixelFormat::BC3_RGBA;
+    blockBytes = BC3BlockBytes;
+    compressBlock = compressBlockBC3;
+  } else {
+    return false;
+  }
+
+  const int32 numLevels =
+      image.mipPositions.empty() ? 1 : int32(image.mipPositions.size());
+
+  std::vector<ImageAssetMipPosition> mipPositions(numLevels);
+  size_t totalSize = 0;
+  for (int32 level = 0; level < numLevels; ++level) {
+    const size_t size = size_t(computeCompressedSize(
+        blockBytes,
+        FMath::Max(image.width >> level, 1),
+        FMath::Max(image.height >> level, 1)));
+    mipPositions[level] = ImageAssetMipPosition{totalSize, size};
+    totalSize += size;
+  }
+
+  std::vector<std::byte> pixelData(totalSize);
+  uint8 block[PixelsPerBlock * 4];
+
+  for (int32 level = 0; level < numLevels; ++level) {
+    const int32 width = FMath::Max(image.width >> level, 1);
+    const int32 height = FMath::Max(image.height >> level, 1);
+    const uint8* pSource = reinterpret_cast<const uint8*>(
+        &image.pixelData[getMipPosition(image, level).byteOffset]);
+    uint8* pDestination =
+        reinterpret_cast<uint8*>(&pixelData[mipPositions[level].byteOffset]);
+
+    for (int32 blockY = 0; blockY < height; blockY += 4) {
+      for (int32 blockX = 0; blockX < width; blockX += 4) {
+        // Mips smaller than a block are padded by repeating their last row and
+        // column.
+        for (int32 y = 0; y < 4; ++y) {
+          const int32 sourceY = FMath::Min(blockY + y, height - 1);
+          for (int32 x = 0; x < 4; ++x) {
+            const int32 sourceX = FMath::Min(blockX + x, width - 1);
+            FMemory::Memcpy(
+                &block[(y * 4 + x) * 4],
+                &pSource[(size_t(sourceY) * width + sourceX) * 4],
+                4);
+          }
+        }
+
+        compressBlock(block, compression, pDestination);
+        pDestination += blockBytes;
+      }
+    }
+  }
+
+  image.pixelData = std::move(pixelData);
+  if (!image.mipPositions.empty()) {
+    image.mipPositions = std::move(mipPositions);
+  }
+  image.compressedPixelFormat = format;
+
+  return true;
+}
+
+bool compressImageForCurrentRHI(
+    ImageAsset& image,
+    ECesiumTextureCompression compression) {
+  return compressImage(
+      image,
+      compression,
+      GPixelFormats[EPixelFormat::PF_DXT1].Supported,
+      GPixelFormats[EPixelFormat::PF_DXT5].Supported);
+}
+
+} // namespace CesiumTextureCompressor
@@ -0,0 +1,100 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "CesiumTextureCompression.h"
+#include "HAL/Platform.h"
+#include <CesiumGltf/ImageAsset.h>
+
+/**
+ * A CPU encoder for the BC1 and BC3 (DXT1 and DXT5) block-compressed pixel
+ * formats. It is used to compress decoded glTF and raster overlay images on a
+ * load thread so that they take less GPU memory once they are uploaded.
+ *
+ * Apart from {@link compressImageForCurrentRHI}, nothing here depends on the
+ * RHI, so it can be exercised without a renderer.
+ */
+namespace CesiumTextureCompressor {
+
+/**
+ * The number of bytes in a compressed 4x4 block of BC1 pixels.
+ */
+constexpr int32 BC1BlockBytes = 8;
+
+/**
+ * The number of bytes in a compressed 4x4 block of BC3 pixels.
+ */
+constexpr int32 BC3BlockBytes = 16;
+
+/**
+ * Compresses a 4x4 block of pixels to BC1. The block's alpha is ignored.
+ *
+ * @param pRgba The 16 pixels of the block in row-major order, with four bytes
+ * (red, green, blue, alpha) per pixel.
+ * @param compression The speed / quality tradeoff to make. `None` is treated
+ * like `Fast`.
+ * @param pOut The {@link BC1BlockBytes} bytes to which to write the block.
+ */
+void compressBlockBC1(
+    const uint8* pRgba,
+    ECesiumTextureCompression compression,
+    uint8* pOut);
+
+/**
+ * Compresses a 4x4 block of pixels to BC3.
+ *
+ * @param pRgba The 16 pixels of the block in row-major order, with four bytes
+ * (red, green, blue, alpha) per pixel.
+ * @param compression The speed / quality tradeoff to make. `None` is treated
+ * like `Fast`.
+ * @param pOut The {@link BC3BlockBytes} bytes to which to write the block.
+ */
+void compressBlockBC3(
+    const uint8* pRgba,
+    ECesiumTextureCompression compression,
+    uint8* pOut);
+
+/**
+ * Computes the number of bytes that an image of the given size takes when it
+ * is compressed with the given number of bytes per block. Partial blocks at
+ * the right and bottom edges are rounded up to whole blocks.
+ */
+int64 computeCompressedSize(int32 blockBytes, int32 width, int32 height);
+
+/**
+ * Determines whether {@link compressImage} is able to compress the given
+ * image. It must be uncompressed, have four 8-bit channels, and have a width
+ * and height that are multiples of four. If it has mipmaps, their sizes must
+ * match their positions in the pixel data.
+ */
+bool canCompress(const CesiumGltf::ImageAsset& image);
+
+/**
+ * Compresses an image, including any mipmaps it already has, in place. Images
+ * in which every pixel is opaque are compressed to BC1, and others are
+ * compressed to BC3. The image's `compressedPixelFormat`, `pixelData`, and
+ * `mipPositions` are replaced.
+ *
+ * @param image The image to compress.
+ * @param compression The speed / quality tradeoff to make.
+ * @param bc1Supported Whether the BC1 format may be used.
+ * @param bc3Supported Whether the BC3 format may be used. Opaque images are
+ * compressed to BC3 if BC1 may not be used.
+ * @return True if the image was compressed. False if compression was `None`,
+ * if {@link canCompress} returned false, or if no supported format is suitable
+ * for the image, in which case the image is left unchanged.
+ */
+bool compressImage(
+    CesiumGltf::ImageAsset& image,
+    ECesiumTextureCompression compression,
+    bool bc1Supported,
+    bool bc3Supported);
+
+/**
+ * Calls {@link compressImage} with the formats that the current RHI supports.
+ */
+bool compressImageForCurrentRHI(
+    CesiumGltf::ImageAsset& image,
+    ECesiumTextureCompression compression);
+
+} // namespace CesiumTextureCompressor
@@ -2,11 +2,24 @@
 
 #include "CesiumTextureResource.h"
 #include "CesiumCommon.h"
+#include "CesiumMipMapGenerator.h"
 #include "CesiumRuntime.h"
+#include "CesiumStats.h"
+#include "CesiumTextureCompressor.h"
+#include "CesiumTextureStreaming.h"
 #include "CesiumTextureUtility.h"
 #include "Misc/CoreStats.h"
 #include "RenderUtils.h"
-#include <CesiumGltfReader/GltfReader.h>
+#include <atomic>
+
+DECLARE_MEMORY_STAT(
+    TEXT("Streamed Texture Mips"),
+    STAT_CesiumStreamedMipMemory,
+    STATGROUP_Cesium);
+DECLARE_MEMORY_STAT(
+    TEXT("Streamed Texture CPU Mip Chains"),
+    STAT_CesiumStreamedMipCpuMemory,
+    STATGROUP_Cesium);
 
 namespace {
 
@@ -45,7 +58,8 @@ protected:
 class FCesiumUseExistingTextureResource : public FCesiumTextureResource {
 public:
   FCesiumUseExistingTextureResource(
-      const TSharedPtr<FTextureResource>& pExistingTexture,
+      const TSharedPtr<FCesiumTextureResource>& pExistingTexture,
+      const TSharedPtr<FCesiumStreamedTextureResource>& pStreamedTexture,
       TextureGroup textureGroup,
       uint32 width,
       uint32 height,
@@ -58,13 +72,29 @@ public:
       uint32 extData,
       bool isPrimary);
 
+  virtual TSharedPtr<FCesiumStreamedTextureResource>
+  GetStreamedResource() const override {
+    return this->_pStreamedTexture;
+  }
+
+  virtual TSharedPtr<FCesiumTextureResource>
+  GetWrappedResource() const override {
+    return this->_pExistingTexture;
+  }
+
+  virtual void ReleaseRHI() override;
+
 protected:
   virtual FTextureRHIRef InitializeTextureRHI() override;
 
 private:
-  TSharedPtr<FTextureResource> _pExistingTexture;
+  TSharedPtr<FCesiumTextureResource> _pExistingTexture;
+  // The existing texture, if its mips are streamed.
+  TSharedPtr<FCesiumStreamedTextureResource> _pStreamedTexture;
 };
 
+std::atomic<int64> totalStreamedResidentBytes{0};
+
 /**
  * A Cesium texture resource that creates an `FRHITexture` from a glTF
  * `ImageCesium` when `InitRHI` is called from the render thread. When
@@ -99,6 +129,31 @@ private:
   std::vector<std::byte> _pixelData;
 };
 
+/**
+ * A Cesium texture resource that creates an empty `FRHITexture` when `InitRHI`
+ * is called from the render thread. Its contents are written later, by
+ * commands enqueued on the render thread by whoever created it.
+ */
+class FCesiumEmptyTextureResource : public FCesiumTextureResource {
+public:
+  FCesiumEmptyTextureResource(
+      TextureGroup textureGroup,
+      uint32 width,
+      uint32 height,
+      EPixelFormat format,
+      TextureFilter filter,
+      TextureAddress addressX,
+      TextureAddress addressY,
+      bool sRGB,
+      uint32 mipCount);
+
+protected:
+  virtual FTextureRHIRef InitializeTextureRHI() override;
+
+private:
+  uint32 _mipCount;
+};
+
 ESamplerFilter convertFilter(TextureFilter filter) {
   switch (filter) {
   case TF_Nearest:
@@ -193,17 +248,16 @@ void CopyMip(
   }
 }
 
-FTextureRHIRef createAsyncTextureAndWait(
+FTextureRHIRef createAsyncTexture(
     uint32 SizeX,
     uint32 SizeY,
     uint8 Format,
     uint32 NumMips,
     ETextureCreateFlags Flags,
     void** InitialMipData,
-    uint32 NumInitialMips) {
-  FGraphEventRef CompletionEvent;
-
-  FTextureRHIRef result = RHIAsyncCreateTexture2D(
+    uint32 NumInitialMips,
+    FGraphEventRef& CompletionEvent) {
+  return RHIAsyncCreateTexture2D(
       SizeX,
       SizeY,
       Format,
@@ -214,12 +268,6 @@ FTextureRHIRef createAsyncTextureAndWait(
       NumInitialMips,
       TEXT("CesiumTexture"),
       CompletionEvent);
-
-  if (CompletionEvent) {
-    CompletionEvent->Wait();
-  }
-
-  return result;
 }
 
 /**
@@ -229,12 +277,16 @@ FTextureRHIRef createAsyncTextureAndWait(
  * @param image The CPU image to create on the GPU.
  * @param format The pixel format of the image.
  * @param Whether to use a sRGB color-space.
+ * @param completionEvent Set to an event that fires when the RHI has finished
+ * reading the image's pixel data, or to null if it already has. The pixel data
+ * must be kept alive until then.
  * @return The RHI texture reference.
  */
 FTextureRHIRef CreateRHITexture2D_Async(
     const CesiumGltf::ImageAsset& image,
     EPixelFormat format,
-    bool sRGB) {
+    bool sRGB,
+    FGraphEventRef& completionEvent) {
   check(GRHISupportsAsyncTextureCreation);
 
   ETextureCreateFlags textureFlags = TexCreate_ShaderResource;
@@ -262,24 +314,26 @@ FTextureRHIRef CreateRHITexture2D_Async(
       mipsData[i] = (void*)(&image.pixelData[mipPos.byteOffset]);
     }
 
-    return createAsyncTextureAndWait(
+    return createAsyncTexture(
         static_cast<uint32>(image.width),
         static_cast<uint32>(image.height),
         format,
         mipCount,
         textureFlags,
         mipsData,
-        mipCount);
+        mipCount,
+        completionEvent);
   } else {
     void* pTextureData = (void*)(image.pixelData.data());
-    return createAsyncTextureAndWait(
+    return createAsyncTexture(
         static_cast<uint32>(image.width),
         static_cast<uint32>(image.height),
         format,
         1,
         textureFlags,
         &pTextureData,
-        1);
+        1,
+        completionEvent);
   }
 }
 
@@ -297,14 +351,16 @@ void FCesiumTextureResourceDeleter::operator()(FCesiumTextureResource* p) {
     TextureAddress addressX,
     TextureAddress addressY,
     bool sRGB,
-    bool needsMipMaps) {
+    bool needsMipMaps,
+    ECesiumTextureCompression compression,
+    bool streamMips) {
   if (imageCesium.pixelData.empty()) {
     return nullptr;
   }
 
   if (needsMipMaps) {
     std::optional<std::string> errorMessage =
-        CesiumGltfReader::ImageDecoder::generateMipMaps(imageCesium);
+        CesiumMipMapGenerator::generateMipMaps(imageCesium, sRGB);
     if (errorMessage) {
       UE_LOG(
           LogCesium,
@@ -314,6 +370,12 @@ void FCesiumTextureResourceDeleter::operator()(FCesiumTextureResource* p) {
     }
   }
 
+  if (!overridePixelFormat) {
+    CesiumTextureCompressor::compressImageForCurrentRHI(
+        imageCesium,
+        compression);
+  }
+
   std::optional<EPixelFormat> maybePixelFormat =
       CesiumTextureUtility::getPixelFormatForImageAsset(
           imageCesium,
@@ -334,14 +396,41 @@ void FCesiumTextureResourceDeleter::operator()(FCesiumTextureResource* p) {
   // caching purposes.
   imageCesium.sizeBytes = int64_t(imageCesium.pixelData.size());
 
+  if (streamMips &&
+      CesiumTextureStreaming::computeTailMip(
+          imageCesium.width,
+          imageCesium.height,
+          int32(imageCesium.mipPositions.size()),
+          GPixelFormats[*maybePixelFormat].BlockSizeX,
+          GPixelFormats[*maybePixelFormat].BlockSizeY) > 0) {
+    // The RHI texture is created on the render thread, from a CPU copy of the
+    // mips that this resource keeps so that it can upload more of them later.
+    auto pResult =
+        FCesiumTextureResourceUniquePtr(new FCesiumStreamedTextureResource(
+            imageCesium,
+            textureGroup,
+            *maybePixelFormat,
+            filter,
+            addressX,
+            addressY,
+            sRGB,
+            needsMipMaps));
+    pResult->_pixelDataSize = uint64(imageCesium.sizeBytes);
+    return pResult;
+  }
+
   if (GRHISupportsAsyncTextureCreation) {
     // Create RHI texture resource on this worker
     // thread, and then hand it off to the renderer
     // thread.
     TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::CreateRHITexture2D)
 
-    FTextureRHIRef textureReference =
-        CreateRHITexture2D_Async(imageCesium, *maybePixelFormat, sRGB);
+    FGraphEventRef completionEvent;
+    FTextureRHIRef textureReference = CreateRHITexture2D_Async(
+        imageCesium,
+        *maybePixelFormat,
+        sRGB,
+        completionEvent);
     // textureReference->SetName(
     //     FName(UTF8_TO_TCHAR(imageCesium.getUniqueAssetId().c_str())));
     auto pResult =
@@ -358,6 +447,7 @@ void FCesiumTextureResourceDeleter::operator()(FCesiumTextureResource* p) {
             needsMipMaps,
             0,
             true));
+    pResult->_pixelDataSize = uint64(imageCesium.sizeBytes);
 
     // Clear the now-unnecessary copy of the pixel data.
     // Calling clear() isn't good enough because it
@@ -368,6 +458,16 @@ void FCesiumTextureResourceDeleter::operator()(FCesiumTextureResource* p) {
     std::vector<CesiumGltf::ImageAssetMipPosition> mipPositions;
     imageCesium.mipPositions.swap(mipPositions);
 
+    if (completionEvent && !completionEvent->IsComplete()) {
+      // The RHI is still uploading from the pixel data, so it must outlive
+      // the upload. Rather than tie up this worker until then, hand the data
+      // to a task that runs, and frees it, once the upload is done.
+      pResult->_creationEvent = FFunctionGraphTask::CreateAndDispatchWhenReady(
+          [pixelData = std::move(pixelData)]() {},
+          TStatId(),
+          completionEvent);
+    }
+
     return pResult;
   } else {
     // The RHI texture will be created later on the
@@ -386,6 +486,7 @@ void FCesiumTextureResourceDeleter::operator()(FCesiumTextureResource* p) {
             sRGB,
             needsMipMaps,
             0));
+    pResult->_pixelDataSize = uint64(imageCesium.sizeBytes);
     return pResult;
   }
 }
@@ -401,8 +502,15 @@ FCesiumTextureResourceUniquePtr FCesiumTextureResource::CreateWrapped(
   if (pExistingResource == nullptr)
     return nullptr;
 
+  TSharedPtr<FCesiumStreamedTextureResource> pStreamedResource;
+  if (pExistingResource->_isStreamed) {
+    pStreamedResource =
+        StaticCastSharedPtr<FCesiumStreamedTextureResource>(pExistingResource);
+  }
+
   return FCesiumTextureResourceUniquePtr(new FCesiumUseExistingTextureResource(
       pExistingResource,
+      pStreamedResource,
       textureGroup,
       pExistingResource->_width,
       pExistingResource->_height,
@@ -416,6 +524,43 @@ FCesiumTextureResourceUniquePtr FCesiumTextureResource::CreateWrapped(
       false));
 }
 
+/*static*/ FCesiumTextureResourceUniquePtr FCesiumTextureResource::CreateEmpty(
+    TextureGroup textureGroup,
+    uint32 width,
+    uint32 height,
+    EPixelFormat format,
+    TextureFilter filter,
+    TextureAddress addressX,
+    TextureAddress addressY,
+    bool sRGB,
+    uint32 mipCount) {
+  auto pResult =
+      FCesiumTextureResourceUniquePtr(new FCesiumEmptyTextureResource(
+          textureGroup,
+          width,
+          height,
+          format,
+          filter,
+          addressX,
+          addressY,
+          sRGB,
+          mipCount));
+
+  const FPixelFormatInfo& formatInfo = GPixelFormats[format];
+  uint64 size = 0;
+  for (uint32 i = 0; i < mipCount; ++i) {
+    const uint64 columns = FMath::DivideAndRoundUp(
+        FMath::Max(width >> i, 1u),
+        uint32(formatInfo.BlockSizeX));
+    const uint64 rows = FMath::DivideAndRoundUp(
+        FMath::Max(height >> i, 1u),
+        uint32(formatInfo.BlockSizeY));
+    size += columns * rows * formatInfo.BlockBytes;
+  }
+  pResult->_pixelDataSize = size;
+  return pResult;
+}
+
 /*static*/ void FCesiumTextureResource::Destroy(FCesiumTextureResource* p) {
   if (p == nullptr)
     return;
@@ -450,7 +595,10 @@ FCesiumTextureResource::FCesiumTextureResource(
       _addressY(convertAddressMode(addressY)),
       _useMipsIfAvailable(useMipsIfAvailable),
       _platformExtData(extData),
-      _isPrimary(isPrimary) {
+      _textureSize(0),
+      _pixelDataSize(0),
+      _isPrimary(isPrimary),
+      _isStreamed(false) {
   this->bGreyScaleFormat = (_format == PF_G8) || (_format == PF_BC4);
   this->bSRGB = sRGB;
   STAT(this->_lodGroupStatName = TextureGroupStatFNames[this->_textureGroup]);
@@ -654,7 +802,8 @@ FTextureRHIRef FCesiumPreCreatedRHITextureResource::InitializeTextureRHI() {
 }
 
 FCesiumUseExistingTextureResource::FCesiumUseExistingTextureResource(
-    const TSharedPtr<FTextureResource>& pExistingTexture,
+    const TSharedPtr<FCesiumTextureResource>& pExistingTexture,
+    const TSharedPtr<FCesiumStreamedTextureResource>& pStreamedTexture,
     TextureGroup textureGroup,
     uint32 width,
     uint32 height,
@@ -679,12 +828,29 @@ FCesiumUseExistingTextureResource::FCesiumUseExistingTextureResource(
           useMipsIfAvailable,
           extData,
           isPrimary),
-      _pExistingTexture(pExistingTexture) {}
+      _pExistingTexture(pExistingTexture),
+      _pStreamedTexture(pStreamedTexture) {
+  // The existing texture's upload must finish before this one is sampled.
+  this->_creationEvent = pExistingTexture->GetCreationEvent();
+}
 
 FTextureRHIRef FCesiumUseExistingTextureResource::InitializeTextureRHI() {
+  // Initialization is deferred until the existing texture has finished
+  // uploading, rather than waiting for it on the render thread.
+  check(!this->_creationEvent || this->_creationEvent->IsComplete());
+  if (this->_pStreamedTexture) {
+    this->_pStreamedTexture->AddWrapper(this);
+  }
   return this->_pExistingTexture->TextureRHI;
 }
 
+void FCesiumUseExistingTextureResource::ReleaseRHI() {
+  if (this->_pStreamedTexture) {
+    this->_pStreamedTexture->RemoveWrapper(this);
+  }
+  FCesiumTextureResource::ReleaseRHI();
+}
+
 FCesiumCreateNewTextureResource::FCesiumCreateNewTextureResource(
     CesiumGltf::ImageAsset& image,
     TextureGroup textureGroup,
@@ -786,3 +952,288 @@ FTextureRHIRef FCesiumCreateNewTextureResource::InitializeTextureRHI() {
 
   return rhiTexture;
 }
+
+FCesiumEmptyTextureResource::FCesiumEmptyTextureResource(
+    TextureGroup textureGroup,
+    uint32 width,
+    uint32 height,
+    EPixelFormat format,
+    TextureFilter filter,
+    TextureAddress addressX,
+    TextureAddress addressY,
+    bool sRGB,
+    uint32 mipCount)
+    : FCesiumTextureResource(
+          textureGroup,
+          width,
+          height,
+          1,
+          format,
+          filter,
+          addressX,
+          addressY,
+          sRGB,
+          mipCount > 1,
+          0,
+          true),
+      _mipCount(mipCount) {}
+
+FTextureRHIRef FCesiumEmptyTextureResource::InitializeTextureRHI() {
+  ETextureCreateFlags textureFlags = TexCreate_ShaderResource;
+  if (this->bSRGB) {
+    textureFlags |= TexCreate_SRGB;
+  }
+
+  FRHITextureCreateDesc createDesc =
+      FRHITextureCreateDesc::Create2D(TEXT("CesiumTextureUtility"))
+          .SetExtent(int32(this->_width), int32(this->_height))
+          .SetFormat(this->_format)
+          .SetNumMips(uint8(this->_mipCount))
+          .SetNumSamples(1)
+          .SetFlags(textureFlags)
+          .SetInitialState(ERHIAccess::SRVMask);
+
+  return RHICreateTexture(createDesc);
+}
+
+FCesiumStreamedTextureResource::FCesiumStreamedTextureResource(
+    CesiumGltf::ImageAsset& image,
+    TextureGroup textureGroup,
+    EPixelFormat format,
+    TextureFilter filter,
+    TextureAddress addressX,
+    TextureAddress addressY,
+    bool sRGB,
+    bool useMipsIfAvailable)
+    : FCesiumTextureResource(
+          textureGroup,
+          uint32(image.width),
+          uint32(image.height),
+          1,
+          format,
+          filter,
+          addressX,
+          addressY,
+          sRGB,
+          useMipsIfAvailable,
+          0,
+          true),
+      _mipPositions(std::move(image.mipPositions)),
+      _pixelData(std::move(image.pixelData)),
+      _tailMip(CesiumTextureStreaming::computeTailMip(
+          image.width,
+          image.height,
+          int32(this->_mipPositions.size()),
+          GPixelFormats[format].BlockSizeX,
+          GPixelFormats[format].BlockSizeY)),
+      _targetFirstMip(_tailMip),
+      _mipRequests(_tailMip),
+      _residentFirstMip(_tailMip),
+      _residentBytes(0) {
+  this->_isStreamed = true;
+  INC_MEMORY_STAT_BY(STAT_CesiumStreamedMipCpuMemory, this->_pixelData.size());
+}
+
+FCesiumStreamedTextureResource::~FCesiumStreamedTextureResource() {
+  DEC_MEMORY_STAT_BY(STAT_CesiumStreamedMipCpuMemory, this->_pixelData.size());
+}
+
+void FCesiumStreamedTextureResource::RequestScreenSize(
+    double screenSize,
+    uint64 frame) {
+  const int32 firstMip = CesiumTextureStreaming::computeFirstMipForScreenSize(
+      int32(this->_width),
+      int32(this->_height),
+      int32(this->_mipPositions.size()),
+      GPixelFormats[this->_format].BlockSizeX,
+      GPixelFormats[this->_format].BlockSizeY,
+      screenSize);
+  this->_mipRequests.request(firstMip, frame);
+}
+
+void FCesiumStreamedTextureResource::UpdateStreaming(
+    uint64 frame,
+    bool memoryPressure) {
+  // Finer mips are uploaded as soon as they're needed, but only dropped when
+  // memory is short, so that tiles moving back and forth in the view don't
+  // upload the same mips over and over. A tileset updated earlier in the frame
+  // than another that shares this texture sees only its own requests, so mips
+  // requested in the previous frame are kept as well.
+  int32 firstMip = this->_mipRequests.getRequestedFirstMip(frame);
+  if (firstMip >= this->_targetFirstMip) {
+    firstMip = this->_mipRequests.getRetainedFirstMip(frame);
+    if (!memoryPressure || firstMip <= this->_targetFirstMip) {
+      return;
+    }
+  }
+
+  this->_targetFirstMip = firstMip;
+
+  // Like Destroy, this relies on render commands running in the order they
+  // are enqueued. The caller holds a reference to this resource, so the
+  // command that deletes it can only be enqueued after this one.
+  ENQUEUE_RENDER_COMMAND(Cesium_StreamTextureMips)
+  ([this, firstMip](FRHICommandListImmediate& RHICmdList) {
+    this->SetFirstResidentMip(firstMip);
+  });
+}
+
+/*static*/ int64 FCesiumStreamedTextureResource::GetTotalResidentBytes() {
+  return totalStreamedResidentBytes.load(std::memory_order_relaxed);
+}
+
+void FCesiumStreamedTextureResource::AddWrapper(
+    FCesiumTextureResource* pWrapper) {
+  this->_wrappers.AddUnique(pWrapper);
+}
+
+void FCesiumStreamedTextureResource::RemoveWrapper(
+    FCesiumTextureResource* pWrapper) {
+  this->_wrappers.RemoveSwap(pWrapper);
+}
+
+void FCesiumStreamedTextureResource::ReleaseRHI() {
+  totalStreamedResidentBytes -= this->_residentBytes;
+  DEC_MEMORY_STAT_BY(STAT_CesiumStreamedMipMemory, this->_residentBytes);
+  this->_residentBytes = 0;
+
+  FCesiumTextureResource::ReleaseRHI();
+}
+
+FTextureRHIRef FCesiumStreamedTextureResource::InitializeTextureRHI() {
+  const int32 mipCount = int32(this->_mipPositions.size());
+  FTextureRHIRef rhiTexture =
+      this->CreateTextureForMips(this->_residentFirstMip);
+  this->UploadMips(
+      rhiTexture,
+      this->_residentFirstMip,
+      this->_residentFirstMip,
+      mipCount);
+
+  this->_residentBytes = this->ComputeResidentBytes(this->_residentFirstMip);
+  totalStreamedResidentBytes += this->_residentBytes;
+  INC_MEMORY_STAT_BY(STAT_CesiumStreamedMipMemory, this->_residentBytes);
+
+  return rhiTexture;
+}
+
+FTextureRHIRef
+FCesiumStreamedTextureResource::CreateTextureForMips(int32 firstMip) {
+  ETextureCreateFlags textureFlags = TexCreate_ShaderResource;
+  if (this->bSRGB) {
+    textureFlags |= TexCreate_SRGB;
+  }
+
+  const uint32 mipCount = uint32(this->_mipPositions.size() - firstMip);
+
+  FRHITextureCreateDesc createDesc =
+      FRHITextureCreateDesc::Create2D(TEXT("CesiumStreamedTexture"))
+          .SetExtent(
+              FMath::Max(int32(this->_width) >> firstMip, 1),
+              FMath::Max(int32(this->_height) >> firstMip, 1))
+          .SetFormat(this->_format)
+          .SetNumMips(uint8(mipCount))
+          .SetNumSamples(1)
+          .SetFlags(textureFlags)
+          .SetInitialState(ERHIAccess::SRVMask)
+          .SetExtData(this->_platformExtData);
+
+  return RHICreateTexture(createDesc);
+}
+
+void FCesiumStreamedTextureResource::UploadMips(
+    FRHITexture* pTexture,
+    int32 textureFirstMip,
+    int32 beginMip,
+    int32 endMip) {
+  for (int32 mip = beginMip; mip < endMip; ++mip) {
+    const uint32 textureMip = uint32(mip - textureFirstMip);
+    uint32 DestPitch;
+    void* pDestination =
+        RHILockTexture2D(pTexture, textureMip, RLM_WriteOnly, DestPitch, false);
+    CopyMip(
+        pDestination,
+        DestPitch,
+        this->_format,
+        this->_width,
+        this->_height,
+        this->_pixelData,
+        this->_mipPositions,
+        uint32(mip));
+    RHIUnlockTexture2D(pTexture, textureMip, false);
+  }
+}
+
+void FCesiumStreamedTextureResource::SetFirstResidentMip(int32 firstMip) {
+  if (firstMip == this->_residentFirstMip || !this->IsInitialized()) {
+    return;
+  }
+
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::StreamTextureMips)
+
+  FRHICommandListImmediate& RHICmdList = FRHICommandListImmediate::Get();
+  const int32 mipCount = int32(this->_mipPositions.size());
+  FTextureRHIRef pOldTexture = this->TextureRHI;
+  FTextureRHIRef rhiTexture = this->CreateTextureForMips(firstMip);
+
+  // Only the mips that aren't resident yet are uploaded from the CPU. The
+  // others are copied from the current texture on the GPU, so dropping mips
+  // doesn't upload anything.
+  const int32 firstCopiedMip = FMath::Max(firstMip, this->_residentFirstMip);
+  this->UploadMips(rhiTexture, firstMip, firstMip, firstCopiedMip);
+
+  if (pOldTexture && firstCopiedMip < mipCount) {
+    RHICmdList.Transition(
+        {FRHITransitionInfo(
+             pOldTexture,
+             ERHIAccess::SRVMask,
+             ERHIAccess::CopySrc),
+         FRHITransitionInfo(
+             rhiTexture,
+             ERHIAccess::SRVMask,
+             ERHIAccess::CopyDest)});
+
+    FRHICopyTextureInfo copyInfo;
+    copyInfo.SourceMipIndex = uint32(firstCopiedMip - this->_residentFirstMip);
+    copyInfo.DestMipIndex = uint32(firstCopiedMip - firstMip);
+    copyInfo.NumMips = uint32(mipCount - firstCopiedMip);
+    RHICmdList.CopyTexture(pOldTexture, rhiTexture, copyInfo);
+
+    RHICmdList.Transition(
+        {FRHITransitionInfo(
+             pOldTexture,
+             ERHIAccess::CopySrc,
+             ERHIAccess::SRVMask),
+         FRHITransitionInfo(
+             rhiTexture,
+             ERHIAccess::CopyDest,
+             ERHIAccess::SRVMask)});
+  }
+
+  const int64 residentBytes = this->ComputeResidentBytes(firstMip);
+  totalStreamedResidentBytes += residentBytes - this->_residentBytes;
+  DEC_MEMORY_STAT_BY(STAT_CesiumStreamedMipMemory, this->_residentBytes);
+  INC_MEMORY_STAT_BY(STAT_CesiumStreamedMipMemory, residentBytes);
+  this->_residentFirstMip = firstMip;
+  this->_residentBytes = residentBytes;
+
+  // Materials reference textures through their texture references, so
+  // pointing those at the new RHI texture is enough to switch them over.
+  this->TextureRHI = rhiTexture;
+  RHICmdList.UpdateTextureReference(this->TextureReferenceRHI, rhiTexture);
+  for (FCesiumTextureResource* pWrapper : this->_wrappers) {
+    pWrapper->TextureRHI = rhiTexture;
+    RHICmdList.UpdateTextureReference(
+        pWrapper->TextureReferenceRHI,
+        rhiTexture);
+  }
+}
+
+int64 FCesiumStreamedTextureResource::ComputeResidentBytes(
+    int32 firstMip) const {
+  int64 bytes = 0;
+  for (size_t i = size_t(firstMip); i < this->_mipPositions.size(); ++i) {
+    bytes += int64(this->_mipPositions[i].byteSize);
+  }
+  return bytes;
+}
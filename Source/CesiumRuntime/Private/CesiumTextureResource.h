@@ -2,12 +2,16 @@
 
 #pragma once
 
+#include "Async/TaskGraphInterfaces.h"
 #include "CesiumCommon.h"
+#include "CesiumTextureCompression.h"
+#include "CesiumTextureStreaming.h"
 #include "Engine/Texture.h"
 #include "TextureResource.h"
 #include <CesiumAsync/SharedAssetDepot.h>
 #include <CesiumGltf/ImageAsset.h>
 
+class FCesiumStreamedTextureResource;
 class FCesiumTextureResource;
 
 struct FCesiumTextureResourceDeleter {
@@ -44,6 +48,13 @@ public:
    * as sRGB.
    * @param needsMipMaps True if this texture requires mipmaps. They will be
    * generated if they don't already exist.
+   * @param compression Whether and how to block-compress the image data before
+   * it is uploaded. This is ignored when `overridePixelFormat` is set or the
+   * image cannot be compressed.
+   * @param streamMips True to upload only the coarsest mips at first, keeping
+   * a CPU copy of the rest so that they can be uploaded when they are needed.
+   * The result is then an {@link FCesiumStreamedTextureResource}. This is
+   * ignored for images without mipmaps.
    * @return The created texture resource, or nullptr if a texture could not be
    * created.
    */
@@ -55,12 +66,17 @@ public:
       TextureAddress addressX,
       TextureAddress addressY,
       bool sRGB,
-      bool needsMipMaps);
+      bool needsMipMaps,
+      ECesiumTextureCompression compression,
+      bool streamMips);
 
   /**
    * Create a new FCesiumTextureResource wrapping an existing one and providing
    * new sampling parameters. This method is intended to be called from a worker
    * thread, not from the game or render thread.
+   *
+   * The existing resource may come from the `CesiumTextureCache`, in which
+   * case it can be wrapped by the textures of many tiles and tilesets.
    */
   static FCesiumTextureResourceUniquePtr CreateWrapped(
       const TSharedPtr<FCesiumTextureResource>& pExistingResource,
@@ -71,6 +87,22 @@ public:
       bool sRGB,
       bool useMipMapsIfAvailable);
 
+  /**
+   * Create a new FCesiumTextureResource for an RHI texture whose contents are
+   * undefined until they are written on the render thread, such as a page of
+   * a texture atlas.
+   */
+  static FCesiumTextureResourceUniquePtr CreateEmpty(
+      TextureGroup textureGroup,
+      uint32 width,
+      uint32 height,
+      EPixelFormat format,
+      TextureFilter filter,
+      TextureAddress addressX,
+      TextureAddress addressY,
+      bool sRGB,
+      uint32 mipCount);
+
   /**
    * Destroys an FCesiumTextureResource. Unreal TextureResources must be
    * destroyed on the render thread, so it is important not to call `delete`
@@ -101,6 +133,44 @@ public:
   virtual void InitRHI(FRHICommandListBase& RHICmdList) override;
   virtual void ReleaseRHI() override;
 
+  /**
+   * Gets the number of bytes of pixel data, including mipmaps, held by this
+   * texture. Returns 0 if this resource shares its RHI texture with another
+   * resource, so that shared textures are only counted once.
+   */
+  uint64 GetMemorySize() const {
+    return this->_isPrimary ? this->_pixelDataSize : 0;
+  }
+
+  /**
+   * Gets an event that fires once the RHI texture created by
+   * {@link CreateNew} has finished uploading its initial pixel data, or null
+   * if there is nothing to wait for. The texture must not be sampled before
+   * then. A resource created by {@link CreateWrapped} has the event of the
+   * resource it wraps, and must not be initialized before it fires.
+   */
+  const FGraphEventRef& GetCreationEvent() const {
+    return this->_creationEvent;
+  }
+
+  /**
+   * Gets the resource that streams the mips of the RHI texture used by this
+   * one, or nullptr if all of its mips were uploaded when it was created.
+   */
+  virtual TSharedPtr<FCesiumStreamedTextureResource>
+  GetStreamedResource() const {
+    return nullptr;
+  }
+
+  /**
+   * Gets the resource created by {@link CreateWrapped} whose RHI texture this
+   * one uses, or nullptr if this resource doesn't wrap another one. The
+   * wrapped resource may be shared by the textures of many tiles.
+   */
+  virtual TSharedPtr<FCesiumTextureResource> GetWrappedResource() const {
+    return nullptr;
+  }
+
 #if STATS
   static FName TextureGroupStatFNames[TEXTUREGROUP_MAX];
 #endif
@@ -120,5 +190,103 @@ protected:
   uint32 _platformExtData;
   FName _lodGroupStatName;
   uint64 _textureSize;
+  uint64 _pixelDataSize;
   bool _isPrimary;
+  bool _isStreamed;
+  FGraphEventRef _creationEvent;
+};
+
+/**
+ * A Cesium texture resource that keeps its image's full mip chain on the CPU
+ * and uploads only some of it. The RHI texture is created on the render thread
+ * with just the mips at and below the tail mip chosen by
+ * `CesiumTextureStreaming`. Finer mips are uploaded when the tiles using the
+ * texture get closer to the camera, and dropped again under memory pressure, by
+ * replacing the RHI texture with one holding a different range of mips. The
+ * mips that both textures hold are copied on the GPU, so only mips that weren't
+ * resident are uploaded.
+ *
+ * The CPU copy of the mip chain, including the resident mips, stays in memory
+ * for as long as this resource exists, so that dropped mips can be uploaded
+ * again. It is reported by the "Streamed Texture CPU Mip Chains" stat.
+ *
+ * Textures created for glTF textures wrap this resource rather than owning it,
+ * so they register with it to have their RHI texture replaced as well.
+ */
+class FCesiumStreamedTextureResource : public FCesiumTextureResource {
+public:
+  FCesiumStreamedTextureResource(
+      CesiumGltf::ImageAsset& image,
+      TextureGroup textureGroup,
+      EPixelFormat format,
+      TextureFilter filter,
+      TextureAddress addressX,
+      TextureAddress addressY,
+      bool sRGB,
+      bool useMipsIfAvailable);
+
+  virtual ~FCesiumStreamedTextureResource();
+
+  /**
+   * Records that a tile using this texture is `screenSize` pixels across in
+   * the given frame. The largest size recorded in a frame determines which
+   * mips the texture needs. Call this on the game thread.
+   */
+  void RequestScreenSize(double screenSize, uint64 frame);
+
+  /**
+   * Uploads the mips requested in the given frame if they aren't resident
+   * yet. Under memory pressure, this also drops mips finer than the ones
+   * requested in this frame and the one before it, which are all but the tail
+   * if the texture wasn't requested at all. Call this on the game thread after
+   * the tiles of the calling tileset have made their requests. Textures shared
+   * between tilesets may be updated by each of them.
+   */
+  void UpdateStreaming(uint64 frame, bool memoryPressure);
+
+  /**
+   * Gets the total GPU memory, in bytes, used by the resident mips of all
+   * streamed textures.
+   */
+  static int64 GetTotalResidentBytes();
+
+  /**
+   * Registers a resource that shares this one's RHI texture, so that it is
+   * updated when the texture is replaced. Call this on the render thread.
+   */
+  void AddWrapper(FCesiumTextureResource* pWrapper);
+
+  /**
+   * Unregisters a resource added with {@link AddWrapper}. Call this on the
+   * render thread.
+   */
+  void RemoveWrapper(FCesiumTextureResource* pWrapper);
+
+  virtual void ReleaseRHI() override;
+
+protected:
+  virtual FTextureRHIRef InitializeTextureRHI() override;
+
+private:
+  FTextureRHIRef CreateTextureForMips(int32 firstMip);
+  void UploadMips(
+      FRHITexture* pTexture,
+      int32 textureFirstMip,
+      int32 beginMip,
+      int32 endMip);
+  void SetFirstResidentMip(int32 firstMip);
+  int64 ComputeResidentBytes(int32 firstMip) const;
+
+  std::vector<CesiumGltf::ImageAssetMipPosition> _mipPositions;
+  std::vector<std::byte> _pixelData;
+  int32 _tailMip;
+
+  // Game thread state.
+  int32 _targetFirstMip;
+  CesiumTextureStreaming::MipRequests _mipRequests;
+
+  // Render thread state.
+  int32 _residentFirstMip;
+  int64 _residentBytes;
+  TArray<FCesiumTextureResource*> _wrappers;
 };
@@ -0,0 +1,85 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumTextureStreaming.h"
+#include "Math/UnrealMathUtility.h"
+
+namespace CesiumTextureStreaming {
+
+int32 computeTailMip(
+    int32 width,
+    int32 height,
+    int32 mipCount,
+    int32 blockSizeX,
+    int32 blockSizeY) {
+  int32 size = FMath::Max(width, height);
+  int32 mip = 0;
+  while (mip < mipCount - 1 && size > ResidentTailSize) {
+    const int32 nextMip = mip + 1;
+    if (FMath::Max(width >> nextMip, 1) % blockSizeX != 0 ||
+        FMath::Max(height >> nextMip, 1) % blockSizeY != 0) {
+      break;
+    }
+    size = FMath::Max(size >> 1, 1);
+    mip = nextMip;
+  }
+  return mip;
+}
+
+int32 computeFirstMipForScreenSize(
+    int32 width,
+    int32 height,
+    int32 mipCount,
+    int32 blockSizeX,
+    int32 blockSizeY,
+    double screenSize) {
+  const int32 tailMip =
+      computeTailMip(width, height, mipCount, blockSizeX, blockSizeY);
+  if (screenSize <= 0.0) {
+    return tailMip;
+  }
+
+  const double size = double(FMath::Max(width, height));
+  if (screenSize >= size) {
+    return 0;
+  }
+
+  const int32 mip = FMath::FloorToInt32(FMath::Log2(size / screenSize));
+  return FMath::Clamp(mip, 0, tailMip);
+}
+
+MipRequests::MipRequests(int32 tailMip)
+    : _tailMip(tailMip),
+      _frame(0),
+      _firstMip(tailMip),
+      _previousFrame(0),
+      _previousFirstMip(tailMip) {}
+
+void MipRequests::request(int32 firstMip, uint64 frame) {
+  if (frame == this->_frame) {
+    this->_firstMip = FMath::Min(this->_firstMip, firstMip);
+    return;
+  }
+
+  this->_previousFrame = this->_frame;
+  this->_previousFirstMip = this->_firstMip;
+  this->_frame = frame;
+  this->_firstMip = firstMip;
+}
+
+int32 MipRequests::getRequestedFirstMip(uint64 frame) const {
+  if (frame == this->_frame) {
+    return this->_firstMip;
+  }
+  if (frame == this->_previousFrame) {
+    return this->_previousFirstMip;
+  }
+  return this->_tailMip;
+}
+
+int32 MipRequests::getRetainedFirstMip(uint64 frame) const {
+  return FMath::Min(
+      this->getRequestedFirstMip(frame),
+      this->getRequestedFirstMip(frame - 1));
+}
+
+} // namespace CesiumTextureStreaming
@@ -0,0 +1,111 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "HAL/Platform.h"
+
+/**
+ * Chooses which mips of a tile texture to keep on the GPU, based on how large
+ * the tile is on screen. Only the coarsest mips are uploaded when a streamed
+ * texture is created, and finer ones are uploaded as its tile is viewed more
+ * closely.
+ */
+namespace CesiumTextureStreaming {
+
+/**
+ * The largest width or height, in texels, of the mips that are uploaded when
+ * a streamed texture is created. They stay resident for as long as the texture
+ * exists.
+ */
+constexpr int32 ResidentTailSize = 64;
+
+/**
+ * Computes the index of the finest mip that is always resident: the first one
+ * whose width and height are both at most {@link ResidentTailSize}, or the
+ * last mip if there is no such mip.
+ *
+ * A texture can only be created starting from a mip whose width and height
+ * are multiples of its format's block size, so for block-compressed textures
+ * whose size isn't a power of two, the tail may be finer than that.
+ *
+ * @param width The width of the texture's first mip, in texels.
+ * @param height The height of the texture's first mip, in texels.
+ * @param mipCount The number of mips in the texture.
+ * @param blockSizeX The width of a block of the texture's pixel format, in
+ * texels. This is 1 for uncompressed formats.
+ * @param blockSizeY The height of a block of the texture's pixel format, in
+ * texels. This is 1 for uncompressed formats.
+ */
+int32 computeTailMip(
+    int32 width,
+    int32 height,
+    int32 mipCount,
+    int32 blockSizeX,
+    int32 blockSizeY);
+
+/**
+ * Computes the index of the finest mip needed to draw a texture over a tile
+ * that is `screenSize` pixels across. This assumes that the texture spans the
+ * tile, so it chooses the coarsest mip that is still at least as large as the
+ * tile on screen. The result is never coarser than the tail mip.
+ *
+ * @param width The width of the texture's first mip, in texels.
+ * @param height The height of the texture's first mip, in texels.
+ * @param mipCount The number of mips in the texture.
+ * @param blockSizeX The width of a block of the texture's pixel format, in
+ * texels. See {@link computeTailMip}.
+ * @param blockSizeY The height of a block of the texture's pixel format, in
+ * texels. See {@link computeTailMip}.
+ * @param screenSize The projected size of the tile, in pixels. Zero or less
+ * means that the tile isn't visible.
+ */
+int32 computeFirstMipForScreenSize(
+    int32 width,
+    int32 height,
+    int32 mipCount,
+    int32 blockSizeX,
+    int32 blockSizeY,
+    double screenSize);
+
+/**
+ * The mips requested for one texture by the tiles that use it. The tiles may
+ * belong to several tilesets, which are updated one after another within a
+ * frame, so the requests of a frame are only complete once the next frame
+ * begins.
+ */
+class MipRequests {
+public:
+  /**
+   * @param tailMip The texture's tail mip, which is what a texture that isn't
+   * requested in a frame needs.
+   */
+  explicit MipRequests(int32 tailMip);
+
+  /**
+   * Records that a tile needs the texture from `firstMip` on in the given
+   * frame. The finest mip requested in a frame wins.
+   */
+  void request(int32 firstMip, uint64 frame);
+
+  /**
+   * Gets the finest mip requested so far in the given frame, or the tail mip
+   * if there were no requests.
+   */
+  int32 getRequestedFirstMip(uint64 frame) const;
+
+  /**
+   * Gets the finest mip requested in the given frame or the one before it.
+   * Mips finer than this shouldn't be dropped, because they may still be
+   * requested by tiles whose tilesets haven't been updated yet.
+   */
+  int32 getRetainedFirstMip(uint64 frame) const;
+
+private:
+  int32 _tailMip;
+  uint64 _frame;
+  int32 _firstMip;
+  uint64 _previousFrame;
+  int32 _previousFirstMip;
+};
+
+} // namespace CesiumTextureStreaming
@@ -39,6 +39,18 @@ struct ExtensionUnrealTexture {
       pTexture = nullptr;
 };
 
+void initTextureResource(UTexture2D* pTexture) {
+  ENQUEUE_RENDER_COMMAND(Cesium_InitResource)
+  ([pTexture, pTextureResource = pTexture->GetResource()](
+       FRHICommandListImmediate& RHICmdList) {
+    pTextureResource->SetTextureReference(
+        pTexture->TextureReference.TextureReferenceRHI);
+    pTextureResource->InitResource(
+        FRHICommandListImmediate::Get()); // Init Resource now requires a
+                                          // command list.
+  });
+}
+
 } // namespace
 
 namespace CesiumTextureUtility {
@@ -302,21 +314,44 @@ TUniquePtr<LoadedTextureResult> loadTextureAnyThreadPart(
     bool sRGB,
     std::optional<EPixelFormat> overridePixelFormat) {
   // The FCesiumTextureResource for the ImageAsset should already be created at
-  // this point, if it can be.
+  // this point, if it can be, though its upload may still be in flight.
   const ExtensionImageAssetUnreal& extension =
       ExtensionImageAssetUnreal::getOrCreate(
           CesiumAsync::AsyncSystem(nullptr),
           image,
           sRGB,
           useMipMapsIfAvailable,
-          overridePixelFormat);
-  check(extension.getFuture().isReady());
-  if (extension.getTextureResource() == nullptr) {
+          overridePixelFormat,
+          ECesiumTextureCompression::None,
+          false);
+  check(
+      extension.getFuture().isReady() ||
+      extension.getTextureResource() != nullptr);
+
+  return loadTextureAnyThreadPart(
+      extension.getTextureResource(),
+      addressX,
+      addressY,
+      filter,
+      useMipMapsIfAvailable,
+      group,
+      sRGB);
+}
+
+TUniquePtr<LoadedTextureResult> loadTextureAnyThreadPart(
+    const TSharedPtr<FCesiumTextureResource>& pTextureResource,
+    TextureAddress addressX,
+    TextureAddress addressY,
+    TextureFilter filter,
+    bool useMipMapsIfAvailable,
+    TextureGroup group,
+    bool sRGB) {
+  if (pTextureResource == nullptr) {
     return nullptr;
   }
 
   auto pResource = FCesiumTextureResource::CreateWrapped(
-      extension.getTextureResource(),
+      pTextureResource,
       group,
       filter,
       addressX,
@@ -376,18 +411,28 @@ loadTextureGameThreadPart(LoadedTextureResult* pHalfLoadedTexture) {
   }
 
   if (pTextureResource) {
+    const FGraphEventRef creationEvent = pTextureResource->GetCreationEvent();
+
     // Give the UTexture2D exclusive ownership of this FCesiumTextureResource.
     pTexture->SetResource(pTextureResource.Release());
 
-    ENQUEUE_RENDER_COMMAND(Cesium_InitResource)
-    ([pTexture, pTextureResource = pTexture->GetResource()](
-         FRHICommandListImmediate& RHICmdList) {
-      pTextureResource->SetTextureReference(
-          pTexture->TextureReference.TextureReferenceRHI);
-      pTextureResource->InitResource(
-          FRHICommandListImmediate::Get()); // Init Resource now requires a
-                                            // command list.
-    });
+    // A texture that wraps one whose upload is still in flight, such as a
+    // raster overlay's, can't be sampled yet. Rather than have the render
+    // thread wait for the upload, the resource is initialized once it's done,
+    // and the material samples the default texture until then.
+    if (creationEvent && !creationEvent->IsComplete()) {
+      FFunctionGraphTask::CreateAndDispatchWhenReady(
+          [pWeakTexture = TWeakObjectPtr<UTexture2D>(pTexture)]() {
+            if (pWeakTexture.IsValid()) {
+              initTextureResource(pWeakTexture.Get());
+            }
+          },
+          TStatId(),
+          creationEvent,
+          ENamedThreads::GameThread);
+    } else {
+      initTextureResource(pTexture);
+    }
   }
 
   return pHalfLoadedTexture->pTexture;
@@ -421,6 +466,60 @@ TextureAddress convertGltfWrapTToUnreal(int32_t wrapT) {
   }
 }
 
+bool reduceImageChannels(CesiumGltf::ImageAsset& image, int32 channels) {
+  check(channels >= 1 && channels <= 4);
+
+  const int32 sourceChannels = image.channels;
+  if (image.compressedPixelFormat !=
+          CesiumGltf::GpuCompressedPixelFormat::NONE ||
+      image.bytesPerChannel != 1 || sourceChannels < channels) {
+    return false;
+  }
+  if (sourceChannels == channels) {
+    return true;
+  }
+
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::ReduceImageChannels)
+
+  int32 sourceIndices[4] = {0, 1, 2, 3};
+  if (channels == 2) {
+    sourceIndices[1] = sourceChannels - 1;
+  }
+
+  if (image.mipPositions.empty()) {
+    image.mipPositions.push_back(
+        CesiumGltf::ImageAssetMipPosition{0, image.pixelData.size()});
+  }
+
+  // Each level is packed right after the previous one, which never overtakes
+  // the pixels still to be read.
+  uint8* pData = reinterpret_cast<uint8*>(image.pixelData.data());
+  size_t writeOffset = 0;
+  for (CesiumGltf::ImageAssetMipPosition& position : image.mipPositions) {
+    const size_t pixelCount = position.byteSize / size_t(sourceChannels);
+    const uint8* pSource = pData + position.byteOffset;
+    uint8* pTarget = pData + writeOffset;
+    for (size_t i = 0; i < pixelCount; ++i) {
+      for (int32 c = 0; c < channels; ++c) {
+        pTarget[i * channels + c] =
+            pSource[i * sourceChannels + sourceIndices[c]];
+      }
+    }
+
+    position.byteOffset = writeOffset;
+    position.byteSize = pixelCount * size_t(channels);
+    writeOffset += position.byteSize;
+  }
+
+  if (image.mipPositions.size() == 1) {
+    image.mipPositions.clear();
+  }
+  image.pixelData.resize(writeOffset);
+  image.pixelData.shrink_to_fit();
+  image.channels = channels;
+  return true;
+}
+
 std::optional<EPixelFormat> getPixelFormatForImageAsset(
     const CesiumGltf::ImageAsset& imageCesium,
     const std::optional<EPixelFormat> overridePixelFormat) {
@@ -145,6 +145,31 @@ TUniquePtr<LoadedTextureResult> loadTextureAnyThreadPart(
     bool sRGB,
     std::optional<EPixelFormat> overridePixelFormat);
 
+/**
+ * @brief Does the asynchronous part of renderer resource preparation for a
+ * texture that wraps an existing texture resource, such as one that was
+ * created for an image by {@link loadTextureAnyThreadPart} and is shared with
+ * other textures. This method may be called from any thread.
+ *
+ * @param pTextureResource The texture resource to wrap.
+ * @param addressX The X addressing mode.
+ * @param addressY The Y addressing mode.
+ * @param filter The sampler filtering to use for this texture.
+ * @param useMipMapsIfAvailable true to use the resource's mipmaps for sampling,
+ * if they exist; false to ignore any mipmaps that might be present.
+ * @param group The texture group of this texture.
+ * @param sRGB Whether this texture uses a sRGB color space.
+ * @return The loaded texture, or nullptr if the resource is nullptr.
+ */
+TUniquePtr<LoadedTextureResult> loadTextureAnyThreadPart(
+    const TSharedPtr<FCesiumTextureResource>& pTextureResource,
+    TextureAddress addressX,
+    TextureAddress addressY,
+    TextureFilter filter,
+    bool useMipMapsIfAvailable,
+    TextureGroup group,
+    bool sRGB);
+
 /**
  * @brief Does the main-thread part of render resource preparation for this
  * image and queues up any required render-thread tasks to finish preparing the
@@ -192,6 +217,20 @@ TextureAddress convertGltfWrapSToUnreal(int32_t wrapS);
  */
 TextureAddress convertGltfWrapTToUnreal(int32_t wrapT);
 
+/**
+ * @brief Removes channels from an uncompressed 8-bit image, in place, so that
+ * it has the given number of channels. Channels are kept in order, except that
+ * an image reduced to two channels keeps its first and last ones, which are
+ * usually a value and its alpha. Any mip positions are updated to match.
+ *
+ * @param image The image to reduce.
+ * @param channels The number of channels to keep, from 1 to 4.
+ * @returns True if the image now has the given number of channels, or false if
+ * it is compressed, has more than one byte per channel, or already has fewer
+ * channels than requested, in which case it is left unchanged.
+ */
+bool reduceImageChannels(CesiumGltf::ImageAsset& image, int32 channels);
+
 std::optional<EPixelFormat> getPixelFormatForImageAsset(
     const CesiumGltf::ImageAsset& imageCesium,
     const std::optional<EPixelFormat> overridePixelFormat);
@@ -0,0 +1,301 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumTileObjectPool.h"
+#include "CesiumGltfComponent.h"
+#include "CesiumLifetime.h"
+#include "CesiumMaterialInstanceCache.h"
+#include "CesiumPrimitive.h"
+#include "CesiumStats.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "UObject/Package.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Pooled Material Instances"),
+    STAT_CesiumPooledMaterials,
+    STATGROUP_Cesium);
+DECLARE_DWORD_ACCUMULATOR_STAT(
+    TEXT("Pooled Static Meshes"),
+    STAT_CesiumPooledStaticMeshes,
+    STATGROUP_Cesium);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Pooled Objects Reused"),
+    STAT_CesiumPoolHits,
+    STATGROUP_Cesium);
+DECLARE_DWORD_COUNTER_STAT(
+    TEXT("Pooled Object Misses"),
+    STAT_CesiumPoolMisses,
+    STATGROUP_Cesium);
+
+CesiumTileObjectPool::CesiumTileObjectPool(int32 maximumObjectsPerType)
+    : _maximumObjectsPerType(FMath::Max(maximumObjectsPerType, 0)),
+      _materials(),
+      _materialCount(0),
+      _staticMeshes(),
+      _releasingBatches() {}
+
+CesiumTileObjectPool::~CesiumTileObjectPool() {
+  // The pooled objects are left to the garbage collector, because this may be
+  // called while it is running.
+  DEC_DWORD_STAT_BY(STAT_CesiumPooledMaterials, this->_materialCount);
+  DEC_DWORD_STAT_BY(STAT_CesiumPooledStaticMeshes, this->getStaticMeshCount());
+}
+
+void CesiumTileObjectPool::setMaximumObjectsPerType(
+    int32 maximumObjectsPerType) {
+  maximumObjectsPerType = FMath::Max(maximumObjectsPerType, 0);
+  if (maximumObjectsPerType == this->_maximumObjectsPerType) {
+    return;
+  }
+
+  this->_maximumObjectsPerType = maximumObjectsPerType;
+  this->trim();
+}
+
+UMaterialInstanceDynamic*
+CesiumTileObjectPool::acquireMaterial(UMaterialInterface* pParent) {
+  TArray<TObjectPtr<UMaterialInstanceDynamic>>* pMaterials =
+      this->_materials.Find(pParent);
+  if (!pMaterials || pMaterials->IsEmpty()) {
+    INC_DWORD_STAT(STAT_CesiumPoolMisses);
+    return nullptr;
+  }
+
+  UMaterialInstanceDynamic* pMaterial = pMaterials->Pop(EAllowShrinking::No);
+  if (pMaterials->IsEmpty()) {
+    this->_materials.Remove(pParent);
+  }
+
+  --this->_materialCount;
+  DEC_DWORD_STAT(STAT_CesiumPooledMaterials);
+  INC_DWORD_STAT(STAT_CesiumPoolHits);
+
+  pMaterial->ClearParameterValues();
+  return pMaterial;
+}
+
+UStaticMesh*
+CesiumTileObjectPool::acquireStaticMesh(UObject& outer, FName name) {
+  this->collectReleasedStaticMeshes();
+
+  if (this->_staticMeshes.IsEmpty()) {
+    INC_DWORD_STAT(STAT_CesiumPoolMisses);
+    return nullptr;
+  }
+
+  DEC_DWORD_STAT(STAT_CesiumPooledStaticMeshes);
+  INC_DWORD_STAT(STAT_CesiumPoolHits);
+  UStaticMesh* pStaticMesh = this->_staticMeshes.Pop(EAllowShrinking::No);
+
+  // Move the mesh back out of the transient package, so that it is found and
+  // reported with its tile like a newly-created one.
+  pStaticMesh->Rename(
+      *MakeUniqueObjectName(&outer, UStaticMesh::StaticClass(), name)
+           .ToString(),
+      &outer,
+      REN_DontCreateRedirectors | REN_DoNotDirty | REN_NonTransactional);
+
+  // Clear the state that the previous tile may have left behind and that the
+  // new tile doesn't necessarily set.
+  pStaticMesh->SetExtendedBounds(FBoxSphereBounds(ForceInit));
+  pStaticMesh->SetPositiveBoundsExtension(FVector::ZeroVector);
+  pStaticMesh->SetNegativeBoundsExtension(FVector::ZeroVector);
+#if WITH_EDITORONLY_DATA
+  pStaticMesh->NaniteSettings = FMeshNaniteSettings();
+#endif
+  pStaticMesh->SetLightingGuid();
+
+  return pStaticMesh;
+}
+
+void CesiumTileObjectPool::recycle(
+    UCesiumGltfComponent& gltf,
+    bool recycleMaterials) {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::RecycleTileObjects)
+
+  ReleasingBatch batch;
+
+  for (USceneComponent* pChild : gltf.GetAttachChildren()) {
+    auto* pMesh = Cast<UStaticMeshComponent>(pChild);
+    if (!pMesh || !Cast<ICesiumPrimitive>(pMesh)) {
+      continue;
+    }
+
+    // Unregistering destroys the component's render and physics state, which
+    // would otherwise still refer to its mesh and material.
+    if (pMesh->IsRegistered()) {
+      pMesh->UnregisterComponent();
+    }
+
+    UStaticMesh* pStaticMesh = pMesh->GetStaticMesh();
+    UMaterialInstanceDynamic* pMaterial =
+        Cast<UMaterialInstanceDynamic>(pMesh->GetMaterial(0));
+
+    if (pMaterial &&
+        CesiumMaterialInstanceCache::releaseSharedMaterial(*pMesh, pMaterial)) {
+      // Shared material instances belong to their cache, so they're neither
+      // pooled nor destroyed here.
+      pMaterial = nullptr;
+      if (pStaticMesh) {
+        pStaticMesh->GetStaticMaterials().Empty();
+      }
+    }
+
+    const bool materialRecycled =
+        recycleMaterials && pMaterial && this->recycleMaterial(pMaterial);
+    if (materialRecycled) {
+      // Make sure the material isn't destroyed along with the component.
+      pMesh->EmptyOverrideMaterials();
+      if (pStaticMesh) {
+        pStaticMesh->GetStaticMaterials().Empty();
+      }
+    }
+
+    const int32 staticMeshCount =
+        this->getStaticMeshCount() + batch.meshes.Num();
+    if (!pStaticMesh || staticMeshCount >= this->_maximumObjectsPerType) {
+      continue;
+    }
+
+    pStaticMesh->GetStaticMaterials().Empty();
+    UBodySetup* pBodySetup = pStaticMesh->GetBodySetup();
+    if (pBodySetup) {
+      pStaticMesh->SetBodySetup(nullptr);
+      CesiumLifetime::destroy(pBodySetup);
+    }
+
+    pStaticMesh->ReleaseResources();
+
+    // Pooled meshes must not keep the unloaded tile's components alive
+    // through their outer.
+    pStaticMesh->Rename(
+        nullptr,
+        GetTransientPackage(),
+        REN_DontCreateRedirectors | REN_DoNotDirty | REN_NonTransactional);
+
+    pMesh->SetStaticMesh(nullptr);
+    batch.meshes.Add(pStaticMesh);
+
+    // The component would normally destroy the material along with the mesh,
+    // but it can no longer find it.
+    if (pMaterial && !materialRecycled) {
+      CesiumLifetime::destroy(pMaterial);
+    }
+  }
+
+  if (batch.meshes.IsEmpty()) {
+    return;
+  }
+
+  INC_DWORD_STAT_BY(STAT_CesiumPooledStaticMeshes, batch.meshes.Num());
+
+  // The meshes can't be reused until the render thread has released the
+  // resources created from their render data.
+  batch.pFence = MakeUnique<FRenderCommandFence>();
+  batch.pFence->BeginFence();
+  this->_releasingBatches.Add(MoveTemp(batch));
+}
+
+void CesiumTileObjectPool::clear() {
+  for (auto& pair : this->_materials) {
+    for (UMaterialInstanceDynamic* pMaterial : pair.Value) {
+      CesiumLifetime::destroy(pMaterial);
+    }
+  }
+  this->_materials.Empty();
+  DEC_DWORD_STAT_BY(STAT_CesiumPooledMaterials, this->_materialCount);
+  this->_materialCount = 0;
+
+  DEC_DWORD_STAT_BY(STAT_CesiumPooledStaticMeshes, this->getStaticMeshCount());
+  for (UStaticMesh* pMesh : this->_staticMeshes) {
+    CesiumLifetime::destroy(pMesh);
+  }
+  this->_staticMeshes.Empty();
+
+  for (const ReleasingBatch& batch : this->_releasingBatches) {
+    for (UStaticMesh* pMesh : batch.meshes) {
+      CesiumLifetime::destroy(pMesh);
+    }
+  }
+  this->_releasingBatches.Empty();
+}
+
+int32 CesiumTileObjectPool::getStaticMeshCount() const {
+  int32 count = this->_staticMeshes.Num();
+  for (const ReleasingBatch& batch : this->_releasingBatches) {
+    count += batch.meshes.Num();
+  }
+  return count;
+}
+
+void CesiumTileObjectPool::AddReferencedObjects(
+    FReferenceCollector& Collector) {
+  for (auto& pair : this->_materials) {
+    Collector.AddReferencedObjects(pair.Value);
+  }
+  Collector.AddReferencedObjects(this->_staticMeshes);
+  for (ReleasingBatch& batch : this->_releasingBatches) {
+    Collector.AddReferencedObjects(batch.meshes);
+  }
+}
+
+FString CesiumTileObjectPool::GetReferencerName() const {
+  return TEXT("CesiumTileObjectPool");
+}
+
+bool CesiumTileObjectPool::recycleMaterial(
+    UMaterialInstanceDynamic* pMaterial) {
+  if (this->_materialCount >= this->_maximumObjectsPerType ||
+      !pMaterial->Parent) {
+    return false;
+  }
+
+  this->_materials.FindOrAdd(pMaterial->Parent.Get()).Add(pMaterial);
+  ++this->_materialCount;
+  INC_DWORD_STAT(STAT_CesiumPooledMaterials);
+  return true;
+}
+
+void CesiumTileObjectPool::collectReleasedStaticMeshes() {
+  int32 completeBatches = 0;
+  for (ReleasingBatch& batch : this->_releasingBatches) {
+    if (!batch.pFence->IsFenceComplete()) {
+      break;
+    }
+
+    for (UStaticMesh* pMesh : batch.meshes) {
+      pMesh->SetRenderData(nullptr);
+      this->_staticMeshes.Add(pMesh);
+    }
+    ++completeBatches;
+  }
+
+  if (completeBatches > 0) {
+    this->_releasingBatches.RemoveAt(0, completeBatches, EAllowShrinking::No);
+  }
+}
+
+void CesiumTileObjectPool::trim() {
+  for (auto it = this->_materials.CreateIterator();
+       it && this->_materialCount > this->_maximumObjectsPerType;
+       ++it) {
+    TArray<TObjectPtr<UMaterialInstanceDynamic>>& materials = it.Value();
+    while (!materials.IsEmpty() &&
+           this->_materialCount > this->_maximumObjectsPerType) {
+      CesiumLifetime::destroy(materials.Pop(EAllowShrinking::No));
+      --this->_materialCount;
+      DEC_DWORD_STAT(STAT_CesiumPooledMaterials);
+    }
+    if (materials.IsEmpty()) {
+      it.RemoveCurrent();
+    }
+  }
+
+  while (!this->_staticMeshes.IsEmpty() &&
+         this->getStaticMeshCount() > this->_maximumObjectsPerType) {
+    CesiumLifetime::destroy(this->_staticMeshes.Pop(EAllowShrinking::No));
+    DEC_DWORD_STAT(STAT_CesiumPooledStaticMeshes);
+  }
+}
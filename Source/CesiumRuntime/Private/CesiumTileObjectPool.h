@@ -0,0 +1,124 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/Map.h"
+#include "RenderCommandFence.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/GCObject.h"
+#include "UObject/ObjectPtr.h"
+
+class UCesiumGltfComponent;
+class UMaterialInstanceDynamic;
+class UMaterialInterface;
+class UStaticMesh;
+
+/**
+ * @brief A per-tileset pool of the objects created for each glTF primitive,
+ * which allows them to be reused by newly-loaded tiles instead of being
+ * destroyed and reallocated.
+ *
+ * When a tile is unloaded, its dynamic material instances are pooled by parent
+ * material, and its static meshes are pooled once the render thread has
+ * released their render data. The number of pooled objects of each type is
+ * limited; objects that don't fit in the pool are destroyed as usual.
+ *
+ * This class may only be used from the game thread.
+ */
+class CesiumTileObjectPool : public FGCObject {
+public:
+  /**
+   * @brief Constructs an empty pool.
+   *
+   * @param maximumObjectsPerType The maximum number of material instances, and
+   * separately the maximum number of static meshes, that may be pooled.
+   */
+  explicit CesiumTileObjectPool(int32 maximumObjectsPerType);
+  ~CesiumTileObjectPool();
+
+  /**
+   * @brief Sets the maximum number of objects of each type that may be pooled.
+   * If the pool holds more than this, the excess objects are destroyed.
+   */
+  void setMaximumObjectsPerType(int32 maximumObjectsPerType);
+
+  /**
+   * @brief Gets a pooled material instance with the given parent, with all of
+   * its parameter values cleared.
+   *
+   * @return The material instance, or nullptr if none are available.
+   */
+  UMaterialInstanceDynamic* acquireMaterial(UMaterialInterface* pParent);
+
+  /**
+   * @brief Gets a pooled static mesh. The mesh has no render data, body setup,
+   * or materials. It is renamed into the given outer, as if it had just been
+   * created there, and its bounds, Nanite settings, and lighting GUID are
+   * reset.
+   *
+   * @param outer The object that the mesh will belong to.
+   * @param name The name to give the mesh. If the outer already has an object
+   * with this name, a unique name based on it is used instead.
+   * @return The static mesh, or nullptr if none are available.
+   */
+  UStaticMesh* acquireStaticMesh(UObject& outer, FName name);
+
+  /**
+   * @brief Moves the material instances and static meshes of a tile's
+   * primitives into this pool, as far as the pool has room for them. The
+   * primitive components are unregistered and left without a static mesh, so
+   * they can then be destroyed as usual.
+   *
+   * @param gltf The tile's glTF component.
+   * @param recycleMaterials Whether to pool the primitives' material instances.
+   */
+  void recycle(UCesiumGltfComponent& gltf, bool recycleMaterials);
+
+  /**
+   * @brief Destroys all pooled objects.
+   */
+  void clear();
+
+  /**
+   * @brief Gets the number of material instances in this pool.
+   */
+  int32 getMaterialCount() const { return this->_materialCount; }
+
+  /**
+   * @brief Gets the number of static meshes in this pool, including those
+   * whose render data is still being released.
+   */
+  int32 getStaticMeshCount() const;
+
+  // FGCObject overrides
+  virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+  virtual FString GetReferencerName() const override;
+
+private:
+  /**
+   * Static meshes whose render resources are being released on the render
+   * thread. They can be reused once the fence completes.
+   */
+  struct ReleasingBatch {
+    TArray<TObjectPtr<UStaticMesh>> meshes;
+    TUniquePtr<FRenderCommandFence> pFence;
+  };
+
+  bool recycleMaterial(UMaterialInstanceDynamic* pMaterial);
+  void collectReleasedStaticMeshes();
+  void trim();
+
+  int32 _maximumObjectsPerType;
+
+  // The keys are only used for lookup. The parents are kept alive by the
+  // material instances themselves.
+  TMap<UMaterialInterface*, TArray<TObjectPtr<UMaterialInstanceDynamic>>>
+      _materials;
+  int32 _materialCount;
+
+  TArray<TObjectPtr<UStaticMesh>> _staticMeshes;
+
+  // In the order they were recycled, so the oldest fence is at the front.
+  TArray<ReleasingBatch> _releasingBatches;
+};
@@ -0,0 +1,244 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumTriangleBvh.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <algorithm>
+
+namespace {
+struct BuildRange {
+  int32 nodeIndex;
+  int32 begin;
+  int32 end;
+};
+
+/**
+ * Intersects a segment, given as an origin and the reciprocal of its
+ * direction, with a box. Returns the parametric distance at which the segment
+ * enters the box, or std::nullopt if it misses the box or enters it after
+ * maxTime.
+ */
+std::optional<float> intersectBox(
+    const FBox3f& box,
+    const FVector3f& origin,
+    const FVector3f& inverseDirection,
+    float maxTime) {
+  float tMin = 0.0f;
+  float tMax = maxTime;
+  for (int32 axis = 0; axis < 3; ++axis) {
+    float t0 = (box.Min[axis] - origin[axis]) * inverseDirection[axis];
+    float t1 = (box.Max[axis] - origin[axis]) * inverseDirection[axis];
+    if (t0 > t1) {
+      std::swap(t0, t1);
+    }
+    // Written so that NaNs, which arise when the origin lies on a slab
+    // boundary of an axis the segment is parallel to, don't reject the box.
+    tMin = t0 > tMin ? t0 : tMin;
+    tMax = t1 < tMax ? t1 : tMax;
+    if (tMin > tMax) {
+      return std::nullopt;
+    }
+  }
+  return tMin;
+}
+} // namespace
+
+CesiumTriangleBvh::CesiumTriangleBvh(
+    TArray<FVector3f>&& positions,
+    TArray<uint32>&& indices)
+    : _positions(MoveTemp(positions)), _indices(MoveTemp(indices)) {
+  this->build();
+}
+
+void CesiumTriangleBvh::build() {
+  TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::BuildTriangleBvh)
+
+  const uint32 vertexCount = uint32(this->_positions.Num());
+  const int32 totalTriangleCount = this->_indices.Num() / 3;
+
+  TArray<FVector3f> centroids;
+  centroids.SetNumUninitialized(totalTriangleCount);
+  this->_triangleOrder.Reserve(totalTriangleCount);
+
+  for (int32 i = 0; i < totalTriangleCount; ++i) {
+    const uint32 i0 = this->_indices[3 * i];
+    const uint32 i1 = this->_indices[3 * i + 1];
+    const uint32 i2 = this->_indices[3 * i + 2];
+    if (i0 >= vertexCount || i1 >= vertexCount || i2 >= vertexCount) {
+      continue;
+    }
+    centroids[i] = (this->_positions[i0] + this->_positions[i1] +
+                    this->_positions[i2]) /
+                   3.0f;
+    this->_triangleOrder.Add(uint32(i));
+  }
+
+  if (this->_triangleOrder.IsEmpty()) {
+    return;
+  }
+
+  // A binary tree with at least one triangle per leaf never has more than
+  // 2n - 1 nodes.
+  this->_nodes.Reserve(2 * this->_triangleOrder.Num() - 1);
+  this->_nodes.Add(Node{FBox3f(ForceInit), 0, 0});
+
+  TArray<BuildRange, TInlineAllocator<64>> stack;
+  stack.Add(BuildRange{0, 0, this->_triangleOrder.Num()});
+
+  while (!stack.IsEmpty()) {
+    const BuildRange range = stack.Pop(EAllowShrinking::No);
+
+    FBox3f bounds(ForceInit);
+    FBox3f centroidBounds(ForceInit);
+    for (int32 i = range.begin; i < range.end; ++i) {
+      const uint32 triangle = this->_triangleOrder[i];
+      bounds += this->_positions[this->_indices[3 * triangle]];
+      bounds += this->_positions[this->_indices[3 * triangle + 1]];
+      bounds += this->_positions[this->_indices[3 * triangle + 2]];
+      centroidBounds += centroids[triangle];
+    }
+
+    const int32 count = range.end - range.begin;
+    const FVector3f extent = centroidBounds.GetSize();
+    const float maxExtent = extent.GetMax();
+
+    if (uint32(count) <= MaximumTrianglesPerLeaf || maxExtent <= 0.0f) {
+      this->_nodes[range.nodeIndex] =
+          Node{bounds, uint32(range.begin), uint32(count)};
+      continue;
+    }
+
+    const int32 axis = extent.X == maxExtent   ? 0
+                       : extent.Y == maxExtent ? 1
+                                               : 2;
+    const int32 middle = range.begin + count / 2;
+    std::nth_element(
+        this->_triangleOrder.GetData() + range.begin,
+        this->_triangleOrder.GetData() + middle,
+        this->_triangleOrder.GetData() + range.end,
+        [&centroids, axis](uint32 a, uint32 b) {
+          return centroids[a][axis] < centroids[b][axis];
+        });
+
+    const int32 firstChild = this->_nodes.Num();
+    this->_nodes.Add(Node{FBox3f(ForceInit), 0, 0});
+    this->_nodes.Add(Node{FBox3f(ForceInit), 0, 0});
+    this->_nodes[range.nodeIndex] = Node{bounds, uint32(firstChild), 0};
+
+    stack.Add(BuildRange{firstChild, range.begin, middle});
+    stack.Add(BuildRange{firstChild + 1, middle, range.end});
+  }
+
+  this->_nodes.Shrink();
+}
+
+std::optional<CesiumTriangleBvh::Hit> CesiumTriangleBvh::lineTrace(
+    const FVector3f& start,
+    const FVector3f& end) const {
+  if (this->_nodes.IsEmpty()) {
+    return std::nullopt;
+  }
+
+  const FVector3f direction = end - start;
+  if (direction.IsZero()) {
+    return std::nullopt;
+  }
+
+  const FVector3f inverseDirection(
+      1.0f / direction.X,
+      1.0f / direction.Y,
+      1.0f / direction.Z);
+
+  std::optional<Hit> result;
+  float closestTime = 1.0f;
+
+  TArray<uint32, TInlineAllocator<64>> stack;
+  stack.Add(0);
+
+  while (!stack.IsEmpty()) {
+    const Node& node = this->_nodes[stack.Pop(EAllowShrinking::No)];
+    if (!intersectBox(node.bounds, start, inverseDirection, closestTime)) {
+      continue;
+    }
+
+    if (node.triangleCount == 0) {
+      // Visit the nearer child first so that the farther one can more often
+      // be culled.
+      const uint32 first = node.firstIndex;
+      const uint32 second = node.firstIndex + 1;
+      const float firstDistance =
+          (this->_nodes[first].bounds.GetCenter() - start) | direction;
+      const float secondDistance =
+          (this->_nodes[second].bounds.GetCenter() - start) | direction;
+      if (firstDistance <= secondDistance) {
+        stack.Add(second);
+        stack.Add(first);
+      } else {
+        stack.Add(first);
+        stack.Add(second);
+      }
+      continue;
+    }
+
+    for (uint32 i = node.firstIndex; i < node.firstIndex + node.triangleCount;
+         ++i) {
+      const uint32 triangle = this->_triangleOrder[i];
+      const FVector3f& p0 = this->_positions[this->_indices[3 * triangle]];
+      const FVector3f& p1 = this->_positions[this->_indices[3 * triangle + 1]];
+      const FVector3f& p2 = this->_positions[this->_indices[3 * triangle + 2]];
+
+      // Moller-Trumbore intersection, without back-face culling.
+      const FVector3f edge1 = p1 - p0;
+      const FVector3f edge2 = p2 - p0;
+      const FVector3f p = direction ^ edge2;
+      const float determinant = edge1 | p;
+      if (determinant == 0.0f) {
+        continue;
+      }
+
+      const float inverseDeterminant = 1.0f / determinant;
+      const FVector3f fromP0 = start - p0;
+      const float u = (fromP0 | p) * inverseDeterminant;
+      if (u < 0.0f || u > 1.0f) {
+        continue;
+      }
+
+      const FVector3f q = fromP0 ^ edge1;
+      const float v = (direction | q) * inverseDeterminant;
+      if (v < 0.0f || u + v > 1.0f) {
+        continue;
+      }
+
+      const float t = (edge2 | q) * inverseDeterminant;
+      if (t < 0.0f || t > closestTime) {
+        continue;
+      }
+
+      FVector3f normal = (edge1 ^ edge2).GetSafeNormal();
+      if ((normal | direction) > 0.0f) {
+        normal = -normal;
+      }
+
+      closestTime = t;
+      result = Hit{
+          t,
+          int32(triangle),
+          FVector2f(u, v),
+          start + direction * t,
+          normal};
+    }
+  }
+
+  return result;
+}
+
+FBox3f CesiumTriangleBvh::getBounds() const {
+  return this->_nodes.IsEmpty() ? FBox3f(ForceInit) : this->_nodes[0].bounds;
+}
+
+int64 CesiumTriangleBvh::getMemorySize() const {
+  return sizeof(CesiumTriangleBvh) + this->_positions.GetAllocatedSize() +
+         this->_indices.GetAllocatedSize() +
+         this->_triangleOrder.GetAllocatedSize() +
+         this->_nodes.GetAllocatedSize();
+}
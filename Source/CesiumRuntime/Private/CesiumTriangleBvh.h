@@ -0,0 +1,119 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Math/Box.h"
+#include "Math/Vector.h"
+#include "Math/Vector2D.h"
+#include <optional>
+
+/**
+ * @brief A compact bounding volume hierarchy over the triangles of a single
+ * primitive, used to answer ray queries against a tileset without creating
+ * physics meshes.
+ *
+ * The hierarchy is built once, typically in a worker thread as the tile loads,
+ * and is immutable afterward. It can therefore be shared and queried from any
+ * thread.
+ */
+class CesiumTriangleBvh {
+public:
+  /**
+   * @brief The maximum number of triangles stored in a leaf node.
+   */
+  static constexpr uint32 MaximumTrianglesPerLeaf = 4;
+
+  /**
+   * @brief The result of a successful ray query.
+   */
+  struct Hit {
+    /**
+     * @brief The fraction of the distance from the start to the end of the
+     * segment at which the hit occurred, in the range [0, 1].
+     */
+    float time;
+
+    /**
+     * @brief The index of the triangle that was hit. This is the index of the
+     * triangle in the index list passed to the constructor, which matches the
+     * face index reported by the primitive's physics mesh.
+     */
+    int32 faceIndex;
+
+    /**
+     * @brief The barycentric coordinates of the hit with respect to the second
+     * and third vertices of the triangle. The weight of the first vertex is
+     * `1 - barycentric.X - barycentric.Y`.
+     */
+    FVector2f barycentric;
+
+    /**
+     * @brief The position of the hit.
+     */
+    FVector3f position;
+
+    /**
+     * @brief The unit normal of the triangle that was hit, oriented toward the
+     * start of the segment.
+     */
+    FVector3f normal;
+  };
+
+  /**
+   * @brief Builds a hierarchy over the given triangles.
+   *
+   * @param positions The vertex positions.
+   * @param indices The vertex indices, three per triangle. Triangles that
+   * refer to out-of-range vertices are ignored.
+   */
+  CesiumTriangleBvh(TArray<FVector3f>&& positions, TArray<uint32>&& indices);
+
+  /**
+   * @brief Finds the closest intersection of a line segment with the
+   * triangles in this hierarchy. Both sides of each triangle can be hit.
+   *
+   * @param start The start of the segment, in the same space as the positions.
+   * @param end The end of the segment, in the same space as the positions.
+   * @return The closest hit, or std::nullopt if the segment doesn't intersect
+   * any triangle.
+   */
+  std::optional<Hit>
+  lineTrace(const FVector3f& start, const FVector3f& end) const;
+
+  /**
+   * @brief Gets the bounds of all of the triangles in this hierarchy.
+   */
+  FBox3f getBounds() const;
+
+  /**
+   * @brief Gets the number of triangles in this hierarchy.
+   */
+  int32 getTriangleCount() const { return this->_triangleOrder.Num(); }
+
+  /**
+   * @brief Gets the approximate number of bytes used by this hierarchy.
+   */
+  int64 getMemorySize() const;
+
+private:
+  struct Node {
+    FBox3f bounds;
+    /**
+     * For a leaf, the index of its first entry in _triangleOrder. Otherwise,
+     * the index of its first child. The second child immediately follows it.
+     */
+    uint32 firstIndex;
+    /**
+     * The number of triangles in a leaf, or 0 for an interior node.
+     */
+    uint32 triangleCount;
+  };
+
+  void build();
+
+  TArray<FVector3f> _positions;
+  TArray<uint32> _indices;
+  TArray<uint32> _triangleOrder;
+  TArray<Node> _nodes;
+};
@@ -4,6 +4,7 @@
 
 #include "CesiumEncodedMetadataComponent.h"
 #include "CesiumFeaturesMetadataDescription.h"
+#include "CesiumTextureCompression.h"
 #include "CesiumGltf/Mesh.h"
 #include "CesiumGltf/MeshPrimitive.h"
 #include "CesiumGltf/Model.h"
@@ -45,6 +46,12 @@ struct CreateModelOptions {
    */
   bool createPhysicsMeshes = true;
 
+  /**
+   * Whether to build bounding volume hierarchies for picking the model's
+   * triangles without physics.
+   */
+  bool createPickingBvhs = false;
+
   /**
    * Whether to ignore the KHR_materials_unlit extension in the model. If this
    * is true and the extension is present, then flat normals will be generated
@@ -52,6 +59,37 @@ struct CreateModelOptions {
    */
   bool ignoreKhrMaterialsUnlit = false;
 
+  /**
+   * Whether to build Nanite resources for the triangle primitives in the model.
+   * This is only honored if the Nanite builder is available.
+   */
+  bool buildNanite = false;
+
+  /**
+   * Whether to sort the points of points primitives so that they can be
+   * decimated by drawing a prefix of them.
+   */
+  bool sortPointsProgressively = false;
+
+  /**
+   * Whether and how to block-compress the model's uncompressed textures.
+   */
+  ECesiumTextureCompression textureCompression =
+      ECesiumTextureCompression::None;
+
+  /**
+   * Whether to upload only the coarsest mips of the model's textures at first
+   * and stream in the rest as they are needed.
+   */
+  bool streamTextureMips = false;
+
+  /**
+   * Whether to keep a CPU copy of the vertex and index buffers of the model's
+   * meshes, so that they can be uploaded again after they are evicted from the
+   * GPU.
+   */
+  bool keepMeshDataOnCpu = false;
+
   Cesium3DTilesSelection::TileLoadResult tileLoadResult;
 
 public:
@@ -66,7 +104,13 @@ public:
             other.pEncodedMetadataDescription_DEPRECATED),
         alwaysIncludeTangents(other.alwaysIncludeTangents),
         createPhysicsMeshes(other.createPhysicsMeshes),
+        createPickingBvhs(other.createPickingBvhs),
         ignoreKhrMaterialsUnlit(other.ignoreKhrMaterialsUnlit),
+        buildNanite(other.buildNanite),
+        sortPointsProgressively(other.sortPointsProgressively),
+        textureCompression(other.textureCompression),
+        streamTextureMips(other.streamTextureMips),
+        keepMeshDataOnCpu(other.keepMeshDataOnCpu),
         tileLoadResult(std::move(other.tileLoadResult)) {
     pModel = std::get_if<CesiumGltf::Model>(&this->tileLoadResult.contentKind);
   }
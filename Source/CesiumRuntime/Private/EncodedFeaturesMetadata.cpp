@@ -2,6 +2,7 @@
 
 #include "EncodedFeaturesMetadata.h"
 
+#include "Async/ParallelFor.h"
 #include "CesiumFeatureIdSet.h"
 #include "CesiumFeaturesMetadataComponent.h"
 #include "CesiumLifetime.h"
@@ -12,8 +13,11 @@
 #include "CesiumPropertyTable.h"
 #include "CesiumPropertyTexture.h"
 #include "CesiumRuntime.h"
+#include "CesiumTextureCache.h"
 #include "Containers/Map.h"
 #include "EncodedMetadataConversions.h"
+#include "ExtensionImageAssetUnreal.h"
+#include "Hash/xxhash.h"
 #include "Materials/MaterialInstanceDynamic.h"
 #include "PixelFormat.h"
 #include "TextureResource.h"
@@ -22,7 +26,8 @@
 #include <CesiumGltf/FeatureIdTextureView.h>
 #include <CesiumUtility/Tracing.h>
 #include <optional>
-#include <unordered_map>
+#include <span>
+#include <string>
 
 using namespace CesiumTextureUtility;
 
@@ -436,6 +441,69 @@ bool isValidPropertyTexturePropertyDescription(
   return true;
 }
 
+template <typename T> void updateHash(FXxHash128Builder& builder, T value) {
+  builder.Update(&value, sizeof(T));
+}
+
+void updateHash(FXxHash128Builder& builder, std::span<const std::byte> data) {
+  updateHash(builder, uint64(data.size()));
+  builder.Update(data.data(), data.size());
+}
+
+void updateHash(FXxHash128Builder& builder, const std::string& value) {
+  updateHash(builder, std::as_bytes(std::span(value)));
+}
+
+/**
+ * Computes the key that the texture encoded for the given property is cached
+ * by, from everything that the encoded pixels depend on. Returns std::nullopt
+ * if the texture can't be identified by the property's source data.
+ *
+ * Only properties coerced from their raw values are cached. Strings parsed as
+ * colors are read with their no data values replaced by the default value, so
+ * the encoded pixels also depend on the property's class definition.
+ */
+std::optional<FXxHash128> computeEncodedTextureKey(
+    const FCesiumPropertyTablePropertyDescription& description,
+    const FCesiumPropertyTableProperty& property,
+    int64 featureCount,
+    const EncodedPixelFormat& encodedFormat) {
+  if (description.EncodingDetails.Conversion !=
+      ECesiumEncodedMetadataConversion::Coerce) {
+    return std::nullopt;
+  }
+
+  const FCesiumPropertyTablePropertySource& source =
+      UCesiumPropertyTablePropertyBlueprintLibrary::GetSourceData(property);
+  if (source.values.empty()) {
+    return std::nullopt;
+  }
+
+  // Arrays are encoded from their transformed values, which also depend on
+  // the property's offset, scale, no data value, and default value.
+  const FCesiumMetadataValueType valueType =
+      UCesiumPropertyTablePropertyBlueprintLibrary::GetValueType(property);
+  if (valueType.bIsArray) {
+    return std::nullopt;
+  }
+
+  FXxHash128Builder builder;
+  updateHash(builder, source.values);
+  updateHash(builder, source.arrayOffsets);
+  updateHash(builder, source.stringOffsets);
+  updateHash(builder, source.arrayOffsetType);
+  updateHash(builder, source.stringOffsetType);
+
+  updateHash(builder, valueType.Type);
+  updateHash(builder, valueType.ComponentType);
+  updateHash(builder, description.EncodingDetails.Type);
+  updateHash(builder, description.EncodingDetails.ComponentType);
+  updateHash(builder, encodedFormat.format);
+  updateHash(builder, featureCount);
+
+  return builder.Finalize();
+}
+
 } // namespace
 
 EncodedPropertyTable encodePropertyTableAnyThreadPart(
@@ -453,6 +521,16 @@ EncodedPropertyTable encodePropertyTableAnyThreadPart(
   const TMap<FString, FCesiumPropertyTableProperty>& properties =
       UCesiumPropertyTableBlueprintLibrary::GetProperties(propertyTable);
 
+  // The properties are validated here, but their textures are encoded later,
+  // in parallel, since encoding is most of the work for large tables.
+  struct TextureJob {
+    const FCesiumPropertyTablePropertyDescription* pDescription;
+    const FCesiumPropertyTableProperty* pProperty;
+    EncodedPixelFormat encodedFormat;
+    int32 encodedPropertyIndex;
+  };
+  TArray<TextureJob> textureJobs;
+
   encodedPropertyTable.properties.Reserve(properties.Num());
   for (const auto& pair : properties) {
     const FCesiumPropertyTableProperty& property = pair.Value;
@@ -512,8 +590,6 @@ EncodedPropertyTable encodePropertyTableAnyThreadPart(
       continue;
     }
 
-    TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::EncodePropertyTableProperty)
-
     EncodedPropertyTableProperty& encodedProperty =
         encodedPropertyTable.properties.Emplace_GetRef();
     encodedProperty.name = createHlslSafeName(pDescription->Name);
@@ -522,46 +598,11 @@ EncodedPropertyTable encodePropertyTableAnyThreadPart(
     if (UCesiumPropertyTablePropertyBlueprintLibrary::
             GetPropertyTablePropertyStatus(property) ==
         ECesiumPropertyTablePropertyStatus::Valid) {
-
-      int64 floorSqrtFeatureCount = glm::sqrt(propertyTableCount);
-      int64 textureDimension =
-          (floorSqrtFeatureCount * floorSqrtFeatureCount == propertyTableCount)
-              ? floorSqrtFeatureCount
-              : (floorSqrtFeatureCount + 1);
-
-      CesiumUtility::IntrusivePointer<CesiumGltf::ImageAsset> pImage =
-          new CesiumGltf::ImageAsset();
-      pImage->width = pImage->height = textureDimension;
-      pImage->bytesPerChannel = encodedFormat.bytesPerChannel;
-      pImage->channels = encodedFormat.channels;
-      pImage->pixelData.resize(
-          textureDimension * textureDimension * encodedFormat.bytesPerChannel *
-          encodedFormat.channels);
-
-      if (encodingDetails.Conversion ==
-          ECesiumEncodedMetadataConversion::ParseColorFromString) {
-        CesiumEncodedMetadataParseColorFromString::encode(
-            *pDescription,
-            property,
-            std::span(pImage->pixelData),
-            encodedFormat.bytesPerChannel * encodedFormat.channels);
-      } else /* info.Conversion == ECesiumEncodedMetadataConversion::Coerce */ {
-        CesiumEncodedMetadataCoerce::encode(
-            *pDescription,
-            property,
-            std::span(pImage->pixelData),
-            encodedFormat.bytesPerChannel * encodedFormat.channels);
-      }
-
-      encodedProperty.pTexture = loadTextureAnyThreadPart(
-          *pImage,
-          TextureAddress::TA_Clamp,
-          TextureAddress::TA_Clamp,
-          TextureFilter::TF_Nearest,
-          false,
-          TEXTUREGROUP_8BitData,
-          false,
-          encodedFormat.format);
+      textureJobs.Add(
+          {pDescription,
+           &property,
+           encodedFormat,
+           encodedPropertyTable.properties.Num() - 1});
     }
 
     if (pDescription->PropertyDetails.bHasOffset) {
@@ -605,6 +646,81 @@ EncodedPropertyTable encodePropertyTableAnyThreadPart(
     }
   }
 
+  int64 floorSqrtFeatureCount = glm::sqrt(propertyTableCount);
+  int64 textureDimension =
+      (floorSqrtFeatureCount * floorSqrtFeatureCount == propertyTableCount)
+          ? floorSqrtFeatureCount
+          : (floorSqrtFeatureCount + 1);
+
+  // Each job writes only to its own image and encoded property.
+  ParallelFor(textureJobs.Num(), [&](int32 jobIndex) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::EncodePropertyTableProperty)
+
+    const TextureJob& job = textureJobs[jobIndex];
+    const FCesiumPropertyTablePropertyDescription& description =
+        *job.pDescription;
+    const EncodedPixelFormat& encodedFormat = job.encodedFormat;
+    TUniquePtr<LoadedTextureResult>& pTexture =
+        encodedPropertyTable.properties[job.encodedPropertyIndex].pTexture;
+
+    const auto encode = [&]() -> TSharedPtr<FCesiumTextureResource> {
+      CesiumUtility::IntrusivePointer<CesiumGltf::ImageAsset> pImage =
+          new CesiumGltf::ImageAsset();
+      pImage->width = pImage->height = textureDimension;
+      pImage->bytesPerChannel = encodedFormat.bytesPerChannel;
+      pImage->channels = encodedFormat.channels;
+      pImage->pixelData.resize(
+          textureDimension * textureDimension *
+          encodedFormat.bytesPerChannel * encodedFormat.channels);
+
+      if (description.EncodingDetails.Conversion ==
+          ECesiumEncodedMetadataConversion::ParseColorFromString) {
+        CesiumEncodedMetadataParseColorFromString::encode(
+            description,
+            *job.pProperty,
+            std::span(pImage->pixelData),
+            encodedFormat.bytesPerChannel * encodedFormat.channels);
+      } else /* info.Conversion == ECesiumEncodedMetadataConversion::Coerce */ {
+        CesiumEncodedMetadataCoerce::encode(
+            description,
+            *job.pProperty,
+            std::span(pImage->pixelData),
+            encodedFormat.bytesPerChannel * encodedFormat.channels);
+      }
+
+      return ExtensionImageAssetUnreal::getOrCreate(
+                 CesiumAsync::AsyncSystem(nullptr),
+                 *pImage,
+                 false,
+                 false,
+                 encodedFormat.format,
+                 ECesiumTextureCompression::None,
+                 false)
+          .getTextureResource();
+    };
+
+    // Tiles often have property tables with the same data, such as tiles of
+    // external tilesets that load the same glTF. Such properties are only
+    // encoded once, and share one texture for as long as any tile uses it.
+    const std::optional<FXxHash128> maybeKey = computeEncodedTextureKey(
+        description,
+        *job.pProperty,
+        propertyTableCount,
+        encodedFormat);
+    TSharedPtr<FCesiumTextureResource> pTextureResource =
+        maybeKey ? CesiumTextureCache::getOrCreate(*maybeKey, encode)
+                 : encode();
+
+    pTexture = loadTextureAnyThreadPart(
+        pTextureResource,
+        TextureAddress::TA_Clamp,
+        TextureAddress::TA_Clamp,
+        TextureFilter::TF_Nearest,
+        false,
+        TEXTUREGROUP_8BitData,
+        false);
+  });
+
   return encodedPropertyTable;
 }
 
@@ -621,6 +737,16 @@ EncodedPropertyTexture encodePropertyTextureAnyThreadPart(
   const TMap<FString, FCesiumPropertyTextureProperty>& properties =
       UCesiumPropertyTextureBlueprintLibrary::GetProperties(propertyTexture);
 
+  // Images that haven't been loaded as textures yet are loaded after all of
+  // the properties are validated, in parallel.
+  struct TextureJob {
+    const FCesiumPropertyTextureProperty* pProperty = nullptr;
+    TArray<int32, TInlineAllocator<4>> encodedPropertyIndices;
+    TSharedPtr<LoadedTextureResult> pTexture;
+  };
+  TArray<TextureJob> textureJobs;
+  TMap<const CesiumGltf::ImageAsset*, int32> textureJobIndices;
+
   encodedPropertyTexture.properties.Reserve(properties.Num());
 
   for (const auto& pair : properties) {
@@ -640,7 +766,6 @@ EncodedPropertyTexture encodePropertyTextureAnyThreadPart(
     if (!isValidPropertyTexturePropertyDescription(*pDescription, property)) {
       continue;
     }
-    TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::EncodePropertyTextureProperty)
 
     EncodedPropertyTextureProperty& encodedProperty =
         encodedPropertyTexture.properties.Emplace_GetRef();
@@ -667,32 +792,18 @@ EncodedPropertyTexture encodePropertyTextureAnyThreadPart(
       if (pMappedUnrealImageIt) {
         encodedProperty.pTexture = pMappedUnrealImageIt->Pin();
       } else {
-        TextureAddress addressX = TextureAddress::TA_Wrap;
-        TextureAddress addressY = TextureAddress::TA_Wrap;
-
-        const CesiumGltf::Sampler* pSampler = property.getSampler();
-        if (pSampler) {
-          addressX = convertGltfWrapSToUnreal(pSampler->wrapS);
-          addressY = convertGltfWrapTToUnreal(pSampler->wrapT);
+        // Properties that share an image also share the texture loaded for
+        // it.
+        int32 jobIndex;
+        if (const int32* pJobIndex = textureJobIndices.Find(pImage)) {
+          jobIndex = *pJobIndex;
+        } else {
+          jobIndex = textureJobs.Emplace();
+          textureJobs[jobIndex].pProperty = &property;
+          textureJobIndices.Emplace(pImage, jobIndex);
         }
-
-        // Copy the image, so that we can keep a copy of it in the glTF.
-        CesiumUtility::IntrusivePointer<CesiumGltf::ImageAsset> pImageCopy =
-            new CesiumGltf::ImageAsset(*pImage);
-        encodedProperty.pTexture =
-            MakeShared<LoadedTextureResult>(std::move(*loadTextureAnyThreadPart(
-                *pImageCopy,
-                addressX,
-                addressY,
-                // TODO: account for texture filter
-                TextureFilter::TF_Nearest,
-                false,
-                TEXTUREGROUP_8BitData,
-                false,
-                // This assumes that the texture's image only contains one byte
-                // per channel.
-                EPixelFormat::PF_R8G8B8A8_UINT)));
-        propertyTexturePropertyMap.Emplace(pImage, encodedProperty.pTexture);
+        textureJobs[jobIndex].encodedPropertyIndices.Add(
+            encodedPropertyTexture.properties.Num() - 1);
       }
     };
 
@@ -723,6 +834,47 @@ EncodedPropertyTexture encodePropertyTextureAnyThreadPart(
     }
   }
 
+  ParallelFor(textureJobs.Num(), [&textureJobs](int32 jobIndex) {
+    TRACE_CPUPROFILER_EVENT_SCOPE(Cesium::EncodePropertyTextureProperty)
+
+    TextureJob& job = textureJobs[jobIndex];
+    const FCesiumPropertyTextureProperty& property = *job.pProperty;
+
+    TextureAddress addressX = TextureAddress::TA_Wrap;
+    TextureAddress addressY = TextureAddress::TA_Wrap;
+
+    const CesiumGltf::Sampler* pSampler = property.getSampler();
+    if (pSampler) {
+      addressX = convertGltfWrapSToUnreal(pSampler->wrapS);
+      addressY = convertGltfWrapTToUnreal(pSampler->wrapT);
+    }
+
+    // Copy the image, so that we can keep a copy of it in the glTF.
+    CesiumUtility::IntrusivePointer<CesiumGltf::ImageAsset> pImageCopy =
+        new CesiumGltf::ImageAsset(*property.getImage());
+    job.pTexture =
+        MakeShared<LoadedTextureResult>(std::move(*loadTextureAnyThreadPart(
+            *pImageCopy,
+            addressX,
+            addressY,
+            // TODO: account for texture filter
+            TextureFilter::TF_Nearest,
+            false,
+            TEXTUREGROUP_8BitData,
+            false,
+            // This assumes that the texture's image only contains one byte
+            // per channel.
+            EPixelFormat::PF_R8G8B8A8_UINT)));
+  });
+
+  for (TextureJob& job : textureJobs) {
+    for (int32 encodedPropertyIndex : job.encodedPropertyIndices) {
+      encodedPropertyTexture.properties[encodedPropertyIndex].pTexture =
+          job.pTexture;
+    }
+    propertyTexturePropertyMap.Emplace(job.pProperty->getImage(), job.pTexture);
+  }
+
   return encodedPropertyTexture;
 }
 
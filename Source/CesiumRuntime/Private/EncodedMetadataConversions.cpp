@@ -191,6 +191,24 @@ void coerceAndEncodeScalars(
 
   T* pWritePos = reinterpret_cast<T*>(textureData.data());
 
+  // Numeric scalar properties can be copied in a single pass over the
+  // property's buffer, without creating an FCesiumMetadataValue for each
+  // feature.
+  const TArrayView<T> values(pWritePos, int32(propertySize));
+  if constexpr (std::is_same_v<T, uint8>) {
+    if (UCesiumPropertyTablePropertyBlueprintLibrary::GetRawByteValues(
+            property,
+            values)) {
+      return;
+    }
+  } else if constexpr (std::is_same_v<T, float>) {
+    if (UCesiumPropertyTablePropertyBlueprintLibrary::GetRawFloatValues(
+            property,
+            values)) {
+      return;
+    }
+  }
+
   for (int64 i = 0; i < propertySize; ++i) {
     FCesiumMetadataValue value =
         UCesiumPropertyTablePropertyBlueprintLibrary::GetRawValue(property, i);
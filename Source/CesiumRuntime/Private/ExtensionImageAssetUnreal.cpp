@@ -1,15 +1,37 @@
 #include "ExtensionImageAssetUnreal.h"
 #include "CesiumRuntime.h"
+#include "CesiumTextureCache.h"
 #include "CesiumTextureUtility.h"
 #include <CesiumGltf/ImageAsset.h>
 #include <CesiumGltfReader/GltfReader.h>
+#include <mutex>
 
 using namespace CesiumAsync;
 using namespace CesiumGltfReader;
 
 namespace {
 
-std::mutex createExtensionMutex;
+// Adding an extension to an ImageAsset isn't thread-safe, so the threads that
+// look for or add the extension of the same image must be serialized. They
+// only need to be serialized with each other, though, so rather than one
+// mutex for every image, there is a small table of mutexes that images are
+// assigned to by their address. Threads working on different images rarely
+// wait for each other. Each mutex has a cache line to itself so that taking
+// one doesn't slow down threads taking its neighbors.
+struct alignas(PLATFORM_CACHE_LINE_SIZE) ExtensionMutex {
+  std::mutex mutex;
+};
+
+constexpr size_t ExtensionMutexCount = 64;
+ExtensionMutex extensionMutexes[ExtensionMutexCount];
+
+std::mutex& getExtensionMutex(const CesiumGltf::ImageAsset& imageCesium) {
+  // The low bits of the address are the same for every image, because of
+  // alignment, and the high bits are the same for most of them.
+  const uint64 address = uint64(reinterpret_cast<UPTRINT>(&imageCesium));
+  const uint64 hash = (address >> 4) * 0x9E3779B97F4A7C15ull;
+  return extensionMutexes[(hash >> 32) % ExtensionMutexCount].mutex;
+}
 
 std::pair<ExtensionImageAssetUnreal&, std::optional<Promise<void>>>
 getOrCreateImageFuture(
@@ -24,7 +46,9 @@ ExtensionImageAssetUnreal::getOrCreate(
     CesiumGltf::ImageAsset& imageCesium,
     bool sRGB,
     bool needsMipMaps,
-    const std::optional<EPixelFormat>& overridePixelFormat) {
+    const std::optional<EPixelFormat>& overridePixelFormat,
+    ECesiumTextureCompression compression,
+    bool streamMips) {
   auto [extension, maybePromise] =
       getOrCreateImageFuture(asyncSystem, imageCesium);
   if (!maybePromise) {
@@ -32,36 +56,30 @@ ExtensionImageAssetUnreal::getOrCreate(
     return extension;
   }
 
-  // Proceed to load the image in this thread.
-  TUniquePtr<FCesiumTextureResource, FCesiumTextureResourceDeleter> pResource =
-      FCesiumTextureResource::CreateNew(
-          imageCesium,
-          TextureGroup::TEXTUREGROUP_World,
-          overridePixelFormat,
-          TextureFilter::TF_Default,
-          TextureAddress::TA_Clamp,
-          TextureAddress::TA_Clamp,
-          sRGB,
-          needsMipMaps);
-
-  extension._pTextureResource =
-      MakeShareable(pResource.Release(), [](FCesiumTextureResource* p) {
-        FCesiumTextureResource ::Destroy(p);
-      });
-
-  // For texture resources created from glTF _textures_, this will happen later
-  // (after we created the UTexture2D). But this texture resource, created for
-  // an ImageAsset, will never have a UTexture2D, so we initialize its resources
-  // here.
-  ENQUEUE_RENDER_COMMAND(Cesium_InitResource)
-  ([pResource = extension._pTextureResource](
-       FRHICommandListImmediate& RHICmdList) mutable {
-    pResource->InitResource(
-        FRHICommandListImmediate::Get()); // Init Resource now requires a
-                                          // command list.
-  });
-
-  maybePromise->resolve();
+  // Proceed to load the image in this thread, unless a texture with the same
+  // pixels is already in use.
+  extension._pTextureResource = CesiumTextureCache::getOrCreate(
+      imageCesium,
+      sRGB,
+      needsMipMaps,
+      overridePixelFormat,
+      compression,
+      streamMips);
+
+  // If the RHI is still uploading the texture, resolve once it's done rather
+  // than waiting for it here.
+  FGraphEventRef creationEvent;
+  if (extension._pTextureResource) {
+    creationEvent = extension._pTextureResource->GetCreationEvent();
+  }
+  if (creationEvent && !creationEvent->IsComplete()) {
+    FFunctionGraphTask::CreateAndDispatchWhenReady(
+        [promise = std::move(*maybePromise)]() { promise.resolve(); },
+        TStatId(),
+        creationEvent);
+  } else {
+    maybePromise->resolve();
+  }
 
   return extension;
 }
@@ -94,7 +112,7 @@ std::pair<ExtensionImageAssetUnreal&, std::optional<Promise<void>>>
 getOrCreateImageFuture(
     const AsyncSystem& asyncSystem,
     CesiumGltf::ImageAsset& imageCesium) {
-  std::scoped_lock lock(createExtensionMutex);
+  std::scoped_lock lock(getExtensionMutex(imageCesium));
 
   ExtensionImageAssetUnreal* pExtension =
       imageCesium.getExtension<ExtensionImageAssetUnreal>();
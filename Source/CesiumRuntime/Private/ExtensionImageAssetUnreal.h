@@ -18,7 +18,9 @@ struct ImageAsset;
  *
  * ImageAsset instances are shared between multiple textures on a single model,
  * and even between models in some cases, but we strive to have only one copy of
- * the image bytes in GPU memory.
+ * the image bytes in GPU memory. Separate ImageAsset instances with the same
+ * pixels, such as images embedded in many tiles, share a texture resource
+ * through the `CesiumTextureCache`.
  *
  * The Unreal / GPU resource is held in `pTextureResource`, which may be either
  * a `FCesiumCreateNewTextureResource` or a `FCesiumUseExistingTextureResource`
@@ -49,14 +51,24 @@ struct ExtensionImageAssetUnreal {
    * at the same time.
    *
    * To determine if the asynchronous `FTextureResource` creation process has
-   * completed, use {@link getFuture}.
+   * completed, use {@link getFuture}. When the RHI supports asynchronous
+   * texture creation, the future resolves once the texture has finished
+   * uploading, without blocking the calling thread in the meantime. The
+   * resource itself is available as soon as the call that created it returns.
+   *
+   * The `compression` and `streamMips` are only honored by the call that
+   * creates the resource. Images that are sampled as data rather than color,
+   * such as feature ID textures, must be created with
+   * `ECesiumTextureCompression::None`.
    */
   static const ExtensionImageAssetUnreal& getOrCreate(
       const CesiumAsync::AsyncSystem& asyncSystem,
       CesiumGltf::ImageAsset& imageCesium,
       bool sRGB,
       bool needsMipMaps,
-      const std::optional<EPixelFormat>& overridePixelFormat);
+      const std::optional<EPixelFormat>& overridePixelFormat,
+      ECesiumTextureCompression compression,
+      bool streamMips);
 
   /**
    * Constructs a new instance.
@@ -67,8 +79,8 @@ struct ExtensionImageAssetUnreal {
   ExtensionImageAssetUnreal(const CesiumAsync::SharedFuture<void>& future);
 
   /**
-   * Gets the created texture resource. This resource should not be accessed or
-   * used before the future returned by {@link getFuture} resolves.
+   * Gets the created texture resource. This resource should not be sampled
+   * before the future returned by {@link getFuture} resolves.
    */
   const TSharedPtr<FCesiumTextureResource>& getTextureResource() const;
 
@@ -9,6 +9,7 @@
 #include "CesiumPrimitiveMetadata.h"
 #include "CesiumRasterOverlays.h"
 #include "CesiumTextureUtility.h"
+#include "CesiumTriangleBvh.h"
 #include "Chaos/TriangleMeshImplicitObject.h"
 #include "Containers/Map.h"
 #include "Containers/UnrealString.h"
@@ -61,6 +62,35 @@ struct LoadedPrimitiveResult {
 
   Chaos::FTriangleMeshImplicitObjectPtr pCollisionMesh = nullptr;
 
+  /**
+   * The bounding volume hierarchy used to pick this primitive without physics,
+   * if one was built.
+   */
+  TSharedPtr<const CesiumTriangleBvh> pPickingBvh = nullptr;
+
+  /**
+   * The number of bytes in the vertex buffers of the render data.
+   */
+  int64 vertexBufferBytes = 0;
+
+  /**
+   * The number of bytes in the index buffer of the render data.
+   */
+  int64 indexBufferBytes = 0;
+
+  /**
+   * The number of bytes of vertex and index buffer data that is also kept on
+   * the CPU, so that the buffers can be uploaded again after they are
+   * evicted from the GPU.
+   */
+  int64 meshCpuCopyBytes = 0;
+
+  /**
+   * The estimated number of bytes used by the collision mesh and picking
+   * hierarchy, if any.
+   */
+  int64 collisionMeshBytes = 0;
+
   std::string name{};
 
   TUniquePtr<CesiumTextureUtility::LoadedTextureResult> baseColorTexture;
@@ -99,6 +129,13 @@ struct LoadedPrimitiveResult {
    */
   glm::vec3 dimensions;
 
+  /**
+   * Whether the points of a points primitive have been sorted so that any
+   * prefix of them covers the primitive evenly. Passed to a
+   * CesiumGltfPointsComponent for use in decimating the points.
+   */
+  bool pointsInProgressiveOrder = false;
+
 #pragma endregion
 
 #pragma region CesiumGltfPrimitiveComponent data
@@ -3,6 +3,7 @@
 #if WITH_EDITOR
 
 #include "Cesium3DTileset.h"
+#include "CesiumDebugColorizeTilesRasterOverlay.h"
 #include "CesiumGlobeAnchorComponent.h"
 #include "CesiumGltfComponent.h"
 #include "CesiumLoadTestCore.h"
@@ -187,6 +188,102 @@ bool FCesium3DTilesetPhysicsWithSmallScale::RunTest(const FString& Parameters) {
       TEST_SCREEN_HEIGHT);
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FCesium3DTilesetAddOverlayAfterReleasingBuffers,
+    "Cesium.Unit.3DTileset.AddOverlayAfterReleasingBuffers",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter);
+
+static void
+setupForAddOverlayAfterReleasingBuffers(SceneGenerationContext& context) {
+  context.setCommonProperties(
+      FVector(21.16677692, -67.38013505, -6375355.1944),
+      FVector(-12, -1300, -5),
+      FRotator(0, 90, 0),
+      60.0f);
+
+  context.georeference->SetOriginEarthCenteredEarthFixed(FVector(0, 0, 0));
+  context.pawn->SetActorLocation(FVector(485.0, 2400.0, 520.0));
+  context.pawn->SetActorRotation(FQuat::MakeFromEuler(FVector(0, 0, 270)));
+
+  FString pluginContent =
+      FPaths::ConvertRelativePathToFull(IPluginManager::Get()
+                                            .FindPlugin(TEXT("CesiumForUnreal"))
+                                            ->GetContentDir());
+  FString tilesetPath = FPaths::Combine(
+      pluginContent,
+      TEXT("Tests"),
+      TEXT("Tilesets"),
+      TEXT("BigCube"),
+      TEXT("tileset.json"));
+
+  FString tilesetUriPath = UTF8_TO_TCHAR(
+      CesiumUtility::Uri::nativePathToUriPath(TCHAR_TO_UTF8(*tilesetPath))
+          .c_str());
+
+  ACesium3DTileset* tileset = context.world->SpawnActor<ACesium3DTileset>();
+  tileset->SetTilesetSource(ETilesetSource::FromUrl);
+  tileset->SetUrl(TEXT("file://") + tilesetUriPath);
+  tileset->SetReleaseGltfBuffersAfterLoad(true);
+
+  tileset->SetActorLabel(TEXT("BigCubeReleasedBuffers"));
+  tileset->SetGeoreference(context.georeference);
+  tileset->SuspendUpdate = false;
+  context.tilesets.push_back(tileset);
+}
+
+bool checkBuffersReleased(
+    SceneGenerationContext& creationContext,
+    SceneGenerationContext& playContext,
+    TestPass::TestingParameter parameter) {
+  // Tiles without overlays release their buffers once they're loaded.
+  return playContext.tilesets[0]->hasReleasedGltfBuffers();
+}
+
+void addOverlay(
+    SceneGenerationContext& context,
+    TestPass::TestingParameter parameter) {
+  ACesium3DTileset* tileset = context.tilesets[0];
+  UCesiumDebugColorizeTilesRasterOverlay* pOverlay =
+      NewObject<UCesiumDebugColorizeTilesRasterOverlay>(
+          tileset,
+          TEXT("DebugOverlay"));
+  tileset->AddInstanceComponent(pOverlay);
+  pOverlay->RegisterComponent();
+  pOverlay->Activate(true);
+}
+
+bool checkBuffersRetained(
+    SceneGenerationContext& creationContext,
+    SceneGenerationContext& playContext,
+    TestPass::TestingParameter parameter) {
+  // Adding the overlay reloads the tileset, and the reloaded tiles keep their
+  // buffers so that the overlay can be upsampled onto them.
+  ACesium3DTileset* tileset = playContext.tilesets[0];
+  if (!tileset->GetTileset() || tileset->hasReleasedGltfBuffers()) {
+    return false;
+  }
+
+  TArray<UCesiumGltfComponent*> gltfComponents;
+  tileset->GetComponents<UCesiumGltfComponent>(gltfComponents);
+  return !gltfComponents.IsEmpty();
+}
+
+bool FCesium3DTilesetAddOverlayAfterReleasingBuffers::RunTest(
+    const FString& Parameters) {
+  std::vector<TestPass> testPasses;
+  testPasses.push_back(
+      TestPass{"Release Buffers Pass", nullptr, checkBuffersReleased});
+  testPasses.push_back(
+      TestPass{"Add Overlay Pass", addOverlay, checkBuffersRetained});
+
+  return RunLoadTest(
+      GetBeautifiedTestName(),
+      setupForAddOverlayAfterReleasingBuffers,
+      testPasses,
+      TEST_SCREEN_WIDTH,
+      TEST_SCREEN_HEIGHT);
+}
+
 } // namespace Cesium
 
 #endif
@@ -0,0 +1,149 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumAtlasAllocator.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumAtlasAllocatorSpec,
+    "Cesium.Unit.AtlasAllocator",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FCesiumAtlasAllocatorSpec)
+
+void FCesiumAtlasAllocatorSpec::Define() {
+  Describe("allocate", [this]() {
+    It("rounds blocks up to the granularity", [this]() {
+      CesiumAtlasAllocator allocator(1024, 64);
+      std::optional<CesiumAtlasAllocator::Block> block =
+          allocator.allocate(320, 200);
+      if (!TestTrue("block", block.has_value())) {
+        return;
+      }
+      TestEqual("width", block->width, 320);
+      TestEqual("height", block->height, 256);
+      TestEqual(
+          "occupancy",
+          allocator.getOccupancy(),
+          320.0 * 256.0 / (1024.0 * 1024.0));
+    });
+
+    It("places blocks side by side on a shelf", [this]() {
+      CesiumAtlasAllocator allocator(1024, 64);
+
+      std::optional<CesiumAtlasAllocator::Block> first =
+          allocator.allocate(320, 320);
+      std::optional<CesiumAtlasAllocator::Block> second =
+          allocator.allocate(320, 320);
+      std::optional<CesiumAtlasAllocator::Block> third =
+          allocator.allocate(320, 320);
+      std::optional<CesiumAtlasAllocator::Block> fourth =
+          allocator.allocate(320, 320);
+      if (!TestTrue("first", first.has_value()) ||
+          !TestTrue("second", second.has_value()) ||
+          !TestTrue("third", third.has_value()) ||
+          !TestTrue("fourth", fourth.has_value())) {
+        return;
+      }
+      TestEqual("first x", first->x, 0);
+      TestEqual("first y", first->y, 0);
+      TestEqual("second x", second->x, 320);
+      TestEqual("second y", second->y, 0);
+      TestEqual("third x", third->x, 640);
+      TestEqual("third y", third->y, 0);
+      TestEqual("fourth x", fourth->x, 0);
+      TestEqual("fourth y", fourth->y, 320);
+      TestEqual("count", allocator.getAllocationCount(), 4);
+    });
+
+    It("puts short blocks on a shelf of their own", [this]() {
+      CesiumAtlasAllocator allocator(1024, 64);
+      allocator.allocate(256, 512);
+      std::optional<CesiumAtlasAllocator::Block> tall =
+          allocator.allocate(256, 448);
+      std::optional<CesiumAtlasAllocator::Block> shorter =
+          allocator.allocate(256, 128);
+      if (!TestTrue("tall", tall.has_value()) ||
+          !TestTrue("short", shorter.has_value())) {
+        return;
+      }
+      TestEqual("tall x", tall->x, 256);
+      TestEqual("tall y", tall->y, 0);
+      TestEqual("short x", shorter->x, 0);
+      TestEqual("short y", shorter->y, 512);
+    });
+
+    It("fails when the page is full or the image is too large", [this]() {
+      CesiumAtlasAllocator allocator(512, 64);
+      TestFalse("too large", allocator.allocate(513, 16).has_value());
+      for (int32 i = 0; i < 4; ++i) {
+        TestTrue("quadrant", allocator.allocate(256, 256).has_value());
+      }
+      TestFalse("full", allocator.allocate(1, 1).has_value());
+      TestEqual("occupancy", allocator.getOccupancy(), 1.0);
+    });
+  });
+
+  Describe("free", [this]() {
+    It("reuses the space of freed blocks on their shelf", [this]() {
+      CesiumAtlasAllocator allocator(1024, 64);
+      std::optional<CesiumAtlasAllocator::Block> first =
+          allocator.allocate(320, 320);
+      allocator.allocate(320, 320);
+      if (!TestTrue("first", first.has_value())) {
+        return;
+      }
+      allocator.free(*first);
+
+      std::optional<CesiumAtlasAllocator::Block> reused =
+          allocator.allocate(300, 300);
+      if (TestTrue("reused", reused.has_value())) {
+        TestEqual("x", reused->x, 0);
+        TestEqual("y", reused->y, 0);
+      }
+    });
+
+    It("merges empty shelves back into the whole page", [this]() {
+      CesiumAtlasAllocator allocator(512, 64);
+      std::vector<CesiumAtlasAllocator::Block> blocks;
+      for (int32 i = 0; i < 64; ++i) {
+        std::optional<CesiumAtlasAllocator::Block> block =
+            allocator.allocate(64, 64);
+        if (!TestTrue("block", block.has_value())) {
+          return;
+        }
+        blocks.push_back(*block);
+      }
+      TestFalse("full", allocator.allocate(64, 64).has_value());
+
+      for (const CesiumAtlasAllocator::Block& block : blocks) {
+        allocator.free(block);
+      }
+      TestEqual("count", allocator.getAllocationCount(), 0);
+      TestEqual("occupancy", allocator.getOccupancy(), 0.0);
+
+      std::optional<CesiumAtlasAllocator::Block> whole =
+          allocator.allocate(512, 512);
+      if (TestTrue("whole", whole.has_value())) {
+        TestEqual("width", whole->width, 512);
+        TestEqual("height", whole->height, 512);
+      }
+    });
+
+    It("doesn't merge a shelf while it holds a block", [this]() {
+      CesiumAtlasAllocator allocator(512, 64);
+      std::optional<CesiumAtlasAllocator::Block> first =
+          allocator.allocate(256, 256);
+      std::optional<CesiumAtlasAllocator::Block> second =
+          allocator.allocate(256, 256);
+      if (!TestTrue("first", first.has_value()) ||
+          !TestTrue("second", second.has_value())) {
+        return;
+      }
+      allocator.free(*first);
+      TestFalse("whole", allocator.allocate(512, 512).has_value());
+      TestTrue("below", allocator.allocate(512, 256).has_value());
+    });
+  });
+}
@@ -0,0 +1,108 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumGpuEviction.h"
+#include "Cesium3DTileset.h"
+#include "CesiumGltfComponent.h"
+#include "CesiumTestHelpers.h"
+#include "Misc/AutomationTest.h"
+
+using namespace CesiumGpuEviction;
+
+BEGIN_DEFINE_SPEC(
+    FCesiumGpuEvictionSpec,
+    "Cesium.Unit.GpuEviction",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ProductFilter)
+
+TObjectPtr<ACesium3DTileset> pTileset;
+
+END_DEFINE_SPEC(FCesiumGpuEvictionSpec)
+
+void FCesiumGpuEvictionSpec::Define() {
+  Describe("chooseTilesToEvict", [this]() {
+    It("evicts nothing while the hidden tiles fit", [this]() {
+      TArray<HiddenTile> tiles{{100, 1}, {200, 2}};
+      TestEqual(
+          "at the limit",
+          chooseTilesToEvict(tiles, 100, 0, 300).Num(),
+          0);
+    });
+
+    It("evicts the tiles hidden the longest first", [this]() {
+      TArray<HiddenTile> tiles{{100, 30}, {100, 10}, {100, 20}};
+      TArray<int32> evicted = chooseTilesToEvict(tiles, 100, 0, 100);
+      TestEqual("count", evicted.Num(), 2);
+      if (evicted.Num() == 2) {
+        TestEqual("first", evicted[0], 1);
+        TestEqual("second", evicted[1], 2);
+      }
+    });
+
+    It("stops once the remaining tiles fit", [this]() {
+      TArray<HiddenTile> tiles{{50, 10}, {300, 20}, {50, 30}};
+      TArray<int32> evicted = chooseTilesToEvict(tiles, 100, 0, 300);
+      TestEqual("count", evicted.Num(), 2);
+      if (evicted.Num() == 2) {
+        TestEqual("first", evicted[0], 0);
+        TestEqual("second", evicted[1], 1);
+      }
+    });
+
+    It("skips tiles hidden for fewer than the delay", [this]() {
+      TArray<HiddenTile> tiles{{100, 95}, {100, 50}, {100, 99}};
+      TArray<int32> evicted = chooseTilesToEvict(tiles, 100, 10, 0);
+      TestEqual("count", evicted.Num(), 1);
+      if (evicted.Num() == 1) {
+        TestEqual("evicted", evicted[0], 1);
+      }
+    });
+  });
+
+  Describe("UCesiumGltfComponent", [this]() {
+    BeforeEach([this]() {
+      UWorld* pWorld = CesiumTestHelpers::getGlobalWorldContext();
+      pTileset = pWorld->SpawnActor<ACesium3DTileset>();
+    });
+
+    AfterEach([this]() { pTileset->Destroy(); });
+
+    It("restores evicted resources when the tile is shown", [this]() {
+      UCesiumGltfComponent* pGltf = NewObject<UCesiumGltfComponent>(pTileset);
+      pGltf->SetVisibility(false, true);
+      pGltf->EvictGpuResources(1);
+      TestTrue("evicted", pGltf->AreGpuResourcesEvicted());
+
+      pGltf->SetVisibility(true, true);
+      TestFalse("evicted after shown", pGltf->AreGpuResourcesEvicted());
+    });
+
+    It("restores evicted resources when collision is enabled", [this]() {
+      UCesiumGltfComponent* pGltf = NewObject<UCesiumGltfComponent>(pTileset);
+      pGltf->SetVisibility(false, true);
+      pGltf->EvictGpuResources(1);
+
+      pGltf->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+      TestTrue("evicted without collision", pGltf->AreGpuResourcesEvicted());
+
+      pGltf->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+      TestFalse("evicted with collision", pGltf->AreGpuResourcesEvicted());
+    });
+
+    It("only counts the buffers of meshes it can release", [this]() {
+      UCesiumGltfComponent* pGltf = NewObject<UCesiumGltfComponent>(pTileset);
+      pGltf->MemoryStatistics.VertexBufferBytes = 1000;
+      pGltf->MemoryStatistics.IndexBufferBytes = 500;
+      pGltf->SetVisibility(false, true);
+      TestEqual(
+          "evictable without meshes",
+          pGltf->GetEvictableGpuBytes(),
+          int64(0));
+
+      pGltf->EvictGpuResources(1);
+      TestEqual(
+          "evictable after eviction",
+          pGltf->GetEvictableGpuBytes(),
+          int64(0));
+    });
+  });
+}
@@ -0,0 +1,122 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumMaterialInstanceCache.h"
+#include "CesiumGltfPrimitiveComponent.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumMaterialInstanceCacheSpec,
+    "Cesium.Unit.MaterialInstanceCache",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+TSharedPtr<CesiumMaterialInstanceCache> pCache;
+
+UMaterialInstanceDynamic* CreateMaterial(float value);
+END_DEFINE_SPEC(FCesiumMaterialInstanceCacheSpec)
+
+UMaterialInstanceDynamic*
+FCesiumMaterialInstanceCacheSpec::CreateMaterial(float value) {
+  UMaterialInstanceDynamic* pMaterial = UMaterialInstanceDynamic::Create(
+      UMaterial::GetDefaultMaterial(MD_Surface),
+      nullptr);
+  pMaterial->SetScalarParameterValue("Value", value);
+  return pMaterial;
+}
+
+void FCesiumMaterialInstanceCacheSpec::Define() {
+  BeforeEach([this]() { pCache = MakeShared<CesiumMaterialInstanceCache>(); });
+
+  AfterEach([this]() { pCache.Reset(); });
+
+  Describe("share", [this]() {
+    It("shares instances with the same parameter values", [this]() {
+      UMaterialInstanceDynamic* pFirst = CreateMaterial(1.0f);
+      UMaterialInstanceDynamic* pSecond = CreateMaterial(1.0f);
+
+      TestEqual("first", pCache->share(pFirst), pFirst);
+      TestEqual("second", pCache->share(pSecond), pFirst);
+      TestEqual("count", pCache->getSharedMaterialCount(), 1);
+    });
+
+    It("doesn't share instances with different parameter values", [this]() {
+      UMaterialInstanceDynamic* pFirst = CreateMaterial(1.0f);
+      UMaterialInstanceDynamic* pSecond = CreateMaterial(2.0f);
+
+      TestEqual("first", pCache->share(pFirst), pFirst);
+      TestEqual("second", pCache->share(pSecond), pSecond);
+      TestEqual("count", pCache->getSharedMaterialCount(), 2);
+    });
+
+    It("reuses duplicate candidates as spares", [this]() {
+      UMaterialInstanceDynamic* pFirst = CreateMaterial(1.0f);
+      UMaterialInstanceDynamic* pSecond = CreateMaterial(1.0f);
+      pCache->share(pFirst);
+      pCache->share(pSecond);
+
+      UMaterialInstanceDynamic* pSpare =
+          pCache->acquireSpare(UMaterial::GetDefaultMaterial(MD_Surface));
+      TestEqual("spare", pSpare, pSecond);
+      TestTrue("cleared", pSpare->ScalarParameterValues.IsEmpty());
+      TestNull(
+          "no more spares",
+          pCache->acquireSpare(UMaterial::GetDefaultMaterial(MD_Surface)));
+    });
+  });
+
+  Describe("makeMaterialUnique", [this]() {
+    It("copies an instance that other primitives use", [this]() {
+      UMaterialInstanceDynamic* pShared = pCache->share(CreateMaterial(1.0f));
+      pCache->share(CreateMaterial(1.0f));
+
+      UCesiumGltfPrimitiveComponent* pFirst =
+          NewObject<UCesiumGltfPrimitiveComponent>();
+      pFirst->getPrimitiveData().pSharedMaterialCache = pCache;
+      UCesiumGltfPrimitiveComponent* pSecond =
+          NewObject<UCesiumGltfPrimitiveComponent>();
+      pSecond->getPrimitiveData().pSharedMaterialCache = pCache;
+
+      UMaterialInstanceDynamic* pCopy =
+          CesiumMaterialInstanceCache::makeMaterialUnique(*pSecond, pShared);
+      TestNotEqual("copy", pCopy, pShared);
+      TestEqual(
+          "override",
+          pSecond->GetMaterial(0),
+          static_cast<UMaterialInterface*>(pCopy));
+      TestFalse(
+          "second no longer shares",
+          pSecond->getPrimitiveData().pSharedMaterialCache.IsValid());
+
+      if (TestEqual("parameters", pCopy->ScalarParameterValues.Num(), 1)) {
+        TestEqual(
+            "copied value",
+            pCopy->ScalarParameterValues[0].ParameterValue,
+            1.0f);
+      }
+      TestEqual("count", pCache->getSharedMaterialCount(), 1);
+
+      // The last user is given the shared instance itself.
+      TestEqual(
+          "last user",
+          CesiumMaterialInstanceCache::makeMaterialUnique(*pFirst, pShared),
+          pShared);
+      TestEqual("count", pCache->getSharedMaterialCount(), 0);
+    });
+
+    It("leaves an unshared instance alone", [this]() {
+      UMaterialInstanceDynamic* pMaterial = CreateMaterial(1.0f);
+      UCesiumGltfPrimitiveComponent* pComponent =
+          NewObject<UCesiumGltfPrimitiveComponent>();
+
+      TestEqual(
+          "material",
+          CesiumMaterialInstanceCache::makeMaterialUnique(
+              *pComponent,
+              pMaterial),
+          pMaterial);
+    });
+  });
+}
@@ -0,0 +1,168 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumMipMapGenerator.h"
+#include "CesiumRuntime.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include <CesiumGltfReader/GltfReader.h>
+#include <cmath>
+#include <vector>
+
+using namespace CesiumGltf;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FCesiumMipMapGeneratorPerf,
+    "Cesium.Performance.MipMapGenerator",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::PerfFilter)
+
+namespace {
+constexpr int32 ImageSize = 2048;
+constexpr int32 Iterations = 8;
+
+ImageAsset createImage(int32 channels) {
+  ImageAsset image;
+  image.width = ImageSize;
+  image.height = ImageSize;
+  image.channels = channels;
+  image.bytesPerChannel = 1;
+  image.pixelData.resize(size_t(ImageSize) * ImageSize * channels);
+  uint32 state = 1;
+  for (std::byte& value : image.pixelData) {
+    state = state * 1664525 + 1013904223;
+    value = std::byte(state >> 24);
+  }
+  return image;
+}
+
+// The scalar sRGB path that CesiumMipMapGenerator used before it was
+// vectorized, as a baseline. It converts each color value through lookup tables
+// and averages one value at a time. The image must be square, with a
+// power-of-two size.
+void generateSrgbMipMapsScalar(ImageAsset& image) {
+  static const std::vector<uint16> toLinear = []() {
+    std::vector<uint16> result(256);
+    for (int32 i = 0; i < 256; ++i) {
+      const double srgb = i / 255.0;
+      const double linear = srgb <= 0.04045
+                                ? srgb / 12.92
+                                : std::pow((srgb + 0.055) / 1.055, 2.4);
+      result[i] = uint16(std::lround(linear * 65535.0));
+    }
+    return result;
+  }();
+  static const std::vector<uint8> toSrgb = []() {
+    std::vector<uint8> result(65536);
+    for (int32 i = 0; i < 65536; ++i) {
+      const double linear = i / 65535.0;
+      const double srgb = linear <= 0.0031308
+                              ? linear * 12.92
+                              : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+      result[i] = uint8(std::lround(srgb * 255.0));
+    }
+    return result;
+  }();
+
+  const int32 channels = image.channels;
+  const bool hasAlpha = channels == 2 || channels == 4;
+  std::vector<ImageAssetMipPosition> mipPositions{
+      {0, image.pixelData.size()}};
+  for (int32 size = image.width >> 1; size >= 1; size >>= 1) {
+    const ImageAssetMipPosition& previous = mipPositions.back();
+    mipPositions.push_back(
+        {previous.byteOffset + previous.byteSize,
+         size_t(size) * size * channels});
+  }
+  image.pixelData.resize(
+      mipPositions.back().byteOffset + mipPositions.back().byteSize);
+
+  uint8* pData = reinterpret_cast<uint8*>(image.pixelData.data());
+  for (size_t level = 1; level < mipPositions.size(); ++level) {
+    const int32 sourceSize = image.width >> (level - 1);
+    const int32 size = sourceSize >> 1;
+    const uint8* pSource = pData + mipPositions[level - 1].byteOffset;
+    uint8* pDestination = pData + mipPositions[level].byteOffset;
+    for (int32 y = 0; y < size; ++y) {
+      const uint8* pRowA = pSource + size_t(2 * y) * sourceSize * channels;
+      const uint8* pRowB = pRowA + size_t(sourceSize) * channels;
+      for (int32 x = 0; x < size; ++x) {
+        const uint8* pA = pRowA + 2 * x * channels;
+        const uint8* pB = pRowB + 2 * x * channels;
+        for (int32 c = 0; c < channels; ++c) {
+          uint8& out = pDestination[(size_t(y) * size + x) * channels + c];
+          if (!(hasAlpha && c == channels - 1)) {
+            const uint32 sum = uint32(toLinear[pA[c]]) +
+                               toLinear[pA[c + channels]] + toLinear[pB[c]] +
+                               toLinear[pB[c + channels]] + 2;
+            out = toSrgb[sum >> 2];
+          } else {
+            const int32 sum =
+                pA[c] + pA[c + channels] + pB[c] + pB[c + channels] + 2;
+            out = uint8(sum >> 2);
+          }
+        }
+      }
+    }
+  }
+
+  image.mipPositions = std::move(mipPositions);
+}
+
+// Returns the average time, in milliseconds, that the function takes to
+// generate mipmaps for a fresh copy of the image.
+template <typename Func>
+double timeMipMapGeneration(const ImageAsset& image, Func&& generate) {
+  double totalSeconds = 0.0;
+  for (int32 i = 0; i < Iterations; ++i) {
+    ImageAsset copy = image;
+    const double start = FPlatformTime::Seconds();
+    generate(copy);
+    totalSeconds += FPlatformTime::Seconds() - start;
+  }
+  return totalSeconds * 1000.0 / Iterations;
+}
+} // namespace
+
+bool FCesiumMipMapGeneratorPerf::RunTest(const FString& Parameters) {
+  for (int32 channels : {1, 2, 4}) {
+    const ImageAsset image = createImage(channels);
+
+    const double decoderMs = timeMipMapGeneration(image, [](ImageAsset& copy) {
+      CesiumGltfReader::ImageDecoder::generateMipMaps(copy);
+    });
+    const double linearMs = timeMipMapGeneration(image, [](ImageAsset& copy) {
+      CesiumMipMapGenerator::generateMipMaps(copy, false);
+    });
+    const double sRGBMs = timeMipMapGeneration(image, [](ImageAsset& copy) {
+      CesiumMipMapGenerator::generateMipMaps(copy, true);
+    });
+    const double scalarSRGBMs = timeMipMapGeneration(
+        image,
+        [](ImageAsset& copy) { generateSrgbMipMapsScalar(copy); });
+
+    UE_LOG(
+        LogCesium,
+        Display,
+        TEXT(
+            "Mipmaps for a %dx%d image with %d channel(s): ImageDecoder %.2f ms, CesiumMipMapGenerator %.2f ms (linear)"),
+        ImageSize,
+        ImageSize,
+        channels,
+        decoderMs,
+        linearMs);
+    UE_LOG(
+        LogCesium,
+        Display,
+        TEXT(
+            "sRGB mipmaps for a %dx%d image with %d channel(s): scalar %.2f ms, CesiumMipMapGenerator %.2f ms (%.2fx)"),
+        ImageSize,
+        ImageSize,
+        channels,
+        scalarSRGBMs,
+        sRGBMs,
+        scalarSRGBMs / sRGBMs);
+  }
+
+  return true;
+}
@@ -0,0 +1,231 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumMipMapGenerator.h"
+#include "Misc/AutomationTest.h"
+#include <cmath>
+
+using namespace CesiumGltf;
+
+BEGIN_DEFINE_SPEC(
+    FCesiumMipMapGeneratorSpec,
+    "Cesium.Unit.MipMapGenerator",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FCesiumMipMapGeneratorSpec)
+
+void FCesiumMipMapGeneratorSpec::Define() {
+  Describe("computeMipCount", [this]() {
+    It("counts levels down to 1x1", [this]() {
+      TestEqual("1x1", CesiumMipMapGenerator::computeMipCount(1, 1), 1);
+      TestEqual("256x256", CesiumMipMapGenerator::computeMipCount(256, 256), 9);
+      TestEqual("8x2", CesiumMipMapGenerator::computeMipCount(8, 2), 4);
+      TestEqual("5x3", CesiumMipMapGenerator::computeMipCount(5, 3), 3);
+    });
+  });
+
+  Describe("downsample", [this]() {
+    It("matches a scalar box filter for every channel count", [this]() {
+      // Wide enough that most pixels take the SIMD path, with a scalar tail.
+      constexpr int32 width = 70;
+      constexpr int32 height = 4;
+      for (int32 channels = 1; channels <= 4; ++channels) {
+        TArray<uint8> source;
+        source.SetNum(width * height * channels);
+        for (int32 i = 0; i < source.Num(); ++i) {
+          source[i] = uint8((i * 7919) >> 3);
+        }
+
+        TArray<uint8> result;
+        result.SetNum(width / 2 * height / 2 * channels);
+        CesiumMipMapGenerator::downsample(
+            source.GetData(),
+            width,
+            height,
+            channels,
+            false,
+            result.GetData());
+
+        for (int32 y = 0; y < height / 2; ++y) {
+          for (int32 x = 0; x < width / 2; ++x) {
+            for (int32 c = 0; c < channels; ++c) {
+              auto at = [&](int32 sx, int32 sy) -> int32 {
+                return source[(sy * width + sx) * channels + c];
+              };
+              const int32 sum = at(2 * x, 2 * y) + at(2 * x + 1, 2 * y) +
+                                at(2 * x, 2 * y + 1) + at(2 * x + 1, 2 * y + 1);
+              const int32 expected = (sum + 2) >> 2;
+              const int32 actual =
+                  result[(y * (width / 2) + x) * channels + c];
+              if (!TestEqual("value", actual, expected)) {
+                return;
+              }
+            }
+          }
+        }
+      }
+    });
+
+    It("matches a scalar sRGB box filter for every channel count", [this]() {
+      auto toLinear = [](int32 value) {
+        const double srgb = value / 255.0;
+        const double linear = srgb <= 0.04045
+                                  ? srgb / 12.92
+                                  : std::pow((srgb + 0.055) / 1.055, 2.4);
+        return int32(std::lround(linear * 65535.0));
+      };
+      auto toSrgb = [](int32 value) {
+        const double linear = value / 65535.0;
+        const double srgb = linear <= 0.0031308
+                                ? linear * 12.92
+                                : 1.055 * std::pow(linear, 1.0 / 2.4) - 0.055;
+        return int32(std::lround(srgb * 255.0));
+      };
+
+      // Wide enough that most pixels take the SIMD path, with a scalar tail.
+      constexpr int32 width = 70;
+      constexpr int32 height = 4;
+      for (int32 channels = 1; channels <= 4; ++channels) {
+        TArray<uint8> source;
+        source.SetNum(width * height * channels);
+        for (int32 i = 0; i < source.Num(); ++i) {
+          source[i] = uint8((i * 7919) >> 3);
+        }
+
+        TArray<uint8> result;
+        result.SetNum(width / 2 * height / 2 * channels);
+        CesiumMipMapGenerator::downsample(
+            source.GetData(),
+            width,
+            height,
+            channels,
+            true,
+            result.GetData());
+
+        const bool hasAlpha = channels == 2 || channels == 4;
+        for (int32 y = 0; y < height / 2; ++y) {
+          for (int32 x = 0; x < width / 2; ++x) {
+            for (int32 c = 0; c < channels; ++c) {
+              const bool isColor = !(hasAlpha && c == channels - 1);
+              auto at = [&](int32 sx, int32 sy) -> int32 {
+                const int32 value = source[(sy * width + sx) * channels + c];
+                return isColor ? toLinear(value) : value;
+              };
+              const int32 sum = at(2 * x, 2 * y) + at(2 * x + 1, 2 * y) +
+                                at(2 * x, 2 * y + 1) + at(2 * x + 1, 2 * y + 1);
+              const int32 average = (sum + 2) >> 2;
+              const int32 expected = isColor ? toSrgb(average) : average;
+              const int32 actual =
+                  result[(y * (width / 2) + x) * channels + c];
+              if (!TestEqual("value", actual, expected)) {
+                return;
+              }
+            }
+          }
+        }
+      }
+    });
+
+    It("averages sRGB colors in linear space", [this]() {
+      const uint8 source[16] =
+          {0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255};
+      uint8 result[4];
+      CesiumMipMapGenerator::downsample(source, 2, 2, 4, true, result);
+
+      // Half-intensity linear light is about 188 in sRGB, not 128.
+      TestEqual("red", result[0], 188);
+      TestEqual("green", result[1], 188);
+      TestEqual("blue", result[2], 188);
+      TestEqual("alpha", result[3], 128);
+
+      CesiumMipMapGenerator::downsample(source, 2, 2, 4, false, result);
+      TestEqual("linear red", result[0], 128);
+    });
+
+    It("preserves solid sRGB colors exactly", [this]() {
+      for (int32 value = 0; value < 256; ++value) {
+        const uint8 source[4] = {
+            uint8(value),
+            uint8(value),
+            uint8(value),
+            uint8(value)};
+        uint8 result[1];
+        CesiumMipMapGenerator::downsample(source, 2, 2, 1, true, result);
+        if (!TestEqual("value", int32(result[0]), value)) {
+          return;
+        }
+      }
+    });
+
+    It("covers the whole source when its size is odd", [this]() {
+      const uint8 source[6] = {10, 20, 30, 40, 50, 60};
+      uint8 result = 0;
+      CesiumMipMapGenerator::downsample(source, 3, 2, 1, false, &result);
+      TestEqual("average", result, 35);
+    });
+  });
+
+  Describe("generateMipMaps", [this]() {
+    It("writes every level to a single allocation", [this]() {
+      ImageAsset image;
+      image.width = 8;
+      image.height = 2;
+      image.channels = 4;
+      image.bytesPerChannel = 1;
+      image.pixelData.resize(8 * 2 * 4, std::byte(100));
+
+      TestFalse(
+          "error",
+          CesiumMipMapGenerator::generateMipMaps(image, true).has_value());
+      if (!TestEqual("levels", int32(image.mipPositions.size()), 4)) {
+        return;
+      }
+      TestEqual(
+          "level 1 offset",
+          int64(image.mipPositions[1].byteOffset),
+          int64(64));
+      TestEqual(
+          "level 1 size",
+          int64(image.mipPositions[1].byteSize),
+          int64(16));
+      TestEqual(
+          "level 2 size",
+          int64(image.mipPositions[2].byteSize),
+          int64(8));
+      TestEqual(
+          "level 3 offset",
+          int64(image.mipPositions[3].byteOffset),
+          int64(88));
+      TestEqual("total size", int64(image.pixelData.size()), int64(92));
+      TestEqual("last pixel", int32(image.pixelData.back()), 100);
+    });
+
+    It("leaves existing mipmaps alone", [this]() {
+      ImageAsset image;
+      image.width = 2;
+      image.height = 2;
+      image.pixelData.resize(20);
+      image.mipPositions = {
+          ImageAssetMipPosition{0, 16},
+          ImageAssetMipPosition{16, 4}};
+
+      TestFalse(
+          "error",
+          CesiumMipMapGenerator::generateMipMaps(image, false).has_value());
+      TestEqual("levels", int32(image.mipPositions.size()), 2);
+    });
+
+    It("fails for compressed images", [this]() {
+      ImageAsset image;
+      image.width = 4;
+      image.height = 4;
+      image.compressedPixelFormat = GpuCompressedPixelFormat::BC1_RGB;
+      image.pixelData.resize(8);
+
+      TestTrue(
+          "error",
+          CesiumMipMapGenerator::generateMipMaps(image, false).has_value());
+    });
+  });
+}
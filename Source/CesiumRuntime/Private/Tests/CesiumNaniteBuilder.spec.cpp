@@ -0,0 +1,213 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumNaniteBuilder.h"
+#include "CesiumGltfPrimitiveComponent.h"
+#include "CesiumTestHelpers.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Actor.h"
+#include "Materials/Material.h"
+#include "Misc/AutomationTest.h"
+#include "PrimitiveSceneProxy.h"
+#include "RenderUtils.h"
+#include "Rendering/NaniteResources.h"
+#include "RenderingThread.h"
+#include "StaticMeshResources.h"
+
+using namespace CesiumNaniteBuilder;
+
+namespace {
+TUniquePtr<FStaticMeshRenderData>
+createQuadRenderData(const TArray<uint32>& indices) {
+  TUniquePtr<FStaticMeshRenderData> pRenderData =
+      MakeUnique<FStaticMeshRenderData>();
+  pRenderData->AllocateLODResources(1);
+  FStaticMeshLODResources& lod = pRenderData->LODResources[0];
+
+  const TArray<FVector3f> positions{
+      FVector3f(0.0f, 0.0f, 0.0f),
+      FVector3f(1.0f, 0.0f, 0.0f),
+      FVector3f(1.0f, 1.0f, 0.0f),
+      FVector3f(0.0f, 1.0f, 0.0f)};
+
+  lod.VertexBuffers.PositionVertexBuffer.Init(positions, false);
+  lod.VertexBuffers.StaticMeshVertexBuffer.SetUseFullPrecisionUVs(true);
+  lod.VertexBuffers.StaticMeshVertexBuffer.Init(positions.Num(), 2, false);
+  for (int32 i = 0; i < positions.Num(); ++i) {
+    lod.VertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(
+        i,
+        FVector3f(1.0f, 0.0f, 0.0f),
+        FVector3f(0.0f, 1.0f, 0.0f),
+        FVector3f(0.0f, 0.0f, 1.0f));
+    lod.VertexBuffers.StaticMeshVertexBuffer.SetVertexUV(
+        i,
+        0,
+        FVector2f(positions[i].X, positions[i].Y));
+    lod.VertexBuffers.StaticMeshVertexBuffer.SetVertexUV(
+        i,
+        1,
+        FVector2f(float(i), 0.0f));
+  }
+
+  FStaticMeshSection& section = lod.Sections.AddDefaulted_GetRef();
+  section.NumTriangles = indices.Num() / 3;
+  section.FirstIndex = 0;
+  section.MinVertexIndex = 0;
+  section.MaxVertexIndex = positions.Num() - 1;
+  section.MaterialIndex = 0;
+
+  lod.IndexBuffer.SetIndices(indices, EIndexBufferStride::Type::Force16Bit);
+
+  return pRenderData;
+}
+} // namespace
+
+BEGIN_DEFINE_SPEC(
+    FCesiumNaniteBuilderSpec,
+    "Cesium.Unit.CesiumNaniteBuilder",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+TUniquePtr<FStaticMeshRenderData> pRenderData;
+
+void CreateQuad(const TArray<uint32>& indices);
+END_DEFINE_SPEC(FCesiumNaniteBuilderSpec)
+
+void FCesiumNaniteBuilderSpec::CreateQuad(const TArray<uint32>& indices) {
+  pRenderData = createQuadRenderData(indices);
+}
+
+void FCesiumNaniteBuilderSpec::Define() {
+  AfterEach([this]() { pRenderData.Reset(); });
+
+  Describe("createBuildInput", [this]() {
+    It("copies vertices and indices of a triangle list", [this]() {
+      CreateQuad({0, 1, 2, 0, 2, 3});
+
+      NaniteBuildInput input;
+      TestTrue(
+          "created",
+          createBuildInput(pRenderData->LODResources[0], input));
+
+      TestEqual("positions", input.positions.Num(), 4);
+      TestEqual("tangentX", input.tangentX.Num(), 4);
+      TestEqual("tangentY", input.tangentY.Num(), 4);
+      TestEqual("tangentZ", input.tangentZ.Num(), 4);
+      TestEqual("texCoord channels", input.texCoords.Num(), 2);
+      TestEqual("texCoords[0]", input.texCoords[0].Num(), 4);
+      TestEqual("texCoords[1]", input.texCoords[1].Num(), 4);
+      TestTrue("no colors", input.colors.IsEmpty());
+      TestEqual("indices", input.indices, TArray<uint32>{0, 1, 2, 0, 2, 3});
+      TestEqual("materialIndices", input.materialIndices, TArray<int32>{0, 0});
+
+      TestEqual("position", input.positions[2], FVector3f(1.0f, 1.0f, 0.0f));
+      TestEqual("normal", input.tangentZ[3], FVector3f(0.0f, 0.0f, 1.0f));
+      TestEqual("uv0", input.texCoords[0][1], FVector2f(1.0f, 0.0f));
+      TestEqual("uv1", input.texCoords[1][3], FVector2f(3.0f, 0.0f));
+    });
+
+    It("rejects index buffers that are not triangle lists", [this]() {
+      CreateQuad({0, 1, 2, 3});
+
+      NaniteBuildInput input;
+      TestFalse(
+          "created",
+          createBuildInput(pRenderData->LODResources[0], input));
+    });
+
+    It("rejects out-of-range indices", [this]() {
+      CreateQuad({0, 1, 2, 0, 2, 4});
+
+      NaniteBuildInput input;
+      TestFalse(
+          "created",
+          createBuildInput(pRenderData->LODResources[0], input));
+    });
+
+    It("rejects empty meshes", [this]() {
+      pRenderData = MakeUnique<FStaticMeshRenderData>();
+      pRenderData->AllocateLODResources(1);
+
+      NaniteBuildInput input;
+      TestFalse(
+          "created",
+          createBuildInput(pRenderData->LODResources[0], input));
+    });
+  });
+
+  Describe("buildNaniteResources", [this]() {
+    It("leaves the render data unchanged when unavailable", [this]() {
+      if (isNaniteBuildAvailable()) {
+        return;
+      }
+
+      CreateQuad({0, 1, 2, 0, 2, 3});
+
+      NaniteBuildInput input;
+      TestTrue(
+          "created",
+          createBuildInput(pRenderData->LODResources[0], input));
+      TestFalse("built", buildNaniteResources(std::move(input), *pRenderData));
+      TestFalse("has Nanite data", pRenderData->HasValidNaniteData());
+      TestEqual(
+          "LOD0 sections",
+          pRenderData->LODResources[0].Sections.Num(),
+          1);
+    });
+  });
+}
+
+// Building Nanite resources needs the Nanite builder, which is only available
+// in the Editor.
+BEGIN_DEFINE_SPEC(
+    FCesiumNaniteBuilderEditorSpec,
+    "Cesium.Unit.CesiumNaniteBuilder.Editor",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FCesiumNaniteBuilderEditorSpec)
+
+void FCesiumNaniteBuilderEditorSpec::Define() {
+  It("builds Nanite resources that a mesh component renders", [this]() {
+    initialize();
+
+    TUniquePtr<FStaticMeshRenderData> pRenderData =
+        createQuadRenderData({0, 1, 2, 0, 2, 3});
+    NaniteBuildInput input;
+    TestTrue("created", createBuildInput(pRenderData->LODResources[0], input));
+
+    const bool built = buildNaniteResources(std::move(input), *pRenderData);
+    TestEqual("built", built, isNaniteBuildAvailable());
+    TestEqual("has Nanite data", pRenderData->HasValidNaniteData(), built);
+    if (built) {
+      TestTrue(
+          "has pages",
+          pRenderData->NaniteResourcesPtr->PageStreamingStates.Num() > 0);
+    }
+
+    // Without Nanite support, the mesh is drawn from its LOD0 render data.
+    UWorld* pWorld = CesiumTestHelpers::getGlobalWorldContext();
+    AActor* pActor = pWorld->SpawnActor<AActor>();
+    UCesiumGltfPrimitiveComponent* pComponent =
+        NewObject<UCesiumGltfPrimitiveComponent>(pActor);
+    UStaticMesh* pStaticMesh = NewObject<UStaticMesh>(pComponent);
+    pStaticMesh->NeverStream = true;
+    pStaticMesh->SetRenderData(MoveTemp(pRenderData));
+    pStaticMesh->AddMaterial(UMaterial::GetDefaultMaterial(MD_Surface));
+    pStaticMesh->InitResources();
+    pStaticMesh->CalculateExtendedBounds();
+    pComponent->SetStaticMesh(pStaticMesh);
+    pActor->SetRootComponent(pComponent);
+    pComponent->RegisterComponent();
+    FlushRenderingCommands();
+
+    const FPrimitiveSceneProxy* pProxy = pComponent->SceneProxy;
+    TestNotNull("scene proxy", pProxy);
+    if (pProxy) {
+      TestEqual(
+          "Nanite proxy",
+          pProxy->IsNaniteMesh(),
+          built && UseNanite(GMaxRHIShaderPlatform));
+    }
+
+    pActor->Destroy();
+  });
+}
@@ -0,0 +1,105 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumPointAttenuationVertexFactory.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumPointAttenuationIndexBufferSpec,
+    "Cesium.Unit.PointAttenuationIndexBuffer",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FCesiumPointAttenuationIndexBufferSpec)
+
+void FCesiumPointAttenuationIndexBufferSpec::Define() {
+  using IndexBuffer = FCesiumPointAttenuationIndexBuffer;
+
+  Describe("ComputePointCapacity", [this]() {
+    It("uses the minimum capacity for small point counts", [this]() {
+      TestEqual(
+          "zero",
+          IndexBuffer::ComputePointCapacity(0),
+          IndexBuffer::MinimumPointCapacity);
+      TestEqual(
+          "one",
+          IndexBuffer::ComputePointCapacity(1),
+          IndexBuffer::MinimumPointCapacity);
+      TestEqual(
+          "minimum",
+          IndexBuffer::ComputePointCapacity(
+              int32(IndexBuffer::MinimumPointCapacity)),
+          IndexBuffer::MinimumPointCapacity);
+    });
+
+    It("rounds up to a power of two", [this]() {
+      TestEqual("exact", IndexBuffer::ComputePointCapacity(4096), 4096u);
+      TestEqual("above", IndexBuffer::ComputePointCapacity(4097), 8192u);
+      TestEqual("large", IndexBuffer::ComputePointCapacity(1000000), 1048576u);
+    });
+
+    It("doesn't exceed the maximum capacity", [this]() {
+      TestEqual(
+          "maximum",
+          IndexBuffer::ComputePointCapacity(MAX_int32),
+          IndexBuffer::MaximumPointCapacity);
+    });
+  });
+
+  Describe("ChoosePointCapacity", [this]() {
+    It("creates a new capacity when there are no buffers", [this]() {
+      TestEqual("capacity", IndexBuffer::ChoosePointCapacity({}, 5000), 8192u);
+    });
+
+    It("shares the smallest buffer that is large enough", [this]() {
+      const TArray<uint32> Existing{65536u, 2048u, 16384u};
+      TestEqual(
+          "small tile",
+          IndexBuffer::ChoosePointCapacity(Existing, 100),
+          2048u);
+      TestEqual(
+          "medium tile",
+          IndexBuffer::ChoosePointCapacity(Existing, 3000),
+          16384u);
+      TestEqual(
+          "exact fit",
+          IndexBuffer::ChoosePointCapacity(Existing, 65536),
+          65536u);
+    });
+
+    It("creates a new capacity when no buffer is large enough", [this]() {
+      const TArray<uint32> Existing{2048u, 16384u};
+      TestEqual(
+          "capacity",
+          IndexBuffer::ChoosePointCapacity(Existing, 100000),
+          131072u);
+    });
+  });
+
+  Describe("ComputeSizeInBytes", [this]() {
+    It("uses six 32-bit indices per point", [this]() {
+      TestEqual(
+          "size",
+          IndexBuffer::ComputeSizeInBytes(1024),
+          uint64(1024 * 6 * 4));
+    });
+
+    It("fits the maximum capacity in 32 bits", [this]() {
+      TestTrue(
+          "size",
+          IndexBuffer::ComputeSizeInBytes(IndexBuffer::MaximumPointCapacity) <=
+              uint64(MAX_uint32));
+    });
+  });
+
+  Describe("FCesiumPointAttenuationVertexFactory", [this]() {
+    It("supports caching mesh draw commands", [this]() {
+      // Without this, static point cloud meshes get new mesh draw commands
+      // every frame, like dynamic ones.
+      TestTrue(
+          "SupportsCachingMeshDrawCommands",
+          FCesiumPointAttenuationVertexFactory::StaticType
+              .SupportsCachingMeshDrawCommands());
+    });
+  });
+}
@@ -0,0 +1,107 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumPointCloudUtility.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumPointCloudUtilitySpec,
+    "Cesium.Unit.PointCloudUtility",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FCesiumPointCloudUtilitySpec)
+
+void FCesiumPointCloudUtilitySpec::Define() {
+  Describe("sortPointsProgressively", [this]() {
+    It("reorders every point exactly once", [this]() {
+      TArray<FVector3f> positions;
+      TArray<uint32> indices;
+      for (int32 i = 0; i < 1000; ++i) {
+        positions.Add(
+            FVector3f(float(i % 10), float(i / 10 % 10), float(i / 100)));
+        indices.Add(uint32(i));
+      }
+
+      CesiumPointCloudUtility::sortPointsProgressively(
+          indices,
+          [&positions](uint32 index) { return positions[index]; });
+
+      TArray<bool> seen;
+      seen.SetNumZeroed(positions.Num());
+      for (uint32 index : indices) {
+        if (!TestTrue("in range", index < uint32(positions.Num()))) {
+          return;
+        }
+        TestFalse("duplicate", seen[index]);
+        seen[index] = true;
+      }
+      TestEqual("count", indices.Num(), positions.Num());
+    });
+
+    It("puts points that cover the extent first", [this]() {
+      // Points along a line, listed from one end to the other.
+      TArray<uint32> indices;
+      for (uint32 i = 0; i < 1024; ++i) {
+        indices.Add(i);
+      }
+
+      CesiumPointCloudUtility::sortPointsProgressively(
+          indices,
+          [](uint32 index) { return FVector3f(float(index), 0.0f, 0.0f); });
+
+      // Each quarter of the line should get one of the first four points.
+      TArray<int32> pointsPerQuarter;
+      pointsPerQuarter.SetNumZeroed(4);
+      for (int32 i = 0; i < 4; ++i) {
+        ++pointsPerQuarter[indices[i] / 256];
+      }
+      for (int32 quarter = 0; quarter < 4; ++quarter) {
+        TestEqual("points in quarter", pointsPerQuarter[quarter], 1);
+      }
+    });
+
+    It("leaves a single point alone", [this]() {
+      TArray<uint32> indices{7};
+      CesiumPointCloudUtility::sortPointsProgressively(
+          indices,
+          [](uint32) { return FVector3f(0.0f); });
+      TestEqual("index", indices[0], 7u);
+    });
+  });
+
+  Describe("computeProgressivePointCount", [this]() {
+    It("draws every point when they are a pixel or more apart", [this]() {
+      TestEqual(
+          "one pixel",
+          CesiumPointCloudUtility::computeProgressivePointCount(100000, 1.0f),
+          100000);
+      TestEqual(
+          "two pixels",
+          CesiumPointCloudUtility::computeProgressivePointCount(100000, 2.0f),
+          100000);
+    });
+
+    It("scales with the square of the spacing", [this]() {
+      TestEqual(
+          "half a pixel",
+          CesiumPointCloudUtility::computeProgressivePointCount(100000, 0.5f),
+          25000);
+      TestEqual(
+          "a quarter of a pixel",
+          CesiumPointCloudUtility::computeProgressivePointCount(100000, 0.25f),
+          6250);
+    });
+
+    It("never draws fewer than the minimum", [this]() {
+      TestEqual(
+          "large",
+          CesiumPointCloudUtility::computeProgressivePointCount(100000, 0.0f),
+          CesiumPointCloudUtility::MinimumProgressivePointCount);
+      TestEqual(
+          "small",
+          CesiumPointCloudUtility::computeProgressivePointCount(100, 0.01f),
+          100);
+    });
+  });
+}
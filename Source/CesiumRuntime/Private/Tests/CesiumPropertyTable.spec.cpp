@@ -495,6 +495,52 @@ void FCesiumPropertyTableSpec::Define() {
     });
   });
 
+  Describe("GetSourceData", [this]() {
+    BeforeEach([this]() { pPropertyTable->classProperty = "testClass"; });
+
+    It("gets the buffer view data of each property", [this]() {
+      std::string propertyName("testProperty");
+      std::vector<int32_t> values{1, 2, 3, 4};
+      pPropertyTable->count = static_cast<int64_t>(values.size());
+      AddPropertyTablePropertyToModel(
+          model,
+          *pPropertyTable,
+          propertyName,
+          CesiumGltf::ClassProperty::Type::SCALAR,
+          CesiumGltf::ClassProperty::ComponentType::INT32,
+          values);
+
+      FCesiumPropertyTable propertyTable(model, *pPropertyTable);
+      const FCesiumPropertyTableProperty& property =
+          UCesiumPropertyTableBlueprintLibrary::FindProperty(
+              propertyTable,
+              FString(propertyName.c_str()));
+
+      const FCesiumPropertyTablePropertySource& source =
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetSourceData(
+              property);
+      const std::vector<std::byte>& bufferData = model.buffers[0].cesium.data;
+      TestEqual("values", source.values.data(), bufferData.data());
+      TestEqual("values size", source.values.size(), bufferData.size());
+      TestTrue("no array offsets", source.arrayOffsets.empty());
+      TestTrue("no string offsets", source.stringOffsets.empty());
+      const CesiumGltf::PropertyTableProperty& gltfProperty =
+          pPropertyTable->properties[propertyName];
+      TestTrue(
+          "arrayOffsetType",
+          source.arrayOffsetType == gltfProperty.arrayOffsetType);
+      TestTrue(
+          "stringOffsetType",
+          source.stringOffsetType == gltfProperty.stringOffsetType);
+
+      TestTrue(
+          "default-constructed property",
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetSourceData(
+              FCesiumPropertyTableProperty())
+              .values.empty());
+    });
+  });
+
   Describe("GetMetadataValuesForFeature", [this]() {
     BeforeEach([this]() { pPropertyTable->classProperty = "testClass"; });
 
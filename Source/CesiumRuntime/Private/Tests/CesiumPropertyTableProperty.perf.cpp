@@ -0,0 +1,273 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumGltfSpecUtility.h"
+#include "CesiumMetadataValue.h"
+#include "CesiumPropertyTableProperty.h"
+#include "CesiumRuntime.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include <vector>
+
+using namespace CesiumGltf;
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FCesiumPropertyTablePropertyPerf,
+    "Cesium.Performance.PropertyTableProperty",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::PerfFilter)
+
+namespace {
+constexpr int64 FeatureCount = 1 << 16;
+constexpr int32 Iterations = 16;
+
+// Returns the average time, in nanoseconds, that the function takes to get
+// the value of one feature. The sum of the values is written to sum so that
+// the work can't be optimized away.
+template <typename Func> double timeGetValue(Func&& getValue, double& sum) {
+  const double start = FPlatformTime::Seconds();
+  for (int32 i = 0; i < Iterations; ++i) {
+    for (int64 featureID = 0; featureID < FeatureCount; ++featureID) {
+      sum += getValue(featureID);
+    }
+  }
+  const double seconds = FPlatformTime::Seconds() - start;
+  return seconds * 1.0e9 / (double(Iterations) * double(FeatureCount));
+}
+
+template <typename T>
+void measure(
+    const TCHAR* name,
+    const ClassProperty& classProperty,
+    const std::vector<T>& values) {
+  std::vector<std::byte> data = GetValuesAsBytes(values);
+  PropertyTableProperty propertyTableProperty;
+  PropertyTablePropertyView<T> view(
+      propertyTableProperty,
+      classProperty,
+      int64_t(values.size()),
+      std::span<const std::byte>(data.data(), data.size()));
+  const FCesiumPropertyTableProperty property(view);
+
+  double sum = 0.0;
+
+  // GetByte still resolves the type of the property view on every call, as
+  // the scalar getters below did before they cached their accessors, so it
+  // measures the cost of that dispatch.
+  const double dispatchNs = timeGetValue(
+      [&property](int64 featureID) {
+        return double(UCesiumPropertyTablePropertyBlueprintLibrary::GetByte(
+            property,
+            featureID));
+      },
+      sum);
+
+  const double integerNs = timeGetValue(
+      [&property](int64 featureID) {
+        return double(UCesiumPropertyTablePropertyBlueprintLibrary::GetInteger(
+            property,
+            featureID));
+      },
+      sum);
+
+  const double float64Ns = timeGetValue(
+      [&property](int64 featureID) {
+        return UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64(
+            property,
+            featureID);
+      },
+      sum);
+
+  const double batchStart = FPlatformTime::Seconds();
+  for (int32 i = 0; i < Iterations; ++i) {
+    TArray<double> batch =
+        UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64Values(
+            property,
+            0,
+            int32(FeatureCount));
+    sum += batch.Last();
+  }
+  const double batchNs = (FPlatformTime::Seconds() - batchStart) * 1.0e9 /
+                         (double(Iterations) * double(FeatureCount));
+
+  UE_LOG(
+      LogCesium,
+      Display,
+      TEXT(
+          "%s property, per feature: GetByte (uncached) %.1f ns, GetInteger %.1f ns, GetFloat64 %.1f ns, GetFloat64Values %.1f ns (checksum %g)"),
+      name,
+      dispatchNs,
+      integerNs,
+      float64Ns,
+      batchNs,
+      sum);
+}
+// Compares copying the raw values of all features into a float and a byte
+// array, as the metadata encoding does, with getting each raw value as a
+// generic FCesiumMetadataValue and converting it, as it did before.
+template <typename T>
+void measureRawValues(
+    const TCHAR* name,
+    const ClassProperty& classProperty,
+    const std::vector<T>& values) {
+  std::vector<std::byte> data = GetValuesAsBytes(values);
+  PropertyTableProperty propertyTableProperty;
+  PropertyTablePropertyView<T> view(
+      propertyTableProperty,
+      classProperty,
+      int64_t(values.size()),
+      std::span<const std::byte>(data.data(), data.size()));
+  const FCesiumPropertyTableProperty property(view);
+
+  double sum = 0.0;
+
+  const double perFeatureFloatNs = timeGetValue(
+      [&property](int64 featureID) {
+        return double(UCesiumMetadataValueBlueprintLibrary::GetFloat(
+            UCesiumPropertyTablePropertyBlueprintLibrary::GetRawValue(
+                property,
+                featureID),
+            0.0f));
+      },
+      sum);
+
+  const double perFeatureByteNs = timeGetValue(
+      [&property](int64 featureID) {
+        return double(UCesiumMetadataValueBlueprintLibrary::GetByte(
+            UCesiumPropertyTablePropertyBlueprintLibrary::GetRawValue(
+                property,
+                featureID),
+            0));
+      },
+      sum);
+
+  TArray<float> floats;
+  floats.SetNumZeroed(int32(FeatureCount));
+  const double floatStart = FPlatformTime::Seconds();
+  for (int32 i = 0; i < Iterations; ++i) {
+    UCesiumPropertyTablePropertyBlueprintLibrary::GetRawFloatValues(
+        property,
+        floats);
+    sum += floats.Last();
+  }
+  const double floatNs = (FPlatformTime::Seconds() - floatStart) * 1.0e9 /
+                         (double(Iterations) * double(FeatureCount));
+
+  TArray<uint8> bytes;
+  bytes.SetNumZeroed(int32(FeatureCount));
+  const double byteStart = FPlatformTime::Seconds();
+  for (int32 i = 0; i < Iterations; ++i) {
+    UCesiumPropertyTablePropertyBlueprintLibrary::GetRawByteValues(
+        property,
+        bytes);
+    sum += bytes.Last();
+  }
+  const double byteNs = (FPlatformTime::Seconds() - byteStart) * 1.0e9 /
+                        (double(Iterations) * double(FeatureCount));
+
+  UE_LOG(
+      LogCesium,
+      Display,
+      TEXT(
+          "%s property, per feature: GetRawValue and GetFloat %.1f ns, GetRawFloatValues %.2f ns, GetRawValue and GetByte %.1f ns, GetRawByteValues %.2f ns (checksum %g)"),
+      name,
+      perFeatureFloatNs,
+      floatNs,
+      perFeatureByteNs,
+      byteNs,
+      sum);
+}
+} // namespace
+
+bool FCesiumPropertyTablePropertyPerf::RunTest(const FString& Parameters) {
+  {
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::SCALAR;
+    classProperty.componentType = ClassProperty::ComponentType::INT32;
+
+    // The values fit in a byte, so that GetByte converts each of them, as the
+    // other getters do.
+    std::vector<int32_t> values(size_t(FeatureCount));
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = int32_t(i % 256);
+    }
+    measure(TEXT("int32"), classProperty, values);
+    measureRawValues(TEXT("int32"), classProperty, values);
+  }
+
+  {
+    // Raw uint8 values are copied as they are to bytes, and widened exactly to
+    // floats.
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::SCALAR;
+    classProperty.componentType = ClassProperty::ComponentType::UINT8;
+
+    std::vector<uint8_t> values(size_t(FeatureCount));
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = uint8_t(i);
+    }
+    measureRawValues(TEXT("uint8"), classProperty, values);
+  }
+
+  {
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::SCALAR;
+    classProperty.componentType = ClassProperty::ComponentType::FLOAT64;
+
+    std::vector<double> values(size_t(FeatureCount));
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = double(i % 1024) * 0.25;
+    }
+    measure(TEXT("double"), classProperty, values);
+  }
+
+  {
+    // Normalized properties are transformed before they're converted.
+    ClassProperty classProperty;
+    classProperty.type = ClassProperty::Type::SCALAR;
+    classProperty.componentType = ClassProperty::ComponentType::UINT8;
+    classProperty.normalized = true;
+    classProperty.offset = 1.0;
+    classProperty.scale = 2.0;
+
+    std::vector<uint8_t> values(size_t(FeatureCount));
+    for (size_t i = 0; i < values.size(); ++i) {
+      values[i] = uint8_t(i);
+    }
+
+    std::vector<std::byte> data = GetValuesAsBytes(values);
+    PropertyTableProperty propertyTableProperty;
+    PropertyTablePropertyView<uint8_t, true> view(
+        propertyTableProperty,
+        classProperty,
+        int64_t(values.size()),
+        std::span<const std::byte>(data.data(), data.size()));
+    const FCesiumPropertyTableProperty property(view);
+
+    double sum = 0.0;
+    const double dispatchNs = timeGetValue(
+        [&property](int64 featureID) {
+          return double(UCesiumPropertyTablePropertyBlueprintLibrary::GetByte(
+              property,
+              featureID));
+        },
+        sum);
+    const double float64Ns = timeGetValue(
+        [&property](int64 featureID) {
+          return UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64(
+              property,
+              featureID);
+        },
+        sum);
+    UE_LOG(
+        LogCesium,
+        Display,
+        TEXT(
+            "normalized uint8 property, per feature: GetByte (uncached) %.1f ns, GetFloat64 %.1f ns (checksum %g)"),
+        dispatchNs,
+        float64Ns,
+        sum);
+  }
+
+  return true;
+}
@@ -1797,6 +1797,105 @@ void FCesiumPropertyTablePropertySpec::Define() {
     });
   });
 
+  Describe("GetFloat64Values", [this]() {
+    It("returns default values for invalid property", [this]() {
+      FCesiumPropertyTableProperty property;
+      TArray<double> values =
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64Values(
+              property,
+              0,
+              3,
+              -1.0);
+      TestEqual("count", values.Num(), 3);
+      TestTrue("values", values == TArray<double>{-1.0, -1.0, -1.0});
+    });
+
+    It("gets a range of values from int32 property", [this]() {
+      CesiumGltf::PropertyTableProperty propertyTableProperty;
+      CesiumGltf::ClassProperty classProperty;
+      classProperty.type = ClassProperty::Type::SCALAR;
+      classProperty.componentType = ClassProperty::ComponentType::INT32;
+      classProperty.noData = 4;
+      classProperty.defaultProperty = 10;
+
+      std::vector<int32_t> values{-1, 2, -3, 4};
+      std::vector<std::byte> data = GetValuesAsBytes(values);
+
+      CesiumGltf::PropertyTablePropertyView<int32_t> propertyView(
+          propertyTableProperty,
+          classProperty,
+          int64_t(values.size()),
+          std::span<const std::byte>(data.data(), data.size()));
+      FCesiumPropertyTableProperty property(propertyView);
+      TestEqual(
+          "status",
+          UCesiumPropertyTablePropertyBlueprintLibrary::
+              GetPropertyTablePropertyStatus(property),
+          ECesiumPropertyTablePropertyStatus::Valid);
+
+      // The range starts and ends outside of the property.
+      TArray<double> result =
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64Values(
+              property,
+              -1,
+              6,
+              -100.0);
+      if (!TestEqual("count", result.Num(), 6)) {
+        return;
+      }
+
+      for (int32 i = 0; i < result.Num(); ++i) {
+        TestEqual(
+            FString::Printf(TEXT("value %d"), i),
+            result[i],
+            UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64(
+                property,
+                i - 1,
+                -100.0));
+      }
+    });
+
+    It("returns nothing for a negative count", [this]() {
+      FCesiumPropertyTableProperty property;
+      TestEqual(
+          "count",
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetFloat64Values(
+              property,
+              0,
+              -1)
+              .Num(),
+          0);
+    });
+  });
+
+  Describe("GetIntegerValuesForFeatures", [this]() {
+    It("gets values in the order of the feature IDs", [this]() {
+      CesiumGltf::PropertyTableProperty propertyTableProperty;
+      CesiumGltf::ClassProperty classProperty;
+      classProperty.type = ClassProperty::Type::SCALAR;
+      classProperty.componentType = ClassProperty::ComponentType::FLOAT32;
+
+      std::vector<float> values{-1.5f, 2.5f, 3.0e10f, 4.0f};
+      std::vector<std::byte> data = GetValuesAsBytes(values);
+
+      CesiumGltf::PropertyTablePropertyView<float> propertyView(
+          propertyTableProperty,
+          classProperty,
+          int64_t(values.size()),
+          std::span<const std::byte>(data.data(), data.size()));
+      FCesiumPropertyTableProperty property(propertyView);
+
+      const TArray<int64> featureIDs{3, 0, 10, 2, 1, 1, -1};
+      TArray<int32> result = UCesiumPropertyTablePropertyBlueprintLibrary::
+          GetIntegerValuesForFeatures(property, featureIDs, 7);
+
+      // Float values are truncated, and values that can't be represented fall
+      // back to the default value, as with GetInteger.
+      const TArray<int32> expected{4, -1, 7, 7, 2, 2, 7};
+      TestTrue("values", result == expected);
+    });
+  });
+
   Describe("GetIntPoint", [this]() {
     It("returns default value for invalid property", [this]() {
       FCesiumPropertyTableProperty property;
@@ -4279,4 +4378,195 @@ void FCesiumPropertyTablePropertySpec::Define() {
       }
     });
   });
+
+  Describe("GetRawFloatValues", [this]() {
+    It("matches GetRawValue for each feature", [this]() {
+      CesiumGltf::PropertyTableProperty propertyTableProperty;
+      CesiumGltf::ClassProperty classProperty;
+      classProperty.type = ClassProperty::Type::SCALAR;
+      classProperty.componentType = ClassProperty::ComponentType::UINT8;
+      classProperty.normalized = true;
+      classProperty.offset = 1.0;
+      classProperty.scale = 2.0;
+
+      std::vector<uint8_t> values{0, 1, 128, 255};
+      std::vector<std::byte> data = GetValuesAsBytes(values);
+
+      CesiumGltf::PropertyTablePropertyView<uint8_t, true> propertyView(
+          propertyTableProperty,
+          classProperty,
+          int64_t(values.size()),
+          std::span<const std::byte>(data.data(), data.size()));
+      FCesiumPropertyTableProperty property(propertyView);
+
+      TArray<float> result;
+      result.SetNumZeroed(int32(values.size()));
+      if (!TestTrue(
+              "copied",
+              UCesiumPropertyTablePropertyBlueprintLibrary::GetRawFloatValues(
+                  property,
+                  result))) {
+        return;
+      }
+
+      // Raw values are not normalized or transformed.
+      for (int32 i = 0; i < result.Num(); ++i) {
+        TestEqual(
+            "value",
+            result[i],
+            UCesiumMetadataValueBlueprintLibrary::GetFloat(
+                UCesiumPropertyTablePropertyBlueprintLibrary::GetRawValue(
+                    property,
+                    i),
+                0.0f));
+      }
+    });
+
+    It("converts values that don't fit as zero", [this]() {
+      CesiumGltf::PropertyTableProperty propertyTableProperty;
+      CesiumGltf::ClassProperty classProperty;
+      classProperty.type = ClassProperty::Type::SCALAR;
+      classProperty.componentType = ClassProperty::ComponentType::FLOAT64;
+
+      std::vector<double> values{-1.5, 1.0e300, 2.0};
+      std::vector<std::byte> data = GetValuesAsBytes(values);
+
+      CesiumGltf::PropertyTablePropertyView<double> propertyView(
+          propertyTableProperty,
+          classProperty,
+          int64_t(values.size()),
+          std::span<const std::byte>(data.data(), data.size()));
+      FCesiumPropertyTableProperty property(propertyView);
+
+      TArray<float> result;
+      result.SetNumZeroed(int32(values.size()));
+      if (!TestTrue(
+              "copied",
+              UCesiumPropertyTablePropertyBlueprintLibrary::GetRawFloatValues(
+                  property,
+                  result))) {
+        return;
+      }
+      TestEqual("in range", result[0], -1.5f);
+      TestEqual("out of range", result[1], 0.0f);
+      TestEqual("after out of range", result[2], 2.0f);
+    });
+  });
+
+  Describe("GetRawByteValues", [this]() {
+    It("copies uint8 values unchanged", [this]() {
+      CesiumGltf::PropertyTableProperty propertyTableProperty;
+      CesiumGltf::ClassProperty classProperty;
+      classProperty.type = ClassProperty::Type::SCALAR;
+      classProperty.componentType = ClassProperty::ComponentType::UINT8;
+
+      std::vector<uint8_t> values{0, 1, 128, 255};
+      std::vector<std::byte> data = GetValuesAsBytes(values);
+
+      CesiumGltf::PropertyTablePropertyView<uint8_t> propertyView(
+          propertyTableProperty,
+          classProperty,
+          int64_t(values.size()),
+          std::span<const std::byte>(data.data(), data.size()));
+      FCesiumPropertyTableProperty property(propertyView);
+
+      TArray<uint8> result;
+      result.SetNumZeroed(int32(values.size()));
+      if (!TestTrue(
+              "copied",
+              UCesiumPropertyTablePropertyBlueprintLibrary::GetRawByteValues(
+                  property,
+                  result))) {
+        return;
+      }
+      for (int32 i = 0; i < result.Num(); ++i) {
+        TestEqual("value", result[i], values[size_t(i)]);
+      }
+    });
+
+    It("converts negative int8 values as zero", [this]() {
+      CesiumGltf::PropertyTableProperty propertyTableProperty;
+      CesiumGltf::ClassProperty classProperty;
+      classProperty.type = ClassProperty::Type::SCALAR;
+      classProperty.componentType = ClassProperty::ComponentType::INT8;
+
+      std::vector<int8_t> values{-1, 5};
+      std::vector<std::byte> data = GetValuesAsBytes(values);
+
+      CesiumGltf::PropertyTablePropertyView<int8_t> propertyView(
+          propertyTableProperty,
+          classProperty,
+          int64_t(values.size()),
+          std::span<const std::byte>(data.data(), data.size()));
+      FCesiumPropertyTableProperty property(propertyView);
+
+      TArray<uint8> result{7, 7};
+      if (!TestTrue(
+              "copied",
+              UCesiumPropertyTablePropertyBlueprintLibrary::GetRawByteValues(
+                  property,
+                  result))) {
+        return;
+      }
+      TestEqual("negative", result[0], uint8(0));
+      TestEqual("positive", result[1], uint8(5));
+    });
+
+    It("returns false for non-scalar properties", [this]() {
+      CesiumGltf::PropertyTableProperty propertyTableProperty;
+      CesiumGltf::ClassProperty classProperty;
+      classProperty.type = ClassProperty::Type::VEC2;
+      classProperty.componentType = ClassProperty::ComponentType::INT32;
+
+      std::vector<glm::ivec2> values{glm::ivec2(1, 2), glm::ivec2(3, 4)};
+      std::vector<std::byte> data = GetValuesAsBytes(values);
+
+      CesiumGltf::PropertyTablePropertyView<glm::ivec2> propertyView(
+          propertyTableProperty,
+          classProperty,
+          int64_t(values.size()),
+          std::span<const std::byte>(data.data(), data.size()));
+      FCesiumPropertyTableProperty property(propertyView);
+
+      TArray<uint8> result{7, 7, 7, 7};
+      TestFalse(
+          "vec2 property",
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetRawByteValues(
+              property,
+              result));
+      TestTrue("unchanged", result == TArray<uint8>{7, 7, 7, 7});
+    });
+
+    It("returns false for invalid properties and small arrays", [this]() {
+      CesiumGltf::PropertyTableProperty propertyTableProperty;
+      CesiumGltf::ClassProperty classProperty;
+      classProperty.type = ClassProperty::Type::SCALAR;
+      classProperty.componentType = ClassProperty::ComponentType::INT32;
+
+      std::vector<int32_t> values{1, 2, 3};
+      std::vector<std::byte> data = GetValuesAsBytes(values);
+
+      CesiumGltf::PropertyTablePropertyView<int32_t> propertyView(
+          propertyTableProperty,
+          classProperty,
+          int64_t(values.size()),
+          std::span<const std::byte>(data.data(), data.size()));
+      FCesiumPropertyTableProperty property(propertyView);
+
+      TArray<uint8> small{7, 7};
+      TestFalse(
+          "small array",
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetRawByteValues(
+              property,
+              small));
+      TestTrue("unchanged", small == TArray<uint8>{7, 7});
+
+      TArray<uint8> result{7, 7, 7};
+      TestFalse(
+          "invalid property",
+          UCesiumPropertyTablePropertyBlueprintLibrary::GetRawByteValues(
+              FCesiumPropertyTableProperty(),
+              result));
+    });
+  });
 }
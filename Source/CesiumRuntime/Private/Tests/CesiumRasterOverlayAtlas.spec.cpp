@@ -0,0 +1,160 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumRasterOverlayAtlas.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumRasterOverlayAtlasSpec,
+    "Cesium.Unit.RasterOverlayAtlas",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+
+// Creates a single-channel image whose texels count up from 1.
+CesiumGltf::ImageAsset CreateImage(int32 width, int32 height) {
+  CesiumGltf::ImageAsset image;
+  image.width = width;
+  image.height = height;
+  image.channels = 1;
+  image.bytesPerChannel = 1;
+  image.pixelData.resize(size_t(width * height));
+  for (size_t i = 0; i < image.pixelData.size(); ++i) {
+    image.pixelData[i] = std::byte(i + 1);
+  }
+  return image;
+}
+
+int32 GetTexel(const CesiumGltf::ImageAsset& image, int32 x, int32 y) {
+  return int32(image.pixelData[size_t(y * image.width + x)]);
+}
+
+END_DEFINE_SPEC(FCesiumRasterOverlayAtlasSpec)
+
+void FCesiumRasterOverlayAtlasSpec::Define() {
+  Describe("padImage", [this]() {
+    It("pads an image without mipmaps by one texel", [this]() {
+      CesiumGltf::ImageAsset image = CreateImage(3, 2);
+      std::optional<CesiumRasterOverlayAtlas::Content> content =
+          CesiumRasterOverlayAtlas::padImage(image, false);
+      if (!TestTrue("padded", content.has_value())) {
+        return;
+      }
+      TestEqual("offset", content->offset, 1);
+      TestEqual("content width", content->width, 3);
+      TestEqual("content height", content->height, 2);
+      TestEqual("width", image.width, 8);
+      TestEqual("height", image.height, 4);
+      TestEqual("size", int32(image.pixelData.size()), 32);
+    });
+
+    It("copies the edge texels into the padding", [this]() {
+      CesiumGltf::ImageAsset image = CreateImage(3, 2);
+      CesiumRasterOverlayAtlas::padImage(image, false);
+
+      const int32 expected[4][8] = {
+          {1, 1, 2, 3, 3, 3, 3, 3},
+          {1, 1, 2, 3, 3, 3, 3, 3},
+          {4, 4, 5, 6, 6, 6, 6, 6},
+          {4, 4, 5, 6, 6, 6, 6, 6}};
+      for (int32 y = 0; y < 4; ++y) {
+        for (int32 x = 0; x < 8; ++x) {
+          TestEqual(
+              FString::Printf(TEXT("texel %d, %d"), x, y),
+              GetTexel(image, x, y),
+              expected[y][x]);
+        }
+      }
+    });
+
+    It("pads a mipmapped image by a texel of its last mip", [this]() {
+      CesiumGltf::ImageAsset image = CreateImage(256, 100);
+      std::optional<CesiumRasterOverlayAtlas::Content> content =
+          CesiumRasterOverlayAtlas::padImage(image, true);
+      if (!TestTrue("padded", content.has_value())) {
+        return;
+      }
+      const int32 padding = CesiumRasterOverlayAtlas::computePadding(
+          CesiumRasterOverlayAtlas::MaximumMipCount);
+      TestEqual("offset", content->offset, padding);
+      TestEqual("width", image.width, 320);
+      TestEqual("height", image.height, 192);
+      TestEqual(
+          "left of the first texel",
+          GetTexel(image, padding - 1, padding),
+          GetTexel(image, padding, padding));
+      TestEqual(
+          "below the last texel",
+          GetTexel(image, padding + 255, image.height - 1),
+          GetTexel(image, padding + 255, padding + 99));
+    });
+
+    It("leaves images that it can't pad unchanged", [this]() {
+      CesiumGltf::ImageAsset rgb = CreateImage(4, 4);
+      rgb.channels = 3;
+      rgb.pixelData.resize(48);
+      TestFalse(
+          "three channels",
+          CesiumRasterOverlayAtlas::padImage(rgb, false).has_value());
+      TestEqual("three channels width", rgb.width, 4);
+
+      CesiumGltf::ImageAsset large =
+          CreateImage(CesiumRasterOverlayAtlas::PageSize - 16, 1);
+      TestFalse(
+          "too large once padded",
+          CesiumRasterOverlayAtlas::padImage(large, true).has_value());
+      TestEqual(
+          "too large width",
+          large.width,
+          CesiumRasterOverlayAtlas::PageSize - 16);
+
+      CesiumGltf::ImageAsset mipmapped = CreateImage(4, 4);
+      mipmapped.mipPositions = {{0, 16}, {16, 4}};
+      TestFalse(
+          "mipmapped",
+          CesiumRasterOverlayAtlas::padImage(mipmapped, true).has_value());
+    });
+  });
+
+  Describe("takeImage", [this]() {
+    It("adds a padded image without mipmaps if it has none", [this]() {
+      CesiumGltf::ImageAsset image = CreateImage(3, 2);
+      std::optional<CesiumRasterOverlayAtlas::Content> content =
+          CesiumRasterOverlayAtlas::padImage(image, true);
+      if (!TestTrue("padded", content.has_value())) {
+        return;
+      }
+
+      std::optional<CesiumRasterOverlayAtlas::Image> taken =
+          CesiumRasterOverlayAtlas::takeImage(
+              image,
+              *content,
+              PF_R8,
+              false,
+              true,
+              TextureFilter::TF_Default,
+              TextureGroup::TEXTUREGROUP_World);
+      if (!TestTrue("taken", taken.has_value())) {
+        return;
+      }
+      TestEqual("mip count", taken->mipCount, 1);
+      TestEqual("content offset", taken->content.offset, content->offset);
+    });
+  });
+
+  Describe("computeTranslationAndScale", [this]() {
+    It("maps the tile's rectangle inside its padding", [this]() {
+      const double pageSize = double(CesiumRasterOverlayAtlas::PageSize);
+      const auto [translation, scale] =
+          CesiumRasterOverlayAtlas::computeTranslationAndScale(
+              CesiumAtlasAllocator::Block{512, 1024, 320, 192},
+              CesiumRasterOverlayAtlas::Content{16, 256, 128},
+              glm::dvec2(0.5, 0.25),
+              glm::dvec2(0.5, 0.5));
+      TestEqual("translation x", translation.x, (528.0 + 128.0) / pageSize);
+      TestEqual("translation y", translation.y, (1040.0 + 32.0) / pageSize);
+      TestEqual("scale x", scale.x, 128.0 / pageSize);
+      TestEqual("scale y", scale.y, 64.0 / pageSize);
+    });
+  });
+}
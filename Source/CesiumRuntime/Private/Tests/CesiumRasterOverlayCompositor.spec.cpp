@@ -0,0 +1,132 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumRasterOverlayCompositor.h"
+#include "Misc/AutomationTest.h"
+
+using namespace CesiumRasterOverlayCompositor;
+
+BEGIN_DEFINE_SPEC(
+    FCesiumRasterOverlayCompositorSpec,
+    "Cesium.Unit.RasterOverlayCompositor",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+
+const LayerInput Live{LayerKind::Live, -1};
+const LayerInput Empty{LayerKind::Empty, -1};
+const LayerInput Composited0{LayerKind::Composited, 0};
+const LayerInput Composited1{LayerKind::Composited, 1};
+
+void TestRun(
+    const FString& What,
+    const TArray<Run>& Runs,
+    int32 Index,
+    int32 FirstLayer,
+    int32 LayerCount) {
+  if (!TestTrue(What, Runs.IsValidIndex(Index))) {
+    return;
+  }
+  TestEqual(What + " first layer", Runs[Index].firstLayer, FirstLayer);
+  TestEqual(What + " layer count", Runs[Index].layerCount, LayerCount);
+}
+
+END_DEFINE_SPEC(FCesiumRasterOverlayCompositorSpec)
+
+void FCesiumRasterOverlayCompositorSpec::Define() {
+  Describe("findRuns", [this]() {
+    It("blends adjacent overlays with the same texture coordinates",
+       [this]() {
+         TArray<LayerInput> layers{Composited0, Composited0, Composited0, Live};
+         TArray<Run> runs = findRuns(layers);
+         TestEqual("count", runs.Num(), 1);
+         TestRun("run", runs, 0, 0, 3);
+       });
+
+    It("skips over empty layers and stops at live ones", [this]() {
+      TArray<LayerInput> layers{
+          Empty,
+          Composited0,
+          Empty,
+          Composited0,
+          Live,
+          Composited0,
+          Composited0,
+          Empty};
+      TArray<Run> runs = findRuns(layers);
+      TestEqual("count", runs.Num(), 2);
+      TestRun("first", runs, 0, 1, 3);
+      TestRun("second", runs, 1, 5, 2);
+    });
+
+    It("splits runs at different texture coordinates", [this]() {
+      TArray<LayerInput> layers{Composited0, Composited1, Composited1};
+      TArray<Run> runs = findRuns(layers);
+      TestEqual("count", runs.Num(), 1);
+      TestRun("run", runs, 0, 1, 2);
+    });
+
+    It("leaves single overlays as they are", [this]() {
+      TArray<LayerInput> layers{Composited0, Live, Composited0, Empty};
+      TestEqual("count", findRuns(layers).Num(), 0);
+    });
+
+    It("splits runs longer than the maximum", [this]() {
+      TArray<LayerInput> layers;
+      layers.Init(Composited0, MaximumLayerCount + 2);
+      TArray<Run> runs = findRuns(layers);
+      TestEqual("count", runs.Num(), 2);
+      TestRun("first", runs, 0, 0, MaximumLayerCount);
+      TestRun("second", runs, 1, MaximumLayerCount, 2);
+    });
+  });
+
+  Describe("findComposite", [this]() {
+    It("matches the same overlay tiles and texture coordinates", [this]() {
+      const Layer bottom{nullptr, FVector4(0.0, 0.0, 1.0, 1.0)};
+      const Layer top{nullptr, FVector4(0.5, 0.5, 0.5, 0.5)};
+      TArray<Composite> composites;
+      composites.Add(Composite{{bottom, top}, 0, nullptr});
+      composites.Add(Composite{{bottom, top}, 1, nullptr});
+
+      TestEqual("same", findComposite(composites, {bottom, top}, 0), 0);
+      TestEqual(
+          "other coordinates",
+          findComposite(composites, {bottom, top}, 1),
+          1);
+      TestEqual(
+          "other order",
+          findComposite(composites, {top, bottom}, 0),
+          INDEX_NONE);
+      TestEqual(
+          "fewer layers",
+          findComposite(composites, {bottom}, 0),
+          INDEX_NONE);
+      TestEqual(
+          "no coordinates",
+          findComposite(composites, {bottom, top}, 2),
+          INDEX_NONE);
+    });
+  });
+
+  Describe("computeSize", [this]() {
+    It("rounds up to a power of two within the limits", [this]() {
+      TestEqual("small", computeSize(10.0, 1920.0), MinimumSize);
+      TestEqual("exact", computeSize(256.0, 1920.0), 256);
+      TestEqual("between", computeSize(300.5, 1920.0), 512);
+      TestEqual("large", computeSize(100000.0, 100000.0), MaximumSize);
+    });
+
+    It("is no larger than needed to cover the viewport", [this]() {
+      TestEqual("viewport", computeSize(2048.0, 800.0), 1024);
+      TestEqual("tiny viewport", computeSize(2048.0, 1.0), MinimumSize);
+    });
+  });
+
+  Describe("computeBytes", [this]() {
+    It("includes the mip chain", [this]() {
+      TestEqual("64x64", computeBytes(64, 64), int64(21845));
+      TestEqual("2048x1024", computeBytes(2048, 1024), int64(11184810));
+    });
+  });
+}
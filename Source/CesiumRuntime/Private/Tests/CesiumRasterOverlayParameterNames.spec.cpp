@@ -0,0 +1,56 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumRasterOverlayParameterNames.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumRasterOverlayParameterNamesSpec,
+    "Cesium.Unit.RasterOverlayParameterNames",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+
+TSharedRef<const CesiumRasterOverlayParameterNames>
+CreateNames(const FString& overlayName) {
+  return MakeShared<CesiumRasterOverlayParameterNames>(
+      CesiumRasterOverlayParameterNames{
+          overlayName,
+          FName(overlayName + TEXT("_Texture")),
+          FName(overlayName + TEXT("_TranslationScale")),
+          FName(overlayName + TEXT("_TextureCoordinateIndex"))});
+}
+
+END_DEFINE_SPEC(FCesiumRasterOverlayParameterNamesSpec)
+
+void FCesiumRasterOverlayParameterNamesSpec::Define() {
+  Describe("CesiumRasterOverlayParameterNameCache", [this]() {
+    It("finds the names that were added", [this]() {
+      CesiumRasterOverlayParameterNameCache cache;
+      TestFalse("before add", cache.find("Overlay0").IsValid());
+
+      TSharedRef<const CesiumRasterOverlayParameterNames> pNames =
+          CreateNames(TEXT("Overlay0"));
+      cache.add("Overlay0", pNames);
+      TSharedPtr<const CesiumRasterOverlayParameterNames> pFound =
+          cache.find("Overlay0");
+      TestTrue("same names", pFound == pNames);
+      TestFalse("other overlay", cache.find("Overlay1").IsValid());
+      TestEqual("count", cache.getOverlayCount(), 1);
+    });
+
+    It("keeps removed names alive for their holders", [this]() {
+      CesiumRasterOverlayParameterNameCache cache;
+      cache.add("Overlay0", CreateNames(TEXT("Overlay0")));
+      TSharedPtr<const CesiumRasterOverlayParameterNames> pHeld =
+          cache.find("Overlay0");
+
+      cache.remove("Overlay0");
+      TestFalse("removed", cache.find("Overlay0").IsValid());
+      TestEqual("count", cache.getOverlayCount(), 0);
+      if (TestTrue("held", pHeld.IsValid())) {
+        TestEqual("layer name", pHeld->layerName, FString(TEXT("Overlay0")));
+      }
+    });
+  });
+}
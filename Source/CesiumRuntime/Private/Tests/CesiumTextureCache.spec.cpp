@@ -0,0 +1,149 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumTextureCache.h"
+#include "Misc/AutomationTest.h"
+#include "RenderingThread.h"
+#include <CesiumGltf/ImageAsset.h>
+
+BEGIN_DEFINE_SPEC(
+    FCesiumTextureCacheSpec,
+    "Cesium.Unit.TextureCache",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ProductFilter | EAutomationTestFlags::NonNullRHI)
+
+CesiumGltf::ImageAsset CreateImage(uint8 Seed) {
+  CesiumGltf::ImageAsset image;
+  image.width = 4;
+  image.height = 4;
+  image.channels = 4;
+  image.bytesPerChannel = 1;
+  image.pixelData.resize(4 * 4 * 4);
+  for (size_t i = 0; i < image.pixelData.size(); ++i) {
+    image.pixelData[i] = std::byte(uint8(i) + Seed);
+  }
+  return image;
+}
+
+TSharedPtr<FCesiumTextureResource>
+GetOrCreate(CesiumGltf::ImageAsset& Image, bool bSRGB = true) {
+  return CesiumTextureCache::getOrCreate(
+      Image,
+      bSRGB,
+      false,
+      std::nullopt,
+      ECesiumTextureCompression::None,
+      false);
+}
+
+END_DEFINE_SPEC(FCesiumTextureCacheSpec)
+
+void FCesiumTextureCacheSpec::Define() {
+  AfterEach([this]() { FlushRenderingCommands(); });
+
+  It("shares a texture between images with the same pixels", [this]() {
+    CesiumGltf::ImageAsset first = CreateImage(1);
+    CesiumGltf::ImageAsset second = CreateImage(1);
+
+    TSharedPtr<FCesiumTextureResource> pFirst = GetOrCreate(first);
+    TSharedPtr<FCesiumTextureResource> pSecond = GetOrCreate(second);
+    TestNotNull("first", pFirst.Get());
+    TestEqual("same resource", pSecond.Get(), pFirst.Get());
+    TestTrue("pixels released", second.pixelData.empty());
+    TestEqual("size", second.sizeBytes, first.sizeBytes);
+  });
+
+  It("keeps images with other pixels or settings apart", [this]() {
+    CesiumGltf::ImageAsset first = CreateImage(2);
+    CesiumGltf::ImageAsset otherPixels = CreateImage(3);
+    CesiumGltf::ImageAsset otherSettings = CreateImage(2);
+
+    TSharedPtr<FCesiumTextureResource> pFirst = GetOrCreate(first);
+    TSharedPtr<FCesiumTextureResource> pOtherPixels = GetOrCreate(otherPixels);
+    TSharedPtr<FCesiumTextureResource> pOtherSettings =
+        GetOrCreate(otherSettings, false);
+    TestNotEqual("other pixels", pOtherPixels.Get(), pFirst.Get());
+    TestNotEqual("other settings", pOtherSettings.Get(), pFirst.Get());
+  });
+
+  It("forgets a texture once it's no longer used", [this]() {
+    const int32 countBefore = CesiumTextureCache::getTextureCount();
+
+    CesiumGltf::ImageAsset first = CreateImage(4);
+    TSharedPtr<FCesiumTextureResource> pFirst = GetOrCreate(first);
+    TestEqual(
+        "added",
+        CesiumTextureCache::getTextureCount(),
+        countBefore + 1);
+
+    // The render command that initializes the resource holds a reference to
+    // it until it runs.
+    pFirst.Reset();
+    FlushRenderingCommands();
+    TestEqual("removed", CesiumTextureCache::getTextureCount(), countBefore);
+
+    CesiumGltf::ImageAsset second = CreateImage(4);
+    TSharedPtr<FCesiumTextureResource> pSecond = GetOrCreate(second);
+    TestNotNull("created again", pSecond.Get());
+    TestTrue("size", second.sizeBytes > 0);
+  });
+
+  Describe("source keys", [this]() {
+    It("only creates a texture once per source key", [this]() {
+      const FXxHash128 key = FXxHash128::HashBuffer("first", 5);
+      int32 createCount = 0;
+      auto create = [this, &createCount]() {
+        ++createCount;
+        CesiumGltf::ImageAsset image = CreateImage(5);
+        return GetOrCreate(image);
+      };
+
+      TSharedPtr<FCesiumTextureResource> pFirst =
+          CesiumTextureCache::getOrCreate(key, create);
+      TSharedPtr<FCesiumTextureResource> pSecond =
+          CesiumTextureCache::getOrCreate(key, create);
+      TestNotNull("first", pFirst.Get());
+      TestEqual("same resource", pSecond.Get(), pFirst.Get());
+      TestEqual("created once", createCount, 1);
+    });
+
+    It("creates a texture for each other source key", [this]() {
+      const FXxHash128 firstKey = FXxHash128::HashBuffer("second", 6);
+      const FXxHash128 otherKey = FXxHash128::HashBuffer("third", 5);
+      int32 createCount = 0;
+      auto create = [this, &createCount]() {
+        CesiumGltf::ImageAsset image = CreateImage(uint8(6 + createCount++));
+        return GetOrCreate(image);
+      };
+
+      TSharedPtr<FCesiumTextureResource> pFirst =
+          CesiumTextureCache::getOrCreate(firstKey, create);
+      TSharedPtr<FCesiumTextureResource> pOther =
+          CesiumTextureCache::getOrCreate(otherKey, create);
+      TestNotEqual("other resource", pOther.Get(), pFirst.Get());
+      TestEqual("created twice", createCount, 2);
+    });
+
+    It("forgets a source key once its texture is no longer used", [this]() {
+      const int32 countBefore = CesiumTextureCache::getSourceKeyCount();
+      const FXxHash128 key = FXxHash128::HashBuffer("fourth", 6);
+      auto create = [this]() {
+        CesiumGltf::ImageAsset image = CreateImage(8);
+        return GetOrCreate(image);
+      };
+
+      TSharedPtr<FCesiumTextureResource> pFirst =
+          CesiumTextureCache::getOrCreate(key, create);
+      TestEqual(
+          "added",
+          CesiumTextureCache::getSourceKeyCount(),
+          countBefore + 1);
+
+      pFirst.Reset();
+      FlushRenderingCommands();
+      TestEqual(
+          "removed",
+          CesiumTextureCache::getSourceKeyCount(),
+          countBefore);
+    });
+  });
+}
@@ -0,0 +1,286 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumTextureCompressor.h"
+#include "Misc/AutomationTest.h"
+
+using namespace CesiumGltf;
+
+BEGIN_DEFINE_SPEC(
+    FCesiumTextureCompressorSpec,
+    "Cesium.Unit.TextureCompressor",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+ImageAsset CreateImage(int32 width, int32 height, uint8 alpha);
+END_DEFINE_SPEC(FCesiumTextureCompressorSpec)
+
+namespace {
+// Decodes the colors of a four-color BC1 block. Only the endpoint entries are
+// decoded exactly; the interpolated entries may differ from a GPU's by one.
+void decodeColorBlock(const uint8* pBlock, uint8* pRgba) {
+  const uint16 colors[2] = {
+      uint16(pBlock[0] | pBlock[1] << 8),
+      uint16(pBlock[2] | pBlock[3] << 8)};
+  uint8 palette[4][3];
+  for (int32 i = 0; i < 2; ++i) {
+    const int32 r = (colors[i] >> 11) & 0x1f;
+    const int32 g = (colors[i] >> 5) & 0x3f;
+    const int32 b = colors[i] & 0x1f;
+    palette[i][0] = uint8(r << 3 | r >> 2);
+    palette[i][1] = uint8(g << 2 | g >> 4);
+    palette[i][2] = uint8(b << 3 | b >> 2);
+  }
+  for (int32 c = 0; c < 3; ++c) {
+    palette[2][c] = uint8((2 * palette[0][c] + palette[1][c]) / 3);
+    palette[3][c] = uint8((palette[0][c] + 2 * palette[1][c]) / 3);
+  }
+
+  const uint32 indexBits =
+      pBlock[4] | pBlock[5] << 8 | pBlock[6] << 16 | uint32(pBlock[7]) << 24;
+  for (int32 i = 0; i < 16; ++i) {
+    const uint32 index = (indexBits >> (2 * i)) & 0x3;
+    pRgba[i * 4] = palette[index][0];
+    pRgba[i * 4 + 1] = palette[index][1];
+    pRgba[i * 4 + 2] = palette[index][2];
+  }
+}
+
+// Decodes the alphas of an eight-value BC3 alpha block.
+void decodeAlphaBlock(const uint8* pBlock, uint8* pRgba) {
+  uint8 palette[8] = {pBlock[0], pBlock[1]};
+  for (int32 i = 2; i < 8; ++i) {
+    palette[i] = uint8(((8 - i) * pBlock[0] + (i - 1) * pBlock[1]) / 7);
+  }
+
+  uint64 indexBits = 0;
+  for (int32 i = 0; i < 6; ++i) {
+    indexBits |= uint64(pBlock[2 + i]) << (8 * i);
+  }
+  for (int32 i = 0; i < 16; ++i) {
+    pRgba[i * 4 + 3] = palette[(indexBits >> (3 * i)) & 0x7];
+  }
+}
+} // namespace
+
+ImageAsset FCesiumTextureCompressorSpec::CreateImage(
+    int32 width,
+    int32 height,
+    uint8 alpha) {
+  ImageAsset image;
+  image.width = width;
+  image.height = height;
+  image.channels = 4;
+  image.bytesPerChannel = 1;
+  image.pixelData.resize(size_t(width * height * 4));
+  for (size_t i = 0; i < image.pixelData.size(); i += 4) {
+    image.pixelData[i] = std::byte(i % 256);
+    image.pixelData[i + 1] = std::byte(128);
+    image.pixelData[i + 2] = std::byte(255 - i % 256);
+    image.pixelData[i + 3] = std::byte(alpha);
+  }
+  return image;
+}
+
+void FCesiumTextureCompressorSpec::Define() {
+  Describe("compressBlockBC1", [this]() {
+    It("reproduces a solid color exactly", [this]() {
+      uint8 pixels[64];
+      for (int32 i = 0; i < 16; ++i) {
+        pixels[i * 4] = 255;
+        pixels[i * 4 + 1] = 0;
+        pixels[i * 4 + 2] = 255;
+        pixels[i * 4 + 3] = 255;
+      }
+
+      for (ECesiumTextureCompression compression :
+           {ECesiumTextureCompression::Fast,
+            ECesiumTextureCompression::HighQuality}) {
+        uint8 block[CesiumTextureCompressor::BC1BlockBytes];
+        CesiumTextureCompressor::compressBlockBC1(pixels, compression, block);
+
+        uint8 decoded[64];
+        decodeColorBlock(block, decoded);
+        for (int32 i = 0; i < 16; ++i) {
+          TestEqual("red", decoded[i * 4], 255);
+          TestEqual("green", decoded[i * 4 + 1], 0);
+          TestEqual("blue", decoded[i * 4 + 2], 255);
+        }
+      }
+    });
+
+    It("reproduces two colors exactly in high quality", [this]() {
+      uint8 pixels[64];
+      for (int32 i = 0; i < 16; ++i) {
+        const uint8 value = i % 3 == 0 ? 255 : 0;
+        pixels[i * 4] = value;
+        pixels[i * 4 + 1] = value;
+        pixels[i * 4 + 2] = value;
+        pixels[i * 4 + 3] = 255;
+      }
+
+      uint8 block[CesiumTextureCompressor::BC1BlockBytes];
+      CesiumTextureCompressor::compressBlockBC1(
+          pixels,
+          ECesiumTextureCompression::HighQuality,
+          block);
+      TestTrue(
+          "four-color mode",
+          (block[0] | block[1] << 8) > (block[2] | block[3] << 8));
+
+      uint8 decoded[64];
+      decodeColorBlock(block, decoded);
+      for (int32 i = 0; i < 16; ++i) {
+        TestEqual("value", decoded[i * 4], pixels[i * 4]);
+      }
+    });
+  });
+
+  Describe("compressBlockBC3", [this]() {
+    It("reproduces two alphas exactly", [this]() {
+      uint8 pixels[64] = {};
+      for (int32 i = 0; i < 16; ++i) {
+        pixels[i * 4 + 3] = i % 2 == 0 ? 0 : 255;
+      }
+
+      uint8 block[CesiumTextureCompressor::BC3BlockBytes];
+      CesiumTextureCompressor::compressBlockBC3(
+          pixels,
+          ECesiumTextureCompression::Fast,
+          block);
+
+      uint8 decoded[64];
+      decodeAlphaBlock(block, decoded);
+      for (int32 i = 0; i < 16; ++i) {
+        TestEqual("alpha", decoded[i * 4 + 3], pixels[i * 4 + 3]);
+      }
+    });
+  });
+
+  Describe("computeCompressedSize", [this]() {
+    It("rounds partial blocks up", [this]() {
+      TestEqual(
+          "8x8 BC1",
+          CesiumTextureCompressor::computeCompressedSize(8, 8, 8),
+          int64(32));
+      TestEqual(
+          "6x5 BC3",
+          CesiumTextureCompressor::computeCompressedSize(16, 6, 5),
+          int64(64));
+      TestEqual(
+          "1x1 BC1",
+          CesiumTextureCompressor::computeCompressedSize(8, 1, 1),
+          int64(8));
+    });
+  });
+
+  Describe("compressImage", [this]() {
+    It("compresses opaque images to BC1", [this]() {
+      ImageAsset image = CreateImage(8, 8, 255);
+      TestTrue(
+          "compressed",
+          CesiumTextureCompressor::compressImage(
+              image,
+              ECesiumTextureCompression::Fast,
+              true,
+              true));
+      TestEqual(
+          "format",
+          image.compressedPixelFormat,
+          GpuCompressedPixelFormat::BC1_RGB);
+      TestEqual("size", int64(image.pixelData.size()), int64(32));
+    });
+
+    It("compresses translucent images to BC3", [this]() {
+      ImageAsset image = CreateImage(8, 8, 128);
+      TestTrue(
+          "compressed",
+          CesiumTextureCompressor::compressImage(
+              image,
+              ECesiumTextureCompression::Fast,
+              true,
+              true));
+      TestEqual(
+          "format",
+          image.compressedPixelFormat,
+          GpuCompressedPixelFormat::BC3_RGBA);
+      TestEqual("size", int64(image.pixelData.size()), int64(64));
+    });
+
+    It("uses BC3 for opaque images when BC1 is unsupported", [this]() {
+      ImageAsset image = CreateImage(8, 8, 255);
+      TestTrue(
+          "compressed",
+          CesiumTextureCompressor::compressImage(
+              image,
+              ECesiumTextureCompression::Fast,
+              false,
+              true));
+      TestEqual(
+          "format",
+          image.compressedPixelFormat,
+          GpuCompressedPixelFormat::BC3_RGBA);
+    });
+
+    It("compresses every mip level", [this]() {
+      ImageAsset image = CreateImage(8, 8, 255);
+      image.pixelData.resize(size_t((64 + 16 + 4 + 1) * 4));
+      image.mipPositions = {
+          ImageAssetMipPosition{0, 256},
+          ImageAssetMipPosition{256, 64},
+          ImageAssetMipPosition{320, 16},
+          ImageAssetMipPosition{336, 4}};
+
+      TestTrue(
+          "compressed",
+          CesiumTextureCompressor::compressImage(
+              image,
+              ECesiumTextureCompression::HighQuality,
+              true,
+              true));
+      if (!TestEqual("levels", int64(image.mipPositions.size()), int64(4))) {
+        return;
+      }
+      TestEqual("level 0", int64(image.mipPositions[0].byteSize), int64(32));
+      TestEqual("level 1", int64(image.mipPositions[1].byteOffset), int64(32));
+      TestEqual("level 1", int64(image.mipPositions[1].byteSize), int64(8));
+      TestEqual("level 2", int64(image.mipPositions[2].byteSize), int64(8));
+      TestEqual("level 3", int64(image.mipPositions[3].byteOffset), int64(48));
+      TestEqual("size", int64(image.pixelData.size()), int64(56));
+    });
+
+    It("leaves images it can't compress unchanged", [this]() {
+      ImageAsset oddSize = CreateImage(6, 4, 255);
+      TestFalse(
+          "odd size",
+          CesiumTextureCompressor::compressImage(
+              oddSize,
+              ECesiumTextureCompression::Fast,
+              true,
+              true));
+      TestEqual("odd size bytes", int64(oddSize.pixelData.size()), int64(96));
+
+      ImageAsset unsupported = CreateImage(8, 8, 255);
+      TestFalse(
+          "unsupported",
+          CesiumTextureCompressor::compressImage(
+              unsupported,
+              ECesiumTextureCompression::Fast,
+              false,
+              false));
+      TestEqual(
+          "unsupported format",
+          unsupported.compressedPixelFormat,
+          GpuCompressedPixelFormat::NONE);
+
+      ImageAsset disabled = CreateImage(8, 8, 255);
+      TestFalse(
+          "disabled",
+          CesiumTextureCompressor::compressImage(
+              disabled,
+              ECesiumTextureCompression::None,
+              true,
+              true));
+    });
+  });
+}
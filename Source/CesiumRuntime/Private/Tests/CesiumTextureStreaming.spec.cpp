@@ -0,0 +1,185 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumTextureStreaming.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumTextureStreamingSpec,
+    "Cesium.Unit.TextureStreaming",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+END_DEFINE_SPEC(FCesiumTextureStreamingSpec)
+
+void FCesiumTextureStreamingSpec::Define() {
+  Describe("computeTailMip", [this]() {
+    It("keeps mips of 64 texels or less resident", [this]() {
+      TestEqual(
+          "1024x1024",
+          CesiumTextureStreaming::computeTailMip(1024, 1024, 11, 1, 1),
+          4);
+      TestEqual(
+          "1024x16",
+          CesiumTextureStreaming::computeTailMip(1024, 16, 11, 1, 1),
+          4);
+      TestEqual(
+          "64x64",
+          CesiumTextureStreaming::computeTailMip(64, 64, 7, 1, 1),
+          0);
+    });
+
+    It("never passes the last mip", [this]() {
+      TestEqual(
+          "no mipmaps",
+          CesiumTextureStreaming::computeTailMip(1024, 1024, 1, 1, 1),
+          0);
+      TestEqual(
+          "partial chain",
+          CesiumTextureStreaming::computeTailMip(1024, 1024, 3, 1, 1),
+          2);
+    });
+
+    It("stops at the last mip that is a multiple of the block size", [this]() {
+      // A 1000x1000 BC1 image has mips of 1000, 500, 250, 125, 62, and so on.
+      // Only the first two are multiples of its 4x4 blocks.
+      TestEqual(
+          "1000x1000 BC1",
+          CesiumTextureStreaming::computeTailMip(1000, 1000, 10, 4, 4),
+          1);
+      TestEqual(
+          "600x600 BC1",
+          CesiumTextureStreaming::computeTailMip(600, 600, 10, 4, 4),
+          1);
+      TestEqual(
+          "1024x1024 BC1",
+          CesiumTextureStreaming::computeTailMip(1024, 1024, 11, 4, 4),
+          4);
+      TestEqual(
+          "1024x16 BC1",
+          CesiumTextureStreaming::computeTailMip(1024, 16, 11, 4, 4),
+          2);
+    });
+  });
+
+  Describe("computeFirstMipForScreenSize", [this]() {
+    It("uses the full texture for tiles larger than it on screen", [this]() {
+      TestEqual(
+          "larger",
+          CesiumTextureStreaming::computeFirstMipForScreenSize(
+              1024,
+              1024,
+              11,
+              1,
+              1,
+              2000.0),
+          0);
+    });
+
+    It("chooses the coarsest mip that covers the tile", [this]() {
+      TestEqual(
+          "300 pixels",
+          CesiumTextureStreaming::computeFirstMipForScreenSize(
+              1024,
+              1024,
+              11,
+              1,
+              1,
+              300.0),
+          1);
+      TestEqual(
+          "256 pixels",
+          CesiumTextureStreaming::computeFirstMipForScreenSize(
+              1024,
+              1024,
+              11,
+              1,
+              1,
+              256.0),
+          2);
+    });
+
+    It("falls back to the tail for small or hidden tiles", [this]() {
+      TestEqual(
+          "10 pixels",
+          CesiumTextureStreaming::computeFirstMipForScreenSize(
+              1024,
+              1024,
+              11,
+              1,
+              1,
+              10.0),
+          4);
+      TestEqual(
+          "hidden",
+          CesiumTextureStreaming::computeFirstMipForScreenSize(
+              1024,
+              1024,
+              11,
+              1,
+              1,
+              0.0),
+          4);
+    });
+
+    It("only starts block-compressed textures at whole blocks", [this]() {
+      for (double screenSize : {0.0, 10.0, 100.0, 300.0, 600.0, 2000.0}) {
+        const int32 firstMip =
+            CesiumTextureStreaming::computeFirstMipForScreenSize(
+                1000,
+                1000,
+                10,
+                4,
+                4,
+                screenSize);
+        TestTrue(
+            FString::Printf(TEXT("%.0f pixels"), screenSize),
+            (1000 >> firstMip) % 4 == 0);
+      }
+      TestEqual(
+          "hidden 1000x1000 BC1",
+          CesiumTextureStreaming::computeFirstMipForScreenSize(
+              1000,
+              1000,
+              10,
+              4,
+              4,
+              0.0),
+          1);
+    });
+  });
+
+  Describe("MipRequests", [this]() {
+    It("keeps the finest mip requested in a frame", [this]() {
+      CesiumTextureStreaming::MipRequests requests(4);
+      TestEqual("none", requests.getRequestedFirstMip(1), 4);
+      requests.request(2, 1);
+      requests.request(3, 1);
+      TestEqual("finest", requests.getRequestedFirstMip(1), 2);
+      TestEqual("next frame", requests.getRequestedFirstMip(2), 4);
+    });
+
+    It("retains the requests of the previous frame", [this]() {
+      // Two tilesets share the texture. The first needs mip 3 and the second
+      // mip 1, and the first is updated before the second makes its request.
+      CesiumTextureStreaming::MipRequests requests(4);
+      requests.request(3, 1);
+      requests.request(1, 1);
+      requests.request(3, 2);
+      TestEqual("requested", requests.getRequestedFirstMip(2), 3);
+      TestEqual("retained", requests.getRetainedFirstMip(2), 1);
+
+      requests.request(1, 2);
+      requests.request(3, 3);
+      TestEqual("still retained", requests.getRetainedFirstMip(3), 1);
+    });
+
+    It("forgets requests older than the previous frame", [this]() {
+      CesiumTextureStreaming::MipRequests requests(4);
+      requests.request(1, 1);
+      requests.request(3, 3);
+      TestEqual("retained", requests.getRetainedFirstMip(3), 3);
+      TestEqual("unrequested", requests.getRetainedFirstMip(5), 4);
+    });
+  });
+}
@@ -2,6 +2,7 @@
 
 #include "CesiumTextureUtility.h"
 #include "CesiumAsync/AsyncSystem.h"
+#include "CesiumMipMapGenerator.h"
 #include "ExtensionImageAssetUnreal.h"
 #include "Misc/AutomationTest.h"
 #include "RenderingThread.h"
@@ -20,13 +21,17 @@ BEGIN_DEFINE_SPEC(
 std::vector<uint8_t> originalPixels;
 std::vector<uint8_t> originalMipPixels;
 std::vector<uint8_t> expectedMipPixelsIfGenerated;
+std::vector<uint8_t> expectedSRGBMipPixelsIfGenerated;
 CesiumUtility::IntrusivePointer<CesiumGltf::ImageAsset> pImageAsset;
 
 void RunTests();
 
+std::vector<uint8_t> GenerateExpectedMipPixels(bool sRGB);
+
 void CheckPixels(
     const IntrusivePointer<ReferenceCountedUnrealTexture>& pRefCountedTexture,
-    bool requireMips = false);
+    bool requireMips = false,
+    bool mipsGeneratedAsSRGB = true);
 void CheckSRGB(
     const IntrusivePointer<ReferenceCountedUnrealTexture>& pRefCountedTexture,
     bool expectedSRGB);
@@ -65,20 +70,8 @@ void CesiumTextureUtilitySpec::Define() {
           originalPixels.data(),
           originalPixels.size());
 
-      CesiumUtility::IntrusivePointer<CesiumGltf::ImageAsset> pCopy =
-          new CesiumGltf::ImageAsset(*pImageAsset);
-      CesiumGltfReader::ImageDecoder::generateMipMaps(*pCopy);
-
-      expectedMipPixelsIfGenerated.clear();
-
-      if (pCopy->mipPositions.size() >= 2) {
-        expectedMipPixelsIfGenerated.resize(pCopy->mipPositions[1].byteSize);
-        for (size_t iSrc = pCopy->mipPositions[1].byteOffset, iDest = 0;
-             iDest < pCopy->mipPositions[1].byteSize;
-             ++iSrc, ++iDest) {
-          expectedMipPixelsIfGenerated[iDest] = uint8_t(pCopy->pixelData[iSrc]);
-        }
-      }
+      expectedMipPixelsIfGenerated = GenerateExpectedMipPixels(false);
+      expectedSRGBMipPixelsIfGenerated = GenerateExpectedMipPixels(true);
     });
 
     RunTests();
@@ -117,6 +110,70 @@ void CesiumTextureUtilitySpec::Define() {
 
     RunTests();
   });
+
+  Describe("reduceImageChannels", [this]() {
+    BeforeEach([this]() {
+      pImageAsset.emplace();
+      pImageAsset->width = 2;
+      pImageAsset->height = 1;
+      pImageAsset->pixelData = {
+          std::byte(0x10),
+          std::byte(0x20),
+          std::byte(0x30),
+          std::byte(0x40),
+          std::byte(0x11),
+          std::byte(0x21),
+          std::byte(0x31),
+          std::byte(0x41),
+          std::byte(0x12),
+          std::byte(0x22),
+          std::byte(0x32),
+          std::byte(0x42)};
+      pImageAsset->mipPositions = {
+          CesiumGltf::ImageAssetMipPosition{0, 8},
+          CesiumGltf::ImageAssetMipPosition{8, 4}};
+    });
+
+    It("keeps the red and alpha channels for RG", [this]() {
+      TestTrue("reduced", reduceImageChannels(*pImageAsset, 2));
+      TestEqual("channels", pImageAsset->channels, 2);
+      const std::vector<std::byte> expected{
+          std::byte(0x10),
+          std::byte(0x40),
+          std::byte(0x11),
+          std::byte(0x41),
+          std::byte(0x12),
+          std::byte(0x42)};
+      TestTrue("pixels", pImageAsset->pixelData == expected);
+      TestEqual(
+          "mip 1 offset",
+          pImageAsset->mipPositions[1].byteOffset,
+          size_t(4));
+      TestEqual(
+          "mip 1 size",
+          pImageAsset->mipPositions[1].byteSize,
+          size_t(2));
+    });
+
+    It("keeps the red channel for R", [this]() {
+      pImageAsset->mipPositions.clear();
+      pImageAsset->pixelData.resize(8);
+      TestTrue("reduced", reduceImageChannels(*pImageAsset, 1));
+      TestEqual("channels", pImageAsset->channels, 1);
+      const std::vector<std::byte> expected{std::byte(0x10), std::byte(0x11)};
+      TestTrue("pixels", pImageAsset->pixelData == expected);
+      TestTrue("no mips", pImageAsset->mipPositions.empty());
+    });
+
+    It("leaves images with fewer channels alone", [this]() {
+      pImageAsset->mipPositions.clear();
+      pImageAsset->channels = 1;
+      pImageAsset->height = 6;
+      TestFalse("reduced", reduceImageChannels(*pImageAsset, 2));
+      TestEqual("channels", pImageAsset->channels, 1);
+      TestEqual("size", pImageAsset->pixelData.size(), size_t(12));
+    });
+  });
 }
 
 void CesiumTextureUtilitySpec::RunTests() {
@@ -134,7 +191,7 @@ void CesiumTextureUtilitySpec::RunTests() {
 
     IntrusivePointer<ReferenceCountedUnrealTexture> pRefCountedTexture =
         loadTextureGameThreadPart(pHalfLoaded.Get());
-    CheckPixels(pRefCountedTexture, true);
+    CheckPixels(pRefCountedTexture, true, false);
     CheckSRGB(pRefCountedTexture, false);
     CheckAddress(
         pRefCountedTexture,
@@ -392,9 +449,28 @@ void CesiumTextureUtilitySpec::RunTests() {
   });
 }
 
+std::vector<uint8_t>
+CesiumTextureUtilitySpec::GenerateExpectedMipPixels(bool sRGB) {
+  CesiumUtility::IntrusivePointer<CesiumGltf::ImageAsset> pCopy =
+      new CesiumGltf::ImageAsset(*pImageAsset);
+  CesiumMipMapGenerator::generateMipMaps(*pCopy, sRGB);
+
+  std::vector<uint8_t> result;
+  if (pCopy->mipPositions.size() >= 2) {
+    result.resize(pCopy->mipPositions[1].byteSize);
+    for (size_t iSrc = pCopy->mipPositions[1].byteOffset, iDest = 0;
+         iDest < pCopy->mipPositions[1].byteSize;
+         ++iSrc, ++iDest) {
+      result[iDest] = uint8_t(pCopy->pixelData[iSrc]);
+    }
+  }
+  return result;
+}
+
 void CesiumTextureUtilitySpec::CheckPixels(
     const IntrusivePointer<ReferenceCountedUnrealTexture>& pRefCountedTexture,
-    bool requireMips) {
+    bool requireMips,
+    bool mipsGeneratedAsSRGB) {
   TestNotNull("pRefCountedTexture", pRefCountedTexture.get());
   TestNotNull(
       "pRefCountedTexture->getUnrealTexture()",
@@ -449,9 +525,10 @@ void CesiumTextureUtilitySpec::CheckPixels(
   }
 
   if (!readPixelsMip1.IsEmpty()) {
-    std::vector<uint8_t>& pixelsToMatch = originalMipPixels.empty()
-                                              ? expectedMipPixelsIfGenerated
-                                              : originalMipPixels;
+    std::vector<uint8_t>& pixelsToMatch =
+        !originalMipPixels.empty() ? originalMipPixels
+        : mipsGeneratedAsSRGB      ? expectedSRGBMipPixelsIfGenerated
+                                   : expectedMipPixelsIfGenerated;
 
     TestEqual(
         "read buffer size",
@@ -0,0 +1,117 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumTileObjectPool.h"
+#include "CesiumGltfComponent.h"
+#include "CesiumGltfPrimitiveComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Misc/AutomationTest.h"
+#include "RenderingThread.h"
+#include "UObject/Package.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumTileObjectPoolSpec,
+    "Cesium.Unit.TileObjectPool",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ProductFilter)
+
+TUniquePtr<CesiumTileObjectPool> pPool;
+
+// Creates a tile with a single primitive, whose static mesh has the state a
+// loaded tile would leave behind.
+UStaticMesh* CreateTile(UCesiumGltfComponent*& pGltf) {
+  pGltf = NewObject<UCesiumGltfComponent>();
+  UCesiumGltfPrimitiveComponent* pPrimitive =
+      NewObject<UCesiumGltfPrimitiveComponent>(pGltf);
+  pPrimitive->AttachToComponent(
+      pGltf,
+      FAttachmentTransformRules(EAttachmentRule::KeepRelative, false));
+
+  UStaticMesh* pStaticMesh =
+      NewObject<UStaticMesh>(pPrimitive, FName("PreviousMesh"));
+  pStaticMesh->SetExtendedBounds(
+      FBoxSphereBounds(FVector(1.0), FVector(2.0), 3.0));
+  pStaticMesh->SetPositiveBoundsExtension(FVector(4.0));
+  pStaticMesh->SetNegativeBoundsExtension(FVector(5.0));
+#if WITH_EDITORONLY_DATA
+  pStaticMesh->NaniteSettings.bEnabled = true;
+#endif
+  pStaticMesh->SetLightingGuid();
+  pPrimitive->SetStaticMesh(pStaticMesh);
+
+  return pStaticMesh;
+}
+
+END_DEFINE_SPEC(FCesiumTileObjectPoolSpec)
+
+void FCesiumTileObjectPoolSpec::Define() {
+  BeforeEach([this]() { pPool = MakeUnique<CesiumTileObjectPool>(4); });
+
+  AfterEach([this]() {
+    pPool->clear();
+    pPool.Reset();
+  });
+
+  Describe("acquireStaticMesh", [this]() {
+    It("returns nullptr when the pool is empty", [this]() {
+      UCesiumGltfComponent* pOuter = NewObject<UCesiumGltfComponent>();
+      TestNull(
+          "static mesh",
+          pPool->acquireStaticMesh(*pOuter, FName("NewMesh")));
+    });
+
+    It("moves a recycled mesh into the acquiring tile", [this]() {
+      UCesiumGltfComponent* pPreviousTile = nullptr;
+      UStaticMesh* pStaticMesh = CreateTile(pPreviousTile);
+      const FGuid previousLightingGuid = pStaticMesh->GetLightingGuid();
+
+      pPool->recycle(*pPreviousTile, false);
+      TestEqual(
+          "outer while pooled",
+          pStaticMesh->GetOuter(),
+          static_cast<UObject*>(GetTransientPackage()));
+
+      // Pooled meshes can only be reused once the render thread has released
+      // their resources.
+      FlushRenderingCommands();
+
+      UCesiumGltfComponent* pNewTile = NewObject<UCesiumGltfComponent>();
+      UCesiumGltfPrimitiveComponent* pNewPrimitive =
+          NewObject<UCesiumGltfPrimitiveComponent>(pNewTile);
+      UStaticMesh* pAcquired =
+          pPool->acquireStaticMesh(*pNewPrimitive, FName("NewMesh"));
+      TestEqual("same mesh", pAcquired, pStaticMesh);
+      if (!pAcquired) {
+        return;
+      }
+
+      TestEqual(
+          "outer",
+          pAcquired->GetOuter(),
+          static_cast<UObject*>(pNewPrimitive));
+      TestEqual("name", pAcquired->GetFName(), FName("NewMesh"));
+      TestNull("render data", pAcquired->GetRenderData());
+      TestNull("body setup", pAcquired->GetBodySetup());
+      TestEqual("materials", pAcquired->GetStaticMaterials().Num(), 0);
+      TestEqual(
+          "extended bounds",
+          pAcquired->GetExtendedBounds().SphereRadius,
+          0.0);
+      TestEqual(
+          "positive bounds extension",
+          pAcquired->GetPositiveBoundsExtension(),
+          FVector::ZeroVector);
+      TestEqual(
+          "negative bounds extension",
+          pAcquired->GetNegativeBoundsExtension(),
+          FVector::ZeroVector);
+#if WITH_EDITORONLY_DATA
+      TestFalse("Nanite enabled", pAcquired->NaniteSettings.bEnabled);
+#endif
+      TestNotEqual(
+          "lighting GUID",
+          pAcquired->GetLightingGuid(),
+          previousLightingGuid);
+      TestEqual("pool emptied", pPool->getStaticMeshCount(), 0);
+    });
+  });
+}
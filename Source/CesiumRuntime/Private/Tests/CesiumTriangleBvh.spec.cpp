@@ -0,0 +1,153 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "CesiumTriangleBvh.h"
+#include "Misc/AutomationTest.h"
+
+BEGIN_DEFINE_SPEC(
+    FCesiumTriangleBvhSpec,
+    "Cesium.Unit.CesiumTriangleBvh",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ServerContext |
+        EAutomationTestFlags::CommandletContext |
+        EAutomationTestFlags::ProductFilter)
+
+/**
+ * Creates a flat grid of cells x cells unit squares at z = 0, with two
+ * triangles per square.
+ */
+CesiumTriangleBvh CreateGrid(int32 cells);
+END_DEFINE_SPEC(FCesiumTriangleBvhSpec)
+
+CesiumTriangleBvh FCesiumTriangleBvhSpec::CreateGrid(int32 cells) {
+  TArray<FVector3f> positions;
+  for (int32 y = 0; y <= cells; ++y) {
+    for (int32 x = 0; x <= cells; ++x) {
+      positions.Add(FVector3f(float(x), float(y), 0.0f));
+    }
+  }
+
+  TArray<uint32> indices;
+  const uint32 stride = uint32(cells + 1);
+  for (uint32 y = 0; y < uint32(cells); ++y) {
+    for (uint32 x = 0; x < uint32(cells); ++x) {
+      const uint32 i = y * stride + x;
+      indices.Append({i, i + 1, i + stride + 1});
+      indices.Append({i, i + stride + 1, i + stride});
+    }
+  }
+
+  return CesiumTriangleBvh(MoveTemp(positions), MoveTemp(indices));
+}
+
+void FCesiumTriangleBvhSpec::Define() {
+  Describe("lineTrace", [this]() {
+    It("returns nothing for an empty hierarchy", [this]() {
+      CesiumTriangleBvh bvh({}, {});
+      TestEqual("triangleCount", bvh.getTriangleCount(), 0);
+      TestFalse(
+          "hit",
+          bvh.lineTrace(FVector3f(0.0f, 0.0f, 1.0f), FVector3f(0.0f))
+              .has_value());
+    });
+
+    It("ignores triangles with out-of-range indices", [this]() {
+      CesiumTriangleBvh bvh(
+          {FVector3f(0.0f), FVector3f(1.0f, 0.0f, 0.0f)},
+          {0, 1, 2});
+      TestEqual("triangleCount", bvh.getTriangleCount(), 0);
+    });
+
+    It("finds the face that was hit", [this]() {
+      CesiumTriangleBvh bvh = CreateGrid(8);
+      TestEqual("triangleCount", bvh.getTriangleCount(), 128);
+
+      // The point (5.25, 3.75) is in the upper-left triangle of cell (5, 3).
+      std::optional<CesiumTriangleBvh::Hit> maybeHit = bvh.lineTrace(
+          FVector3f(5.25f, 3.75f, 10.0f),
+          FVector3f(5.25f, 3.75f, -10.0f));
+      if (!TestTrue("hit", maybeHit.has_value())) {
+        return;
+      }
+
+      TestEqual("faceIndex", maybeHit->faceIndex, 2 * (3 * 8 + 5) + 1);
+      TestNearlyEqual("time", maybeHit->time, 0.5f);
+      TestNearlyEqual(
+          "position",
+          FVector(maybeHit->position),
+          FVector(5.25, 3.75, 0.0));
+      TestNearlyEqual("normal", FVector(maybeHit->normal), FVector::UpVector);
+    });
+
+    It("orients the normal toward the start of the segment", [this]() {
+      CesiumTriangleBvh bvh = CreateGrid(2);
+      std::optional<CesiumTriangleBvh::Hit> maybeHit = bvh.lineTrace(
+          FVector3f(0.5f, 0.25f, -1.0f),
+          FVector3f(0.5f, 0.25f, 1.0f));
+      if (!TestTrue("hit", maybeHit.has_value())) {
+        return;
+      }
+
+      TestNearlyEqual("normal", FVector(maybeHit->normal), FVector::DownVector);
+    });
+
+    It("returns the closest of several hits", [this]() {
+      // Two parallel triangles at z = 0 and z = 1.
+      CesiumTriangleBvh bvh(
+          {FVector3f(0.0f, 0.0f, 0.0f),
+           FVector3f(1.0f, 0.0f, 0.0f),
+           FVector3f(0.0f, 1.0f, 0.0f),
+           FVector3f(0.0f, 0.0f, 1.0f),
+           FVector3f(1.0f, 0.0f, 1.0f),
+           FVector3f(0.0f, 1.0f, 1.0f)},
+          {0, 1, 2, 3, 4, 5});
+
+      std::optional<CesiumTriangleBvh::Hit> maybeHit = bvh.lineTrace(
+          FVector3f(0.25f, 0.25f, 2.0f),
+          FVector3f(0.25f, 0.25f, -2.0f));
+      if (!TestTrue("hit", maybeHit.has_value())) {
+        return;
+      }
+
+      TestEqual("faceIndex", maybeHit->faceIndex, 1);
+      TestNearlyEqual("time", maybeHit->time, 0.25f);
+    });
+
+    It("misses when the segment ends before the surface", [this]() {
+      CesiumTriangleBvh bvh = CreateGrid(4);
+      TestFalse(
+          "hit",
+          bvh.lineTrace(
+                 FVector3f(1.5f, 1.5f, 10.0f),
+                 FVector3f(1.5f, 1.5f, 1.0f))
+              .has_value());
+    });
+
+    It("misses when the segment passes outside the triangles", [this]() {
+      CesiumTriangleBvh bvh = CreateGrid(4);
+      TestFalse(
+          "hit",
+          bvh.lineTrace(
+                 FVector3f(5.0f, 1.5f, 10.0f),
+                 FVector3f(5.0f, 1.5f, -10.0f))
+              .has_value());
+    });
+
+    It("reports barycentric coordinates", [this]() {
+      CesiumTriangleBvh bvh(
+          {FVector3f(0.0f, 0.0f, 0.0f),
+           FVector3f(1.0f, 0.0f, 0.0f),
+           FVector3f(0.0f, 1.0f, 0.0f)},
+          {0, 1, 2});
+
+      std::optional<CesiumTriangleBvh::Hit> maybeHit = bvh.lineTrace(
+          FVector3f(0.25f, 0.5f, 1.0f),
+          FVector3f(0.25f, 0.5f, -1.0f));
+      if (!TestTrue("hit", maybeHit.has_value())) {
+        return;
+      }
+
+      TestNearlyEqual("u", maybeHit->barycentric.X, 0.25f);
+      TestNearlyEqual("v", maybeHit->barycentric.Y, 0.5f);
+    });
+  });
+}
@@ -0,0 +1,154 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "EncodedFeaturesMetadata.h"
+#include "CesiumFeaturesMetadataDescription.h"
+#include "CesiumGltf/ExtensionModelExtStructuralMetadata.h"
+#include "CesiumGltf/Model.h"
+#include "CesiumGltfSpecUtility.h"
+#include "CesiumPropertyTable.h"
+#include "CesiumTextureCache.h"
+#include "Misc/AutomationTest.h"
+#include "RenderingThread.h"
+
+BEGIN_DEFINE_SPEC(
+    FEncodedFeaturesMetadataSpec,
+    "Cesium.Unit.EncodedFeaturesMetadata",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ProductFilter | EAutomationTestFlags::NonNullRHI)
+
+const std::string PropertyName = "testProperty";
+
+CesiumGltf::Model
+CreateModel(const std::vector<int32_t>& Values, int64_t Count) {
+  CesiumGltf::Model model;
+  CesiumGltf::ExtensionModelExtStructuralMetadata& extension =
+      model.addExtension<CesiumGltf::ExtensionModelExtStructuralMetadata>();
+  extension.schema.emplace();
+  CesiumGltf::PropertyTable& propertyTable =
+      extension.propertyTables.emplace_back();
+  propertyTable.classProperty = "testClass";
+  propertyTable.count = Count;
+  AddPropertyTablePropertyToModel(
+      model,
+      propertyTable,
+      PropertyName,
+      CesiumGltf::ClassProperty::Type::SCALAR,
+      CesiumGltf::ClassProperty::ComponentType::INT32,
+      Values);
+  return model;
+}
+
+EncodedFeaturesMetadata::EncodedPropertyTable Encode(
+    const CesiumGltf::Model& Model,
+    ECesiumEncodedMetadataComponentType ComponentType =
+        ECesiumEncodedMetadataComponentType::Float) {
+  FCesiumPropertyTableDescription description;
+  FCesiumPropertyTablePropertyDescription& property =
+      description.Properties.Emplace_GetRef();
+  property.Name = FString(PropertyName.c_str());
+  property.PropertyDetails = FCesiumMetadataPropertyDetails(
+      ECesiumMetadataType::Scalar,
+      ECesiumMetadataComponentType::Int32,
+      false);
+  property.EncodingDetails = FCesiumMetadataEncodingDetails(
+      ECesiumEncodedMetadataType::Scalar,
+      ComponentType,
+      ECesiumEncodedMetadataConversion::Coerce);
+
+  const CesiumGltf::ExtensionModelExtStructuralMetadata* pExtension =
+      Model.getExtension<CesiumGltf::ExtensionModelExtStructuralMetadata>();
+  FCesiumPropertyTable propertyTable(Model, pExtension->propertyTables[0]);
+  return EncodedFeaturesMetadata::encodePropertyTableAnyThreadPart(
+      description,
+      propertyTable);
+}
+
+bool HasTexture(const EncodedFeaturesMetadata::EncodedPropertyTable& Encoded) {
+  return Encoded.properties.Num() == 1 &&
+         Encoded.properties[0].pTexture != nullptr;
+}
+
+END_DEFINE_SPEC(FEncodedFeaturesMetadataSpec)
+
+void FEncodedFeaturesMetadataSpec::Define() {
+  AfterEach([this]() { FlushRenderingCommands(); });
+
+  Describe("encodePropertyTableAnyThreadPart", [this]() {
+    It("shares the texture of identical properties", [this]() {
+      const std::vector<int32_t> values{1001, 1002, 1003, 1004};
+      CesiumGltf::Model first = CreateModel(values, 4);
+      CesiumGltf::Model second = CreateModel(values, 4);
+
+      const int32 keysBefore = CesiumTextureCache::getSourceKeyCount();
+      const int32 texturesBefore = CesiumTextureCache::getTextureCount();
+
+      EncodedFeaturesMetadata::EncodedPropertyTable encodedFirst =
+          Encode(first);
+      EncodedFeaturesMetadata::EncodedPropertyTable encodedSecond =
+          Encode(second);
+      TestTrue("first texture", HasTexture(encodedFirst));
+      TestTrue("second texture", HasTexture(encodedSecond));
+      TestEqual(
+          "one source key",
+          CesiumTextureCache::getSourceKeyCount(),
+          keysBefore + 1);
+      TestEqual(
+          "one texture",
+          CesiumTextureCache::getTextureCount(),
+          texturesBefore + 1);
+    });
+
+    It("encodes other encoding details and feature counts apart", [this]() {
+      const std::vector<int32_t> values{2001, 2002, 2003, 2004};
+      CesiumGltf::Model model = CreateModel(values, 4);
+      // This reads the same buffer, but only for the first three features.
+      CesiumGltf::Model fewerFeatures = CreateModel(values, 3);
+
+      const int32 keysBefore = CesiumTextureCache::getSourceKeyCount();
+
+      EncodedFeaturesMetadata::EncodedPropertyTable encoded = Encode(model);
+      EncodedFeaturesMetadata::EncodedPropertyTable encodedAsBytes =
+          Encode(model, ECesiumEncodedMetadataComponentType::Uint8);
+      EncodedFeaturesMetadata::EncodedPropertyTable encodedFewerFeatures =
+          Encode(fewerFeatures);
+      TestTrue("texture", HasTexture(encoded));
+      TestTrue("texture as bytes", HasTexture(encodedAsBytes));
+      TestTrue("texture for fewer features", HasTexture(encodedFewerFeatures));
+      TestEqual(
+          "three source keys",
+          CesiumTextureCache::getSourceKeyCount(),
+          keysBefore + 3);
+    });
+
+    It("releases the texture with the last tile that uses it", [this]() {
+      const std::vector<int32_t> values{3001, 3002, 3003, 3004};
+      CesiumGltf::Model first = CreateModel(values, 4);
+      CesiumGltf::Model second = CreateModel(values, 4);
+
+      const int32 keysBefore = CesiumTextureCache::getSourceKeyCount();
+
+      TUniquePtr<EncodedFeaturesMetadata::EncodedPropertyTable> pFirst =
+          MakeUnique<EncodedFeaturesMetadata::EncodedPropertyTable>(
+              Encode(first));
+      TUniquePtr<EncodedFeaturesMetadata::EncodedPropertyTable> pSecond =
+          MakeUnique<EncodedFeaturesMetadata::EncodedPropertyTable>(
+              Encode(second));
+
+      // The render commands that initialize and release the resources hold
+      // references to them until they run.
+      pFirst.Reset();
+      FlushRenderingCommands();
+      TestEqual(
+          "kept while used",
+          CesiumTextureCache::getSourceKeyCount(),
+          keysBefore + 1);
+
+      pSecond.Reset();
+      FlushRenderingCommands();
+      TestEqual(
+          "removed",
+          CesiumTextureCache::getSourceKeyCount(),
+          keysBefore);
+    });
+  });
+}
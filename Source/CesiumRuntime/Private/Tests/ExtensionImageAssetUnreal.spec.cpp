@@ -0,0 +1,109 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#include "Async/ParallelFor.h"
+#include "ExtensionImageAssetUnreal.h"
+#include "Misc/AutomationTest.h"
+#include "RenderingThread.h"
+#include <CesiumAsync/AsyncSystem.h>
+#include <CesiumGltf/ImageAsset.h>
+#include <vector>
+
+BEGIN_DEFINE_SPEC(
+    FExtensionImageAssetUnrealSpec,
+    "Cesium.Unit.ExtensionImageAssetUnreal",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext |
+        EAutomationTestFlags::ProductFilter | EAutomationTestFlags::NonNullRHI)
+
+std::vector<CesiumGltf::ImageAsset> images;
+
+void CreateImages(int32 Count) {
+  images.clear();
+  images.resize(size_t(Count));
+  for (int32 i = 0; i < Count; ++i) {
+    // Each image has its own pixels, so that none of them share a texture
+    // through the texture cache.
+    CesiumGltf::ImageAsset& image = images[size_t(i)];
+    image.width = 4;
+    image.height = 4;
+    image.channels = 4;
+    image.bytesPerChannel = 1;
+    image.pixelData.resize(4 * 4 * 4);
+    for (size_t j = 0; j < image.pixelData.size(); ++j) {
+      image.pixelData[j] = std::byte(uint8(j * 7 + i * 13 + 101));
+    }
+  }
+}
+
+const ExtensionImageAssetUnreal& GetOrCreate(CesiumGltf::ImageAsset& Image) {
+  return ExtensionImageAssetUnreal::getOrCreate(
+      CesiumAsync::AsyncSystem(nullptr),
+      Image,
+      true,
+      false,
+      std::nullopt,
+      ECesiumTextureCompression::None,
+      false);
+}
+
+END_DEFINE_SPEC(FExtensionImageAssetUnrealSpec)
+
+void FExtensionImageAssetUnrealSpec::Define() {
+  AfterEach([this]() {
+    images.clear();
+    FlushRenderingCommands();
+  });
+
+  It("creates one extension per image when many threads race", [this]() {
+    constexpr int32 imageCount = 32;
+    constexpr int32 callsPerImage = 64;
+    CreateImages(imageCount);
+
+    // Every call asks for the image at the given index, so each image is
+    // requested by many threads at once.
+    TArray<const ExtensionImageAssetUnreal*> results;
+    results.SetNumZeroed(imageCount * callsPerImage);
+    ParallelFor(results.Num(), [this, &results](int32 i) {
+      results[i] = &GetOrCreate(images[size_t(i % imageCount)]);
+    });
+
+    for (int32 image = 0; image < imageCount; ++image) {
+      const ExtensionImageAssetUnreal* pExtension =
+          images[size_t(image)].getExtension<ExtensionImageAssetUnreal>();
+      if (!TestNotNull("extension", pExtension)) {
+        return;
+      }
+      TestNotNull("resource", pExtension->getTextureResource().Get());
+
+      for (int32 call = 0; call < callsPerImage; ++call) {
+        const int32 i = call * imageCount + image;
+        if (results[i] != pExtension) {
+          AddError(FString::Printf(
+              TEXT("Call %d for image %d got another extension"),
+              call,
+              image));
+          return;
+        }
+      }
+    }
+  });
+
+  It("gives each image its own texture resource", [this]() {
+    CreateImages(8);
+    ParallelFor(int32(images.size()), [this](int32 i) {
+      GetOrCreate(images[size_t(i)]);
+    });
+
+    for (size_t i = 1; i < images.size(); ++i) {
+      TestNotEqual(
+          "resource",
+          images[i]
+              .getExtension<ExtensionImageAssetUnreal>()
+              ->getTextureResource()
+              .Get(),
+          images[i - 1]
+              .getExtension<ExtensionImageAssetUnreal>()
+              ->getTextureResource()
+              .Get());
+    }
+  });
+}
@@ -5,8 +5,14 @@
 #include "Cesium3DTilesetLifecycleEventReceiver.h"
 #include "CesiumGltfComponent.h"
 #include "CesiumLifetime.h"
+#include "CesiumMipMapGenerator.h"
+#include "CesiumNaniteBuilder.h"
 #include "CesiumRasterOverlay.h"
+#include "CesiumRasterOverlayAtlas.h"
 #include "CesiumRuntime.h"
+#include "CesiumStats.h"
+#include "CesiumTextureCompressor.h"
+#include "CesiumTileObjectPool.h"
 #include "CreateGltfOptions.h"
 #include "ExtensionImageAssetUnreal.h"
 #include <Cesium3DTilesSelection/Tile.h>
@@ -15,9 +21,168 @@
 #include <CesiumGeospatial/Ellipsoid.h>
 #include <glm/mat4x4.hpp>
 
+DECLARE_MEMORY_STAT(
+    TEXT("Tile Vertex Buffers"),
+    STAT_CesiumVertexBufferMemory,
+    STATGROUP_Cesium);
+DECLARE_MEMORY_STAT(
+    TEXT("Tile Index Buffers"),
+    STAT_CesiumIndexBufferMemory,
+    STATGROUP_Cesium);
+DECLARE_MEMORY_STAT(
+    TEXT("Tile Mesh CPU Copies"),
+    STAT_CesiumMeshCpuCopyMemory,
+    STATGROUP_Cesium);
+DECLARE_MEMORY_STAT(
+    TEXT("Tile Textures"),
+    STAT_CesiumTextureMemory,
+    STATGROUP_Cesium);
+DECLARE_MEMORY_STAT(
+    TEXT("Tile Encoded Metadata Textures"),
+    STAT_CesiumEncodedMetadataTextureMemory,
+    STATGROUP_Cesium);
+DECLARE_MEMORY_STAT(
+    TEXT("Tile Collision Meshes"),
+    STAT_CesiumCollisionMeshMemory,
+    STATGROUP_Cesium);
+DECLARE_MEMORY_STAT(
+    TEXT("Tile glTF CPU Data"),
+    STAT_CesiumGltfCpuMemory,
+    STATGROUP_Cesium);
+DECLARE_MEMORY_STAT(
+    TEXT("Tile Raster Overlay Composites"),
+    STAT_CesiumRasterOverlayCompositeMemory,
+    STATGROUP_Cesium);
+
+namespace {
+void addTileMemoryStatistics(
+    FCesium3DTilesetMemoryStatistics& tilesetStatistics,
+    const FCesium3DTilesetMemoryStatistics& tileStatistics) {
+  tilesetStatistics += tileStatistics;
+  INC_MEMORY_STAT_BY(
+      STAT_CesiumVertexBufferMemory,
+      tileStatistics.VertexBufferBytes);
+  INC_MEMORY_STAT_BY(
+      STAT_CesiumIndexBufferMemory,
+      tileStatistics.IndexBufferBytes);
+  INC_MEMORY_STAT_BY(
+      STAT_CesiumMeshCpuCopyMemory,
+      tileStatistics.MeshCpuCopyBytes);
+  INC_MEMORY_STAT_BY(STAT_CesiumTextureMemory, tileStatistics.TextureBytes);
+  INC_MEMORY_STAT_BY(
+      STAT_CesiumEncodedMetadataTextureMemory,
+      tileStatistics.EncodedMetadataTextureBytes);
+  INC_MEMORY_STAT_BY(
+      STAT_CesiumCollisionMeshMemory,
+      tileStatistics.CollisionMeshBytes);
+  INC_MEMORY_STAT_BY(STAT_CesiumGltfCpuMemory, tileStatistics.GltfCpuBytes);
+  INC_MEMORY_STAT_BY(
+      STAT_CesiumRasterOverlayCompositeMemory,
+      tileStatistics.RasterOverlayCompositeBytes);
+}
+
+void removeTileMemoryStatistics(
+    FCesium3DTilesetMemoryStatistics& tilesetStatistics,
+    const FCesium3DTilesetMemoryStatistics& tileStatistics) {
+  tilesetStatistics -= tileStatistics;
+  DEC_MEMORY_STAT_BY(
+      STAT_CesiumVertexBufferMemory,
+      tileStatistics.VertexBufferBytes);
+  DEC_MEMORY_STAT_BY(
+      STAT_CesiumIndexBufferMemory,
+      tileStatistics.IndexBufferBytes);
+  DEC_MEMORY_STAT_BY(
+      STAT_CesiumMeshCpuCopyMemory,
+      tileStatistics.MeshCpuCopyBytes);
+  DEC_MEMORY_STAT_BY(STAT_CesiumTextureMemory, tileStatistics.TextureBytes);
+  DEC_MEMORY_STAT_BY(
+      STAT_CesiumEncodedMetadataTextureMemory,
+      tileStatistics.EncodedMetadataTextureBytes);
+  DEC_MEMORY_STAT_BY(
+      STAT_CesiumCollisionMeshMemory,
+      tileStatistics.CollisionMeshBytes);
+  DEC_MEMORY_STAT_BY(STAT_CesiumGltfCpuMemory, tileStatistics.GltfCpuBytes);
+  DEC_MEMORY_STAT_BY(
+      STAT_CesiumRasterOverlayCompositeMemory,
+      tileStatistics.RasterOverlayCompositeBytes);
+}
+
+// The result of preparing a raster overlay tile for a tileset that packs its
+// overlays into a CesiumRasterOverlayAtlas, in both the load thread and the
+// main thread. Images that don't fit in the atlas get their own textures, as
+// they do without an atlas.
+struct AtlasedRasterTile {
+  // Set in the load thread, for an image that will be added to the atlas.
+  std::optional<CesiumRasterOverlayAtlas::Image> image;
+
+  // Set in the load thread, for an image that gets its own texture.
+  TUniquePtr<CesiumTextureUtility::LoadedTextureResult> pLoadedTexture;
+
+  // Set in the main thread, from one of the above.
+  int32 atlasHandle = INDEX_NONE;
+  CesiumUtility::IntrusivePointer<
+      CesiumTextureUtility::ReferenceCountedUnrealTexture>
+      pTexture;
+};
+
+// Gets the texture of a raster overlay tile that isn't in an atlas.
+UTexture2D* getRasterTexture(
+    void* pMainThreadResult,
+    const AtlasedRasterTile* pAtlased) {
+  if (pAtlased) {
+    return pAtlased->pTexture->getUnrealTexture();
+  }
+  return static_cast<CesiumTextureUtility::ReferenceCountedUnrealTexture*>(
+             pMainThreadResult)
+      ->getUnrealTexture();
+}
+
+TUniquePtr<CesiumTextureUtility::LoadedTextureResult> loadRasterTexture(
+    CesiumGltf::ImageAsset& image,
+    const FRasterOverlayRendererOptions& options,
+    bool sRGB) {
+  const ExtensionImageAssetUnreal& extension =
+      ExtensionImageAssetUnreal::getOrCreate(
+          CesiumAsync::AsyncSystem(nullptr), // TODO
+          image,
+          sRGB,
+          options.useMipmaps,
+          std::nullopt,
+          options.compression,
+          false);
+
+  // Because raster overlay images are never shared (at least currently!), the
+  // texture resource was created by the call above. Its upload may still be in
+  // flight, but the texture wrapping it isn't initialized until it's done.
+  check(
+      extension.getFuture().isReady() ||
+      extension.getTextureResource() != nullptr);
+
+  return CesiumTextureUtility::loadTextureAnyThreadPart(
+      image,
+      TextureAddress::TA_Clamp,
+      TextureAddress::TA_Clamp,
+      options.filter,
+      options.useMipmaps,
+      options.group,
+      sRGB,
+      std::nullopt);
+}
+} // namespace
+
 UnrealPrepareRendererResources::UnrealPrepareRendererResources(
     ACesium3DTileset* pActor)
-    : _pActor(pActor) {}
+    : _pActor(pActor),
+      _pRasterOverlayAtlas(pActor->getRasterOverlayAtlas()) {}
+
+/*static*/ void UnrealPrepareRendererResources::updateTileMemoryStatistics(
+    ACesium3DTileset& tileset,
+    FCesium3DTilesetMemoryStatistics& tileStatistics,
+    const FCesium3DTilesetMemoryStatistics& newTileStatistics) {
+  removeTileMemoryStatistics(tileset._memoryStatistics, tileStatistics);
+  tileStatistics = newTileStatistics;
+  addTileMemoryStatistics(tileset._memoryStatistics, tileStatistics);
+}
 
 CesiumAsync::Future<Cesium3DTilesSelection::TileLoadResultAndRenderResources>
 UnrealPrepareRendererResources::prepareInLoadThread(
@@ -35,8 +200,16 @@ UnrealPrepareRendererResources::prepareInLoadThread(
 
   options.alwaysIncludeTangents = this->_pActor->GetAlwaysIncludeTangents();
   options.createPhysicsMeshes = this->_pActor->GetCreatePhysicsMeshes();
+  options.createPickingBvhs = this->_pActor->GetCreatePickingBvhs();
 
   options.ignoreKhrMaterialsUnlit = this->_pActor->GetIgnoreKhrMaterialsUnlit();
+  options.buildNanite = this->_pActor->GetEnableNanite() &&
+                        CesiumNaniteBuilder::isNaniteBuildAvailable();
+  options.sortPointsProgressively =
+      this->_pActor->GetPointCloudShading().Decimation;
+  options.textureCompression = this->_pActor->GetTextureCompression();
+  options.streamTextureMips = this->_pActor->GetStreamTextureMips();
+  options.keepMeshDataOnCpu = this->_pActor->GetEvictHiddenTileGpuResources();
 
   if (this->_pActor->_featuresMetadataDescription) {
     options.pFeaturesMetadataDescription =
@@ -75,7 +248,7 @@ void* UnrealPrepareRendererResources::prepareInMainThread(
             pLoadThreadResult));
     Cesium3DTilesSelection::TileRenderContent& renderContent =
         *content.getRenderContent();
-    return UCesiumGltfComponent::CreateOnGameThread(
+    UCesiumGltfComponent* pGltf = UCesiumGltfComponent::CreateOnGameThread(
         renderContent.getModel(),
         this->_pActor,
         std::move(pHalf),
@@ -86,6 +259,13 @@ void* UnrealPrepareRendererResources::prepareInMainThread(
         this->_pActor->GetCustomDepthParameters(),
         tile,
         this->_pActor->GetCreateNavCollision());
+    if (pGltf) {
+      addTileMemoryStatistics(
+          this->_pActor->_memoryStatistics,
+          pGltf->MemoryStatistics);
+      this->_pActor->registerSharedTextures(pGltf->SharedTextures);
+    }
+    return pGltf;
   }
   // UE_LOG(LogCesium, VeryVerbose, TEXT("No content for tile"));
   return nullptr;
@@ -107,6 +287,15 @@ void UnrealPrepareRendererResources::free(
             this->_pActor->GetLifecycleEventReceiver()) {
       Receiver->OnTileUnloading(*pGltf);
     }
+    removeTileMemoryStatistics(
+        this->_pActor->_memoryStatistics,
+        pGltf->MemoryStatistics);
+    this->_pActor->unregisterSharedTextures(pGltf->SharedTextures);
+    pGltf->SharedTextures.Empty();
+    if (CesiumTileObjectPool* pPool = this->_pActor->getTileObjectPool()) {
+      // A lifecycle event receiver may create its own kind of materials.
+      pPool->recycle(*pGltf, !this->_pActor->GetLifecycleEventReceiver());
+    }
     CesiumLifetime::destroyComponentRecursively(pGltf);
   }
 }
@@ -123,9 +312,33 @@ void* UnrealPrepareRendererResources::prepareRasterInLoadThread(
 
   auto pOptions = *ppOptions;
 
+  // Channels are removed before anything else is done with the image, so that
+  // the mipmaps are generated from less data, too.
+  switch (pOptions->channels) {
+  case ECesiumRasterOverlayChannels::RG:
+    CesiumTextureUtility::reduceImageChannels(image, 2);
+    break;
+  case ECesiumRasterOverlayChannels::R:
+    CesiumTextureUtility::reduceImageChannels(image, 1);
+    break;
+  case ECesiumRasterOverlayChannels::RGBA:
+  default:
+    break;
+  }
+
+  // There are no sRGB formats with fewer than three channels.
+  const bool sRGB = pOptions->sRGB && image.channels >= 3;
+
+  // The padding of an atlased tile must be in its mipmaps, too.
+  std::optional<CesiumRasterOverlayAtlas::Content> atlasContent;
+  if (this->_pRasterOverlayAtlas) {
+    atlasContent =
+        CesiumRasterOverlayAtlas::padImage(image, pOptions->useMipmaps);
+  }
+
   if (pOptions->useMipmaps) {
     std::optional<std::string> errorMessage =
-        CesiumGltfReader::ImageDecoder::generateMipMaps(image);
+        CesiumMipMapGenerator::generateMipMaps(image, sRGB);
     if (errorMessage) {
       UE_LOG(
           LogCesium,
@@ -135,37 +348,61 @@ void* UnrealPrepareRendererResources::prepareRasterInLoadThread(
     }
   }
 
-  // TODO: sRGB should probably be configurable on the raster overlay.
-  bool sRGB = true;
+  if (this->_pRasterOverlayAtlas) {
+    // The image is copied into the atlas as-is, so it's compressed here rather
+    // than when its texture is created.
+    CesiumTextureCompressor::compressImageForCurrentRHI(
+        image,
+        pOptions->compression);
 
-  const ExtensionImageAssetUnreal& extension =
-      ExtensionImageAssetUnreal::getOrCreate(
-          CesiumAsync::AsyncSystem(nullptr), // TODO
+    TUniquePtr<AtlasedRasterTile> pResult = MakeUnique<AtlasedRasterTile>();
+    std::optional<EPixelFormat> maybePixelFormat =
+        CesiumTextureUtility::getPixelFormatForImageAsset(image, std::nullopt);
+    if (atlasContent && maybePixelFormat) {
+      pResult->image = CesiumRasterOverlayAtlas::takeImage(
           image,
+          *atlasContent,
+          *maybePixelFormat,
           sRGB,
           pOptions->useMipmaps,
-          std::nullopt);
-
-  // Because raster overlay images are never shared (at least currently!), the
-  // future should already be resolved by the time we get here.
-  check(extension.getFuture().isReady());
-
-  auto texture = CesiumTextureUtility::loadTextureAnyThreadPart(
-      image,
-      TextureAddress::TA_Clamp,
-      TextureAddress::TA_Clamp,
-      pOptions->filter,
-      pOptions->useMipmaps,
-      pOptions->group,
-      sRGB,
-      std::nullopt);
+          pOptions->filter,
+          pOptions->group);
+    }
+    if (!pResult->image) {
+      pResult->pLoadedTexture = loadRasterTexture(image, *pOptions, sRGB);
+    }
+    return pResult.Release();
+  }
 
-  return texture.Release();
+  return loadRasterTexture(image, *pOptions, sRGB).Release();
 }
 
 void* UnrealPrepareRendererResources::prepareRasterInMainThread(
     CesiumRasterOverlays::RasterOverlayTile& rasterTile,
     void* pLoadThreadResult) {
+  if (this->_pRasterOverlayAtlas) {
+    TUniquePtr<AtlasedRasterTile> pResult{
+        static_cast<AtlasedRasterTile*>(pLoadThreadResult)};
+    if (!pResult) {
+      return nullptr;
+    }
+
+    if (pResult->image) {
+      pResult->atlasHandle =
+          this->_pRasterOverlayAtlas->add(MoveTemp(*pResult->image));
+      pResult->image.reset();
+    } else if (pResult->pLoadedTexture) {
+      pResult->pTexture = CesiumTextureUtility::loadTextureGameThreadPart(
+          pResult->pLoadedTexture.Get());
+      pResult->pLoadedTexture.Reset();
+    }
+
+    if (pResult->atlasHandle == INDEX_NONE && !pResult->pTexture) {
+      return nullptr;
+    }
+    return pResult.Release();
+  }
+
   TUniquePtr<CesiumTextureUtility::LoadedTextureResult> pLoadedTexture{
       static_cast<CesiumTextureUtility::LoadedTextureResult*>(
           pLoadThreadResult)};
@@ -192,6 +429,17 @@ void UnrealPrepareRendererResources::freeRaster(
     const CesiumRasterOverlays::RasterOverlayTile& rasterTile,
     void* pLoadThreadResult,
     void* pMainThreadResult) noexcept {
+  if (this->_pRasterOverlayAtlas) {
+    // The same type is used for both results.
+    AtlasedRasterTile* pResult = static_cast<AtlasedRasterTile*>(
+        pLoadThreadResult ? pLoadThreadResult : pMainThreadResult);
+    if (pResult && pResult->atlasHandle != INDEX_NONE) {
+      this->_pRasterOverlayAtlas->remove(pResult->atlasHandle);
+    }
+    delete pResult;
+    return;
+  }
+
   if (pLoadThreadResult) {
     CesiumTextureUtility::LoadedTextureResult* pLoadedTexture =
         static_cast<CesiumTextureUtility::LoadedTextureResult*>(
@@ -222,15 +470,30 @@ void UnrealPrepareRendererResources::attachRasterInMainThread(
         reinterpret_cast<UCesiumGltfComponent*>(
             pRenderContent->getRenderResources());
     if (pGltfContent) {
-      pGltfContent->AttachRasterTile(
-          tile,
-          rasterTile,
-          static_cast<CesiumTextureUtility::ReferenceCountedUnrealTexture*>(
-              pMainThreadRendererResources)
-              ->getUnrealTexture(),
-          translation,
-          scale,
-          overlayTextureCoordinateID);
+      const AtlasedRasterTile* pAtlased =
+          this->_pRasterOverlayAtlas
+              ? static_cast<const AtlasedRasterTile*>(
+                    pMainThreadRendererResources)
+              : nullptr;
+      if (pAtlased && pAtlased->atlasHandle != INDEX_NONE) {
+        this->_pRasterOverlayAtlas->attach(
+            pAtlased->atlasHandle,
+            *pGltfContent,
+            tile,
+            rasterTile,
+            translation,
+            scale,
+            overlayTextureCoordinateID);
+      } else {
+        pGltfContent->AttachRasterTile(
+            tile,
+            rasterTile,
+            getRasterTexture(pMainThreadRendererResources, pAtlased),
+            translation,
+            scale,
+            overlayTextureCoordinateID);
+      }
+      this->_pActor->scheduleRasterTileUpdates(*pGltfContent);
     }
   }
 }
@@ -248,12 +511,24 @@ void UnrealPrepareRendererResources::detachRasterInMainThread(
         reinterpret_cast<UCesiumGltfComponent*>(
             pRenderContent->getRenderResources());
     if (pMainThreadRendererResources != nullptr && pGltfContent != nullptr) {
-      pGltfContent->DetachRasterTile(
-          tile,
-          rasterTile,
-          static_cast<CesiumTextureUtility::ReferenceCountedUnrealTexture*>(
-              pMainThreadRendererResources)
-              ->getUnrealTexture());
+      const AtlasedRasterTile* pAtlased =
+          this->_pRasterOverlayAtlas
+              ? static_cast<const AtlasedRasterTile*>(
+                    pMainThreadRendererResources)
+              : nullptr;
+      if (pAtlased && pAtlased->atlasHandle != INDEX_NONE) {
+        this->_pRasterOverlayAtlas->detach(
+            pAtlased->atlasHandle,
+            *pGltfContent,
+            tile,
+            rasterTile);
+      } else {
+        pGltfContent->DetachRasterTile(
+            tile,
+            rasterTile,
+            getRasterTexture(pMainThreadRendererResources, pAtlased));
+      }
+      this->_pActor->scheduleRasterTileUpdates(*pGltfContent);
     }
   }
 }
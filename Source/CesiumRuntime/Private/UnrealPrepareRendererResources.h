@@ -1,8 +1,11 @@
 #pragma once
 
+#include "Templates/SharedPointer.h"
 #include <Cesium3DTilesSelection/IPrepareRendererResources.h>
 
 class ACesium3DTileset;
+class CesiumRasterOverlayAtlas;
+struct FCesium3DTilesetMemoryStatistics;
 
 /**
  * An implementation of Cesium Native's IPrepareRendererResources that creates
@@ -57,6 +60,26 @@ public:
       const CesiumRasterOverlays::RasterOverlayTile& rasterTile,
       void* pMainThreadRendererResources) noexcept override;
 
+  /**
+   * Replaces the memory statistics of a loaded tile whose resources changed
+   * size after it was created, and updates the totals of its tileset to
+   * match.
+   *
+   * @param tileset The tileset that the tile belongs to.
+   * @param tileStatistics The tile's statistics, which are counted in the
+   * tileset's totals.
+   * @param newTileStatistics The statistics to replace them with.
+   */
+  static void updateTileMemoryStatistics(
+      ACesium3DTileset& tileset,
+      FCesium3DTilesetMemoryStatistics& tileStatistics,
+      const FCesium3DTilesetMemoryStatistics& newTileStatistics);
+
 private:
   ACesium3DTileset* _pActor;
+
+  // The atlas that raster overlay tiles are packed into, if the tileset has
+  // one. This keeps it alive until the last overlay tile is freed, which may
+  // be after the tileset is destroyed.
+  TSharedPtr<CesiumRasterOverlayAtlas> _pRasterOverlayAtlas;
 };
@@ -6,6 +6,7 @@
 #include "Cesium3DTilesSelection/ViewState.h"
 #include "Cesium3DTilesSelection/ViewUpdateResult.h"
 #include "Cesium3DTilesetLoadFailureDetails.h"
+#include "Cesium3DTilesetMemoryStatistics.h"
 #include "CesiumCreditSystem.h"
 #include "CesiumEncodedMetadataComponent.h"
 #include "CesiumFeaturesMetadataComponent.h"
@@ -13,6 +14,7 @@
 #include "CesiumIonServer.h"
 #include "CesiumPointCloudShading.h"
 #include "CesiumSampleHeightResult.h"
+#include "CesiumTextureCompression.h"
 #include "CoreMinimal.h"
 #include "CustomDepthParameters.h"
 #include "Engine/EngineTypes.h"
@@ -39,6 +41,13 @@ class UCesiumBoundingVolumePoolComponent;
 class CesiumViewExtension;
 struct FCesiumCamera;
 class ICesium3DTilesetLifecycleEventReceiver;
+class CesiumMaterialInstanceCache;
+class CesiumRasterOverlayAtlas;
+class CesiumRasterOverlayParameterNameCache;
+class CesiumTileObjectPool;
+class FCesiumStreamedTextureResource;
+class FCesiumTextureResource;
+class UCesiumGltfComponent;
 
 namespace Cesium3DTilesSelection {
 class Tileset;
@@ -140,6 +149,56 @@ public:
       const TArray<FVector>& LongitudeLatitudeHeightArray,
       FCesiumSampleHeightMostDetailedCallback OnHeightsSampled);
 
+  /**
+   * @brief Finds the closest intersection of a line segment with the visible
+   * triangles of this tileset, without using physics.
+   *
+   * Only primitives loaded while CreatePickingBvhs is enabled can be hit. The
+   * resulting hit includes the primitive component and face index, so it can
+   * be passed to functions like FindUVFromHit and GetPropertyTableValuesFromHit
+   * even when CreatePhysicsMeshes is disabled.
+   *
+   * @param Start The start of the segment in Unreal world coordinates.
+   * @param End The end of the segment in Unreal world coordinates.
+   * @param OutHit The closest hit, if any.
+   * @return True if the segment hit the tileset.
+   */
+  UFUNCTION(BlueprintCallable, Category = "Cesium|Picking")
+  bool LineTraceTileset(
+      const FVector& Start,
+      const FVector& End,
+      FHitResult& OutHit) const;
+
+  /**
+   * @brief Finds the closest intersection of a line segment with the visible
+   * triangles of this tileset, without using physics, and gets the texture
+   * coordinates and feature ID at that location.
+   *
+   * This requires CreatePickingBvhs, as with LineTraceTileset.
+   *
+   * @param Start The start of the segment in Unreal world coordinates.
+   * @param End The end of the segment in Unreal world coordinates.
+   * @param OutHit The closest hit, if any.
+   * @param OutUV The texture coordinates at the hit, or zero if the primitive
+   * doesn't have the texture coordinate set.
+   * @param OutFeatureID The feature ID at the hit, or -1 if the primitive
+   * doesn't have the feature ID set.
+   * @param FeatureIDSetIndex The index of the feature ID set in the primitive's
+   * EXT_mesh_features extension.
+   * @param GltfTexCoordSetIndex The glTF texture coordinate set from which to
+   * compute OutUV. The set index N resolves to the "TEXCOORD_N" attribute.
+   * @return True if the segment hit the tileset.
+   */
+  UFUNCTION(BlueprintCallable, Category = "Cesium|Picking")
+  bool PickFeature(
+      const FVector& Start,
+      const FVector& End,
+      FHitResult& OutHit,
+      FVector2D& OutUV,
+      int64& OutFeatureID,
+      int64 FeatureIDSetIndex = 0,
+      int64 GltfTexCoordSetIndex = 0) const;
+
 private:
   /**
    * The designated georeference actor controlling how the actor's
@@ -407,6 +466,30 @@ public:
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cesium|Tile Loading")
   bool ForbidHoles = false;
 
+  /**
+   * Whether to reuse the static meshes and dynamic material instances of
+   * unloaded tiles for newly-loaded tiles.
+   *
+   * Pooling these objects reduces the cost of creating them and the garbage
+   * collection work caused by destroying them, which is most noticeable while
+   * the camera is moving quickly. Material instances are not pooled when a
+   * lifecycle event receiver is registered, because it may create its own.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cesium|Tile Loading")
+  bool EnableTileObjectPooling = false;
+
+  /**
+   * The maximum number of static meshes, and separately the maximum number of
+   * dynamic material instances, that may be pooled for reuse when
+   * EnableTileObjectPooling is true.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadWrite,
+      Category = "Cesium|Tile Loading",
+      meta = (EditCondition = "EnableTileObjectPooling", ClampMin = 0))
+  int32 MaximumPooledObjects = 256;
+
   /**
    * The maximum number of tiles that may be loaded at once.
    *
@@ -431,10 +514,64 @@ public:
    * total number of loaded bytes is greater than this value, tiles will be
    * unloaded until the total is under this number or until only required tiles
    * remain, whichever comes first.
+   *
+   * The memory used by Unreal-side tile resources, such as vertex and index
+   * buffers and their CPU copies, collision meshes, encoded metadata
+   * textures, and raster overlay composites, counts toward this limit. See
+   * {@link GetMemoryStatistics}.
    */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cesium|Tile Loading")
   int64 MaximumCachedBytes = 256 * 1024 * 1024;
 
+  /**
+   * Whether to release the GPU vertex and index buffers of tiles that stay
+   * hidden while they are in the tile cache, so that a large
+   * MaximumCachedBytes doesn't also take a large amount of video memory.
+   *
+   * When enabled, a CPU copy of each tile's vertex and index buffers is kept
+   * after they are uploaded. These copies count toward MaximumCachedBytes,
+   * and are reported as MeshCpuCopyBytes in the memory statistics. Once the
+   * hidden tiles' buffers take more than MaximumHiddenTileGpuBytes, the
+   * buffers of the tiles hidden the longest, for at least
+   * HiddenFramesBeforeGpuEviction frames, are released. They are uploaded
+   * again from the CPU copy as soon as the tile is made visible or its
+   * collision is enabled. When StreamTextureMips is also enabled, the finer
+   * mips of those tiles' textures are dropped as well. Tiles built with
+   * Nanite are left alone.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintGetter = GetEvictHiddenTileGpuResources,
+      BlueprintSetter = SetEvictHiddenTileGpuResources,
+      Category = "Cesium|Tile Loading")
+  bool EvictHiddenTileGpuResources = false;
+
+  /**
+   * The maximum number of bytes of vertex and index buffers that hidden tiles
+   * may keep on the GPU when EvictHiddenTileGpuResources is enabled. This is
+   * separate from MaximumCachedBytes, which limits the size of the tile cache
+   * as a whole.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadWrite,
+      Category = "Cesium|Tile Loading",
+      meta = (ClampMin = 0, EditCondition = "EvictHiddenTileGpuResources"))
+  int64 MaximumHiddenTileGpuBytes = 128 * 1024 * 1024;
+
+  /**
+   * The number of frames that a tile must be hidden for before its GPU
+   * resources may be released when EvictHiddenTileGpuResources is enabled.
+   * This keeps tiles that flicker in and out of view, such as those at the
+   * edges of the screen while the camera turns, resident.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintReadWrite,
+      Category = "Cesium|Tile Loading",
+      meta = (ClampMin = 0, EditCondition = "EvictHiddenTileGpuResources"))
+  int32 HiddenFramesBeforeGpuEviction = 120;
+
   /**
    * The number of loading descendents a tile should allow before deciding to
    * render itself instead of waiting.
@@ -799,6 +936,22 @@ private:
       Category = "Cesium|Physics")
   bool CreatePhysicsMeshes = true;
 
+  /**
+   * Whether to build a bounding volume hierarchy over the triangles of each
+   * tile as it loads, so that the tileset can be picked with LineTraceTileset
+   * and PickFeature.
+   *
+   * These hierarchies are much cheaper to build than physics meshes, so this
+   * option is useful when picking is needed but collision is not. In that case,
+   * consider disabling CreatePhysicsMeshes.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintGetter = GetCreatePickingBvhs,
+      BlueprintSetter = SetCreatePickingBvhs,
+      Category = "Cesium|Picking")
+  bool CreatePickingBvhs = false;
+
   /**
    * Whether to generate navigation collisions for this tileset.
    *
@@ -883,6 +1036,170 @@ private:
       meta = (DisplayName = "Ignore KHR_materials_unlit"))
   bool IgnoreKhrMaterialsUnlit = false;
 
+  /**
+   * Whether to build Nanite resources for the triangle meshes in this tileset.
+   *
+   * Dense meshes, such as those found in photogrammetry tilesets, are good
+   * candidates for Nanite. When this property is true, Nanite data is built for
+   * each triangle primitive in a worker thread as the tile loads, which
+   * substantially reduces the cost of rasterizing dense tiles. Primitives that
+   * cannot be rendered with Nanite, such as points, lines, and translucent
+   * primitives, use the regular static mesh path.
+   *
+   * Building Nanite data requires Unreal's Nanite builder, which is only
+   * available in the Editor, as well as a platform that supports Nanite. When
+   * either is unavailable, this property has no effect.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintGetter = GetEnableNanite,
+      BlueprintSetter = SetEnableNanite,
+      Category = "Cesium|Rendering")
+  bool EnableNanite = false;
+
+  /**
+   * Whether to block-compress this tileset's uncompressed textures on a worker
+   * thread before they are uploaded to the GPU.
+   *
+   * Compressed textures take a quarter (for BC3) to an eighth (for BC1) of the
+   * GPU memory of uncompressed ones, so more tiles fit within the texture
+   * budget. Textures that are already GPU-compressed, such as KTX2 textures,
+   * are not affected, and neither are normal maps or textures holding feature
+   * IDs or metadata.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintGetter = GetTextureCompression,
+      BlueprintSetter = SetTextureCompression,
+      Category = "Cesium|Rendering")
+  ECesiumTextureCompression TextureCompression =
+      ECesiumTextureCompression::None;
+
+  /**
+   * Whether to stream the mips of this tileset's textures based on how large
+   * their tiles are on screen.
+   *
+   * When enabled, only the mips of 64x64 texels or smaller are uploaded when a
+   * tile loads, and finer mips are uploaded as the tile is viewed more
+   * closely. The full mip chain, including the mips on the GPU, is kept in
+   * CPU memory while a texture is in use, so that mips can be uploaded again
+   * later. When the streamed mips of all tilesets exceed the Texture Streaming
+   * Budget in the Cesium project settings, mips finer than their tiles
+   * currently need are dropped from GPU memory. Block-compressed textures
+   * whose size isn't a power of two keep every mip down to the coarsest one
+   * that is a whole number of blocks across.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintGetter = GetStreamTextureMips,
+      BlueprintSetter = SetStreamTextureMips,
+      Category = "Cesium|Rendering")
+  bool StreamTextureMips = false;
+
+  /**
+   * Whether to release the glTF vertex, index, and encoded image buffers of
+   * each tile once its Unreal meshes and textures have been created.
+   *
+   * By default, a copy of each tile's glTF is retained on the CPU even though
+   * the renderer has its own copy. Enabling this option substantially reduces
+   * the memory used by a tileset. Picking and metadata queries continue to
+   * work, because a compact copy of the positions, indices, and texture
+   * coordinates needed for them is kept for each primitive, and buffers that
+   * hold metadata are never released.
+   *
+   * Buffers are always retained for tilesets with raster overlays, because the
+   * vertex data is needed to upsample tiles. Adding a raster overlay to a
+   * tileset whose tiles have already released their buffers reloads the
+   * tileset. Height queries, such as
+   * SampleHeightMostDetailed, cannot be answered for tiles whose buffers have
+   * been released.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintGetter = GetReleaseGltfBuffersAfterLoad,
+      BlueprintSetter = SetReleaseGltfBuffersAfterLoad,
+      Category = "Cesium|Rendering")
+  bool ReleaseGltfBuffersAfterLoad = false;
+
+  /**
+   * Whether primitives whose materials have the same base material and the
+   * same parameter values should share a single dynamic material instance.
+   *
+   * Sharing reduces the number of material instances, and the memory and
+   * render thread work they require, for tilesets with many untextured or
+   * identically-textured primitives. A primitive is given its own copy of the
+   * instance as soon as it needs different parameter values.
+   *
+   * Material instances are not shared when a lifecycle event receiver is
+   * registered, when the tileset has raster overlays, or when LOD transitions
+   * are enabled, because every primitive would then need its own instance
+   * anyway.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintGetter = GetShareMaterialInstances,
+      BlueprintSetter = SetShareMaterialInstances,
+      Category = "Cesium|Rendering")
+  bool ShareMaterialInstances = false;
+
+  /**
+   * Whether to pack this tileset's raster overlay tiles into large, shared
+   * atlas textures rather than giving each one its own texture.
+   *
+   * This reduces the number of textures, and the number of different textures
+   * bound by the tiles' materials, when there are many small tiles or several
+   * overlays. Each tile's rectangle in its atlas is passed to the material
+   * through the overlay's existing translation and scale parameters.
+   *
+   * Each tile is padded with copies of its edge texels, so that filtering at
+   * its edges matches a texture of its own. The padding is 16 texels on each
+   * side of mipmapped tiles and 1 texel otherwise, and the padded size is
+   * rounded up to a multiple of 64 texels for mipmapped tiles and 4 texels
+   * otherwise, so that every mip holds whole compressed blocks. A mipmapped
+   * 256x256 tile therefore takes 320x320 texels of its atlas, about 1.6 times
+   * its own area, while one without mipmaps takes 260x260 texels. Overlay tiles
+   * that are larger than 4096x4096 texels once padded, or that are already
+   * compressed or mipmapped when loaded, get their own textures as usual.
+   * Mipmapped atlases have only five mips, so distant tiles may alias more than
+   * they would otherwise. Because neighboring tiles share a texture, overlays
+   * should cover the whole tileset, as sampling well outside of a tile's
+   * rectangle returns its neighbors rather than its clamped edge.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintGetter = GetEnableRasterOverlayAtlas,
+      BlueprintSetter = SetEnableRasterOverlayAtlas,
+      Category = "Cesium|Rendering")
+  bool EnableRasterOverlayAtlas = false;
+
+  /**
+   * Whether to blend this tileset's raster overlays into a single texture per
+   * tile, rather than having the material sample and blend each overlay's
+   * layer for every pixel.
+   *
+   * Adjacent material layers whose overlays use the same texture coordinates
+   * are composited on the GPU whenever one of their overlay tiles changes, in
+   * the order of the layers in the material. The result is bound to the
+   * bottom-most of those layers, and the others are given a transparent
+   * texture. Overlays whose renderer options are marked as dynamic, such as
+   * polygon overlays used for clipping, are left as their own layers, as are
+   * layers that don't belong to an overlay.
+   *
+   * This takes an extra texture per tile, but greatly reduces the number of
+   * texture samples per pixel when several overlays are shown. Composites are
+   * resampled with bilinear filtering at the resolution of the most detailed
+   * overlay tile, but are never larger than the viewport. They are rebuilt
+   * when the viewport grows, and overlays aren't composited until the tileset
+   * has been updated with a camera. Their memory is counted toward
+   * MaximumCachedBytes.
+   */
+  UPROPERTY(
+      EditAnywhere,
+      BlueprintGetter = GetCompositeRasterOverlays,
+      BlueprintSetter = SetCompositeRasterOverlays,
+      Category = "Cesium|Rendering")
+  bool CompositeRasterOverlays = false;
+
   /**
    * A custom Material to use to render opaque elements in this tileset, in
    * order to implement custom visual effects.
@@ -1001,6 +1318,15 @@ public:
   UFUNCTION(BlueprintGetter, Category = "Cesium")
   float GetLoadProgress() const { return LoadProgress; }
 
+  /**
+   * Gets the memory used by the currently-loaded tiles of this tileset, broken
+   * down by category. Textures that several tiles share are counted once.
+   */
+  UFUNCTION(BlueprintPure, Category = "Cesium")
+  FCesium3DTilesetMemoryStatistics GetMemoryStatistics() const {
+    return this->_memoryStatistics;
+  }
+
   UFUNCTION(BlueprintGetter, Category = "Cesium")
   bool GetUseLodTransitions() const { return UseLodTransitions; }
 
@@ -1095,6 +1421,12 @@ public:
   UFUNCTION(BlueprintSetter, Category = "Cesium|Physics")
   void SetCreatePhysicsMeshes(bool bCreatePhysicsMeshes);
 
+  UFUNCTION(BlueprintGetter, Category = "Cesium|Picking")
+  bool GetCreatePickingBvhs() const { return CreatePickingBvhs; }
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium|Picking")
+  void SetCreatePickingBvhs(bool bCreatePickingBvhs);
+
   UFUNCTION(BlueprintGetter, Category = "Cesium|Navigation")
   bool GetCreateNavCollision() const { return CreateNavCollision; }
 
@@ -1124,6 +1456,60 @@ public:
   UFUNCTION(BlueprintSetter, Category = "Cesium|Rendering")
   void SetIgnoreKhrMaterialsUnlit(bool bIgnoreKhrMaterialsUnlit);
 
+  UFUNCTION(BlueprintGetter, Category = "Cesium|Rendering")
+  bool GetEnableNanite() const { return EnableNanite; }
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium|Rendering")
+  void SetEnableNanite(bool bEnableNanite);
+
+  UFUNCTION(BlueprintGetter, Category = "Cesium|Rendering")
+  ECesiumTextureCompression GetTextureCompression() const {
+    return TextureCompression;
+  }
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium|Rendering")
+  void SetTextureCompression(ECesiumTextureCompression NewCompression);
+
+  UFUNCTION(BlueprintGetter, Category = "Cesium|Tile Loading")
+  bool GetEvictHiddenTileGpuResources() const {
+    return EvictHiddenTileGpuResources;
+  }
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium|Tile Loading")
+  void SetEvictHiddenTileGpuResources(bool bEvictHiddenTileGpuResources);
+
+  UFUNCTION(BlueprintGetter, Category = "Cesium|Rendering")
+  bool GetStreamTextureMips() const { return StreamTextureMips; }
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium|Rendering")
+  void SetStreamTextureMips(bool bStreamTextureMips);
+
+  UFUNCTION(BlueprintGetter, Category = "Cesium|Rendering")
+  bool GetReleaseGltfBuffersAfterLoad() const {
+    return ReleaseGltfBuffersAfterLoad;
+  }
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium|Rendering")
+  void SetReleaseGltfBuffersAfterLoad(bool bReleaseGltfBuffersAfterLoad);
+
+  UFUNCTION(BlueprintGetter, Category = "Cesium|Rendering")
+  bool GetShareMaterialInstances() const { return ShareMaterialInstances; }
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium|Rendering")
+  void SetShareMaterialInstances(bool bShareMaterialInstances);
+
+  UFUNCTION(BlueprintGetter, Category = "Cesium|Rendering")
+  bool GetEnableRasterOverlayAtlas() const { return EnableRasterOverlayAtlas; }
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium|Rendering")
+  void SetEnableRasterOverlayAtlas(bool bEnableRasterOverlayAtlas);
+
+  UFUNCTION(BlueprintGetter, Category = "Cesium|Rendering")
+  bool GetCompositeRasterOverlays() const { return CompositeRasterOverlays; }
+
+  UFUNCTION(BlueprintSetter, Category = "Cesium|Rendering")
+  void SetCompositeRasterOverlays(bool bCompositeRasterOverlays);
+
   UFUNCTION(BlueprintGetter, Category = "Cesium|Rendering")
   UMaterialInterface* GetMaterial() const { return Material; }
 
@@ -1192,6 +1578,101 @@ public:
     return this->_featuresMetadataDescription;
   }
 
+  /**
+   * Gets the pool of objects that can be reused by newly-loaded tiles, or
+   * nullptr if EnableTileObjectPooling is false.
+   */
+  CesiumTileObjectPool* getTileObjectPool() const {
+    return this->_pTileObjectPool.Get();
+  }
+
+  /**
+   * Applies the raster overlay changes recorded on the given tile. While the
+   * tileset is being updated, this is deferred until the update is complete,
+   * so that all of a tile's changes in a frame update its materials at once.
+   */
+  void scheduleRasterTileUpdates(UCesiumGltfComponent& gltf);
+
+  /**
+   * Gets the cache of the material parameter names of this tileset's raster
+   * overlays.
+   */
+  CesiumRasterOverlayParameterNameCache& getRasterOverlayParameterNameCache();
+
+  /**
+   * Gets the width or height, whichever is larger, of the largest viewport
+   * that this tileset was last updated for, in pixels. This is 0.0 until the
+   * tileset has been updated with at least one camera.
+   */
+  double getLargestViewportSize() const { return this->_largestViewportSize; }
+
+  /**
+   * Gets the cache of material instances shared between primitives, or
+   * nullptr if ShareMaterialInstances is false.
+   */
+  const TSharedPtr<CesiumMaterialInstanceCache>&
+  getMaterialInstanceCache() const {
+    return this->_pMaterialInstanceCache;
+  }
+
+  /**
+   * Gets the atlas that raster overlay tiles are packed into, or nullptr if
+   * EnableRasterOverlayAtlas is false.
+   */
+  const TSharedPtr<CesiumRasterOverlayAtlas>& getRasterOverlayAtlas() const {
+    return this->_pRasterOverlayAtlas;
+  }
+
+  /**
+   * Records that a loaded tile has released its glTF buffers, because
+   * ReleaseGltfBuffersAfterLoad is true and the tileset had no raster overlays
+   * when the tile was loaded.
+   */
+  void notifyGltfBuffersReleased() { this->_gltfBuffersReleased = true; }
+
+  /**
+   * Whether any tile of the current tileset has released its glTF buffers.
+   * Raster overlays can't be upsampled onto such tiles, so a raster overlay
+   * that is added to the tileset reloads it instead.
+   */
+  bool hasReleasedGltfBuffers() const { return this->_gltfBuffersReleased; }
+
+  /**
+   * Adds the streamed textures of a loaded tile to the textures whose mips
+   * this tileset streams. Textures shared by several tiles are only streamed
+   * once.
+   */
+  void registerStreamedTextures(
+      const TArray<TSharedPtr<FCesiumStreamedTextureResource>>& textures);
+
+  /**
+   * Removes the streamed textures of a tile that is being destroyed from the
+   * textures whose mips this tileset streams, unless other tiles still use
+   * them.
+   */
+  void unregisterStreamedTextures(
+      const TArray<TSharedPtr<FCesiumStreamedTextureResource>>& textures);
+
+  /**
+   * Adds the memory used by the shared textures of a loaded tile to this
+   * tileset's memory statistics. Textures shared by several of the tileset's
+   * tiles are only counted once. Their memory is reported by the texture
+   * cache's stats rather than by the tile stats.
+   */
+  void registerSharedTextures(
+      const TMap<
+          TSharedPtr<FCesiumTextureResource>,
+          FCesium3DTilesetMemoryStatistics>& textures);
+
+  /**
+   * Removes the shared textures of a tile that is being unloaded from this
+   * tileset's memory statistics, unless other tiles still use them.
+   */
+  void unregisterSharedTextures(
+      const TMap<
+          TSharedPtr<FCesiumTextureResource>,
+          FCesium3DTilesetMemoryStatistics>& textures);
+
   // AActor overrides (some or most of them should be protected)
   virtual bool ShouldTickIfViewportsOnly() const override;
   virtual void Tick(float DeltaTime) override;
@@ -1292,6 +1773,18 @@ private:
    */
   void updateTilesetOptionsFromProperties();
 
+  /**
+   * Creates, resizes, or destroys the tile object pool to match the
+   * EnableTileObjectPooling and MaximumPooledObjects properties.
+   */
+  void updateTileObjectPoolFromProperties();
+
+  /**
+   * Applies the raster overlay changes of the tiles passed to
+   * scheduleRasterTileUpdates while the tileset was being updated.
+   */
+  void applyScheduledRasterTileUpdates();
+
   /**
    * Update all the "_last..." fields of this instance based
    * on the given ViewUpdateResult, printing a log message
@@ -1311,6 +1804,26 @@ private:
   void showTilesToRender(
       const std::vector<Cesium3DTilesSelection::Tile::ConstPointer>& tiles);
 
+  /**
+   * Requests the texture mips needed to draw the given tiles at their size in
+   * the given views, and then uploads or drops the streamed mips of all of this
+   * tileset's loaded tiles to match.
+   *
+   * @param frustums The views from which the tiles were selected.
+   * @param tiles The tiles rendered this frame.
+   */
+  void updateTextureStreaming(
+      const std::vector<Cesium3DTilesSelection::ViewState>& frustums,
+      const std::vector<Cesium3DTilesSelection::Tile::ConstPointer>& tiles);
+
+  /**
+   * Releases the GPU vertex and index buffers of the tiles that have been
+   * hidden the longest, until the buffers of the hidden tiles fit in
+   * MaximumHiddenTileGpuBytes. Call this after the tiles to render this frame
+   * have been shown.
+   */
+  void evictHiddenTileGpuResources();
+
   /**
    * Will be called after the tileset is loaded or spawned, to register
    * a delegate that calls OnFocusEditorViewportOnThis when this
@@ -1351,6 +1864,53 @@ private:
   std::optional<FMetadataDescription> _metadataDescription_DEPRECATED;
   PRAGMA_ENABLE_DEPRECATION_WARNINGS
 
+  // The sum of the memory statistics of all loaded tiles. This is maintained
+  // by UnrealPrepareRendererResources as tiles are loaded and unloaded.
+  FCesium3DTilesetMemoryStatistics _memoryStatistics;
+
+  // Created and destroyed in Tick according to EnableTileObjectPooling.
+  TSharedPtr<CesiumTileObjectPool> _pTileObjectPool;
+
+  // Tiles with raster overlay changes that are waiting for the current update
+  // to finish. A tile may appear more than once.
+  TArray<TWeakObjectPtr<UCesiumGltfComponent>> _tilesWithRasterTileUpdates;
+  bool _deferRasterTileUpdates = false;
+
+  // Created the first time that a tile attaches a raster overlay, and kept for
+  // the lifetime of the actor. Overlays remove their names from it when they
+  // are removed from the tileset.
+  TSharedPtr<CesiumRasterOverlayParameterNameCache>
+      _pRasterOverlayParameterNames;
+
+  // The larger dimension of the largest viewport in the last update, which
+  // bounds the size of raster overlay composites.
+  double _largestViewportSize = 0.0;
+
+  // Whether any tile of the current tileset has released its glTF buffers.
+  // This is reset when the tileset is destroyed.
+  bool _gltfBuffersReleased = false;
+
+  // The streamed textures of this tileset's tiles, including hidden ones, with
+  // the number of tiles using each. Streaming updates these textures rather
+  // than visiting every tile.
+  TMap<TSharedPtr<FCesiumStreamedTextureResource>, int32>
+      _streamedTextureTileCounts;
+
+  // The textures that this tileset's tiles share through the texture cache,
+  // with the number of tiles using each. Their memory is counted in
+  // _memoryStatistics while any tile uses them.
+  TMap<TSharedPtr<FCesiumTextureResource>, int32> _sharedTextureTileCounts;
+
+  // Created when the tileset is loaded if ShareMaterialInstances is true.
+  // Primitives that use its instances keep it alive after the tileset is
+  // destroyed.
+  TSharedPtr<CesiumMaterialInstanceCache> _pMaterialInstanceCache;
+
+  // Created when the tileset is loaded if EnableRasterOverlayAtlas is true.
+  // The tileset's renderer resources keep it alive until its last raster
+  // overlay tile is freed.
+  TSharedPtr<CesiumRasterOverlayAtlas> _pRasterOverlayAtlas;
+
   // For debug output
   uint32_t _lastTilesRendered;
   uint32_t _lastWorkerThreadTileLoadQueueLength;
@@ -0,0 +1,118 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Cesium3DTilesetMemoryStatistics.generated.h"
+
+/**
+ * The number of bytes used by the loaded tiles of a tileset, broken down by
+ * category. These are estimates of the memory used by the Unreal resources
+ * that were created for the tiles, as well as the glTF data that is retained on
+ * the CPU after those resources are created.
+ */
+USTRUCT(BlueprintType)
+struct CESIUMRUNTIME_API FCesium3DTilesetMemoryStatistics {
+  GENERATED_BODY()
+
+  /**
+   * The number of bytes used by the vertex buffers of tile meshes. This
+   * includes positions, normals, tangents, texture coordinates, and vertex
+   * colors.
+   */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Cesium")
+  int64 VertexBufferBytes = 0;
+
+  /**
+   * The number of bytes used by the index buffers of tile meshes.
+   */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Cesium")
+  int64 IndexBufferBytes = 0;
+
+  /**
+   * The number of bytes of vertex and index buffer data that is also kept on
+   * the CPU, so that the buffers of hidden tiles can be evicted from the GPU
+   * and uploaded again later. This is only nonzero when
+   * EvictHiddenTileGpuResources is enabled on the tileset.
+   */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Cesium")
+  int64 MeshCpuCopyBytes = 0;
+
+  /**
+   * The number of bytes used by the material textures of tile meshes, such as
+   * base color and normal textures. Raster overlay textures are not included.
+   *
+   * Textures with identical pixels are shared between tiles, and even between
+   * tilesets. A tileset counts each shared texture once, however many of its
+   * tiles use it. They are reported by the "Cached Image Texture Memory"
+   * stat rather than the "Tile Textures" stat.
+   */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Cesium")
+  int64 TextureBytes = 0;
+
+  /**
+   * The number of bytes used by textures that encode feature IDs and metadata
+   * for access in Unreal materials. Like other textures, these may be shared
+   * between tiles, and are then counted once per tileset.
+   */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Cesium")
+  int64 EncodedMetadataTextureBytes = 0;
+
+  /**
+   * The number of bytes used by the Chaos triangle meshes used for collision,
+   * and by the bounding volume hierarchies used for picking.
+   */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Cesium")
+  int64 CollisionMeshBytes = 0;
+
+  /**
+   * The number of bytes of glTF buffer and image data that are still held on
+   * the CPU after the tiles' Unreal resources have been created.
+   */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Cesium")
+  int64 GltfCpuBytes = 0;
+
+  /**
+   * The number of bytes used by the render targets that raster overlays are
+   * composited into, including their mipmaps. This is only nonzero when
+   * CompositeRasterOverlays is enabled on the tileset.
+   */
+  UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Cesium")
+  int64 RasterOverlayCompositeBytes = 0;
+
+  /**
+   * Gets the total number of bytes across all categories.
+   */
+  int64 GetTotalBytes() const {
+    return VertexBufferBytes + IndexBufferBytes + MeshCpuCopyBytes +
+           TextureBytes +
+           EncodedMetadataTextureBytes + CollisionMeshBytes + GltfCpuBytes +
+           RasterOverlayCompositeBytes;
+  }
+
+  FCesium3DTilesetMemoryStatistics&
+  operator+=(const FCesium3DTilesetMemoryStatistics& rhs) {
+    VertexBufferBytes += rhs.VertexBufferBytes;
+    IndexBufferBytes += rhs.IndexBufferBytes;
+    MeshCpuCopyBytes += rhs.MeshCpuCopyBytes;
+    TextureBytes += rhs.TextureBytes;
+    EncodedMetadataTextureBytes += rhs.EncodedMetadataTextureBytes;
+    CollisionMeshBytes += rhs.CollisionMeshBytes;
+    GltfCpuBytes += rhs.GltfCpuBytes;
+    RasterOverlayCompositeBytes += rhs.RasterOverlayCompositeBytes;
+    return *this;
+  }
+
+  FCesium3DTilesetMemoryStatistics&
+  operator-=(const FCesium3DTilesetMemoryStatistics& rhs) {
+    VertexBufferBytes -= rhs.VertexBufferBytes;
+    IndexBufferBytes -= rhs.IndexBufferBytes;
+    MeshCpuCopyBytes -= rhs.MeshCpuCopyBytes;
+    TextureBytes -= rhs.TextureBytes;
+    EncodedMetadataTextureBytes -= rhs.EncodedMetadataTextureBytes;
+    CollisionMeshBytes -= rhs.CollisionMeshBytes;
+    GltfCpuBytes -= rhs.GltfCpuBytes;
+    RasterOverlayCompositeBytes -= rhs.RasterOverlayCompositeBytes;
+    return *this;
+  }
+};
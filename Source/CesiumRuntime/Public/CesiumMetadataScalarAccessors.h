@@ -0,0 +1,113 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "HAL/Platform.h"
+#include "Math/Vector2D.h"
+
+#include <CesiumGltf/MetadataConversions.h>
+#include <CesiumGltf/PropertyTexturePropertyView.h>
+#include <any>
+#include <optional>
+
+/**
+ * A table of functions that get a value of a metadata property, converted to
+ * one of the scalar types most often requested from it.
+ *
+ * The metadata property structs hold their property view in a `std::any`, and
+ * their Blueprint libraries must find out what type of view it is before every
+ * access. Since the type of the view is known when a property is constructed,
+ * the property picks the table for that type then, so that these getters call
+ * straight into the code for it.
+ *
+ * @tparam TKey The type that identifies the value to get, such as a feature ID
+ * or a texture coordinate.
+ */
+template <typename TKey> struct TCesiumMetadataScalarAccessors {
+  int32 (*getInteger)(const std::any& property, TKey key, int32 defaultValue);
+  int64 (*getInteger64)(
+      const std::any& property,
+      TKey key,
+      int64 defaultValue);
+  float (*getFloat)(const std::any& property, TKey key, float defaultValue);
+  double (*getFloat64)(
+      const std::any& property,
+      TKey key,
+      double defaultValue);
+};
+
+namespace CesiumMetadataScalarAccessors {
+
+/**
+ * Looks up a value of a property table or property attribute property view by
+ * its index, which is a feature ID or a vertex index.
+ */
+struct IndexLookup {
+  using Key = int64;
+
+  template <typename TView>
+  static auto get(const TView& view, int64 index)
+      -> decltype(view.get(index)) {
+    // size() returns zero if the view is invalid.
+    if (index < 0 || index >= view.size()) {
+      return std::nullopt;
+    }
+    return view.get(index);
+  }
+};
+
+/**
+ * Looks up a value of a property texture property view by its texture
+ * coordinates.
+ */
+struct UVLookup {
+  using Key = const FVector2D&;
+
+  template <typename TView>
+  static auto get(const TView& view, const FVector2D& uv)
+      -> decltype(view.get(uv.X, uv.Y)) {
+    if (view.status() != CesiumGltf::PropertyTexturePropertyViewStatus::Valid) {
+      return std::nullopt;
+    }
+    return view.get(uv.X, uv.Y);
+  }
+};
+
+/**
+ * The accessors for a given type of property view.
+ *
+ * @tparam TView The type of the property view.
+ * @tparam Lookup The way to look up a value in the view, such as
+ * {@link IndexLookup}.
+ */
+template <typename TView, typename Lookup> struct Table {
+  using Key = typename Lookup::Key;
+
+  template <typename TResult, typename TConversion = TResult>
+  static TResult get(const std::any& property, Key key, TResult defaultValue) {
+    // The property only uses this table if its view has this type.
+    const TView* pView = std::any_cast<TView>(&property);
+    if (!pView) {
+      return defaultValue;
+    }
+
+    auto maybeValue = Lookup::get(*pView, key);
+    if (!maybeValue) {
+      return defaultValue;
+    }
+
+    auto value = *maybeValue;
+    return TResult(
+        CesiumGltf::MetadataConversions<TConversion, decltype(value)>::convert(
+            value)
+            .value_or(TConversion(defaultValue)));
+  }
+
+  static constexpr TCesiumMetadataScalarAccessors<Key> Accessors{
+      &get<int32>,
+      &get<int64, int64_t>,
+      &get<float>,
+      &get<double>};
+};
+
+} // namespace CesiumMetadataScalarAccessors
@@ -59,12 +59,24 @@ struct CESIUMRUNTIME_API FCesiumPointCloudShading {
       meta = (ClampMin = 0.0))
   float BaseResolution = 0.0f;
 
+  /**
+   * Whether or not to draw fewer points from a tile when its points are so
+   * dense on screen that they are less than a pixel apart. The points of each
+   * tile are sorted as it loads so that any subset of them drawn this way
+   * still covers the whole tile.
+   *
+   * Changing this property reloads the tileset.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cesium")
+  bool Decimation = false;
+
   bool
   operator==(const FCesiumPointCloudShading& OtherPointCloudShading) const {
     return Attenuation == OtherPointCloudShading.Attenuation &&
            GeometricErrorScale == OtherPointCloudShading.GeometricErrorScale &&
            MaximumAttenuation == OtherPointCloudShading.MaximumAttenuation &&
-           BaseResolution == OtherPointCloudShading.BaseResolution;
+           BaseResolution == OtherPointCloudShading.BaseResolution &&
+           Decimation == OtherPointCloudShading.Decimation;
   }
 
   bool
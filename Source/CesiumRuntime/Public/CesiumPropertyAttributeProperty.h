@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CesiumMetadataEnum.h"
+#include "CesiumMetadataScalarAccessors.h"
 #include "CesiumMetadataValue.h"
 #include "CesiumMetadataValueType.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
@@ -121,6 +122,9 @@ public:
 
     _valueType = TypeToMetadataValueType<T>(EnumDefinition);
     _normalized = Normalized;
+    _pScalarAccessors = &CesiumMetadataScalarAccessors::Table<
+        CesiumGltf::PropertyAttributePropertyView<T, Normalized>,
+        CesiumMetadataScalarAccessors::IndexLookup>::Accessors;
   }
 
 private:
@@ -132,6 +136,10 @@ private:
   bool _normalized;
   TSharedPtr<FCesiumMetadataEnum> _pEnumDefinition;
 
+  // The getters for the scalar types most often requested from this property,
+  // or nullptr if the property is invalid.
+  const TCesiumMetadataScalarAccessors<int64>* _pScalarAccessors = nullptr;
+
   friend class UCesiumPropertyAttributePropertyBlueprintLibrary;
 };
 
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CesiumMetadataEnum.h"
+#include "CesiumMetadataScalarAccessors.h"
 #include "CesiumMetadataValue.h"
 #include "CesiumMetadataValueType.h"
 #include "CesiumPropertyArray.h"
@@ -12,6 +13,8 @@
 #include <CesiumGltf/PropertyTablePropertyView.h>
 #include <CesiumGltf/PropertyTypeTraits.h>
 #include <any>
+#include <span>
+#include <string>
 
 #include "CesiumPropertyTableProperty.generated.h"
 
@@ -33,6 +36,36 @@ enum class ECesiumPropertyTablePropertyStatus : uint8 {
   ErrorInvalidPropertyData
 };
 
+/**
+ * The glTF data that a property table property's values are read from.
+ */
+struct FCesiumPropertyTablePropertySource {
+  /**
+   * The data of the buffer view with the property's values.
+   */
+  std::span<const std::byte> values;
+
+  /**
+   * The data of the buffer view with the property's array offsets, if any.
+   */
+  std::span<const std::byte> arrayOffsets;
+
+  /**
+   * The data of the buffer view with the property's string offsets, if any.
+   */
+  std::span<const std::byte> stringOffsets;
+
+  /**
+   * The type of the array offsets, as specified in the glTF.
+   */
+  std::string arrayOffsetType;
+
+  /**
+   * The type of the string offsets, as specified in the glTF.
+   */
+  std::string stringOffsetType;
+};
+
 /**
  * A Blueprint-accessible wrapper for a glTF property table property in
  * EXT_structural_metadata. A property has a specific type, such as int64 scalar
@@ -112,6 +145,9 @@ public:
 
     _valueType = TypeToMetadataValueType<T>(pEnumDefinition);
     _normalized = Normalized;
+    _pScalarAccessors = &CesiumMetadataScalarAccessors::Table<
+        CesiumGltf::PropertyTablePropertyView<T, Normalized>,
+        CesiumMetadataScalarAccessors::IndexLookup>::Accessors;
   }
 
 private:
@@ -123,7 +159,16 @@ private:
   bool _normalized;
   TSharedPtr<FCesiumMetadataEnum> _pEnumDefinition;
 
+  // The getters for the scalar types most often requested from this property,
+  // or nullptr if the property is invalid.
+  const TCesiumMetadataScalarAccessors<int64>* _pScalarAccessors = nullptr;
+
+  // The glTF data that this property's values are read from. This is empty
+  // for properties that weren't created by an FCesiumPropertyTable.
+  FCesiumPropertyTablePropertySource _source;
+
   friend class UCesiumPropertyTablePropertyBlueprintLibrary;
+  friend struct FCesiumPropertyTable;
 };
 
 UCLASS()
@@ -561,6 +606,186 @@ public:
       int64 FeatureID,
       double DefaultValue = 0.0);
 
+  /**
+   * Retrieves the values of a range of consecutive features as 32-bit signed
+   * integers. Each value is converted as by {@link GetInteger}, but the
+   * property's type is only resolved once for all of them, which is much
+   * faster than calling GetInteger for each feature.
+   *
+   * If a feature ID is out-of-range, or if the property table property is
+   * somehow invalid, the user-defined default value is used for it.
+   *
+   * @param Property The property table property.
+   * @param FirstFeatureID The ID of the first feature.
+   * @param Count The number of features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The values of the features, in order of their IDs.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<int32> GetIntegerValues(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      int64 FirstFeatureID,
+      int32 Count,
+      int32 DefaultValue = 0);
+
+  /**
+   * Retrieves the values of the given features as 32-bit signed integers.
+   * Each value is converted as by {@link GetInteger}, but the property's type
+   * is only resolved once for all of them.
+   *
+   * If a feature ID is out-of-range, or if the property table property is
+   * somehow invalid, the user-defined default value is used for it.
+   *
+   * @param Property The property table property.
+   * @param FeatureIDs The IDs of the features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The values of the features, in the same order as their IDs.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<int32> GetIntegerValuesForFeatures(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      const TArray<int64>& FeatureIDs,
+      int32 DefaultValue = 0);
+
+  /**
+   * Retrieves the values of a range of consecutive features as 64-bit signed
+   * integers. Each value is converted as by {@link GetInteger64}, but the
+   * property's type is only resolved once for all of them, which is much
+   * faster than calling GetInteger64 for each feature.
+   *
+   * If a feature ID is out-of-range, or if the property table property is
+   * somehow invalid, the user-defined default value is used for it.
+   *
+   * @param Property The property table property.
+   * @param FirstFeatureID The ID of the first feature.
+   * @param Count The number of features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The values of the features, in order of their IDs.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<int64> GetInteger64Values(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      int64 FirstFeatureID,
+      int32 Count,
+      int64 DefaultValue = 0);
+
+  /**
+   * Retrieves the values of the given features as 64-bit signed integers.
+   * Each value is converted as by {@link GetInteger64}, but the property's
+   * type is only resolved once for all of them.
+   *
+   * If a feature ID is out-of-range, or if the property table property is
+   * somehow invalid, the user-defined default value is used for it.
+   *
+   * @param Property The property table property.
+   * @param FeatureIDs The IDs of the features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The values of the features, in the same order as their IDs.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<int64> GetInteger64ValuesForFeatures(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      const TArray<int64>& FeatureIDs,
+      int64 DefaultValue = 0);
+
+  /**
+   * Retrieves the values of a range of consecutive features as single-
+   * precision floating-point numbers. Each value is converted as by {@link
+   * GetFloat}, but the property's type is only resolved once for all of them,
+   * which is much faster than calling GetFloat for each feature.
+   *
+   * If a feature ID is out-of-range, or if the property table property is
+   * somehow invalid, the user-defined default value is used for it.
+   *
+   * @param Property The property table property.
+   * @param FirstFeatureID The ID of the first feature.
+   * @param Count The number of features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The values of the features, in order of their IDs.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<float> GetFloatValues(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      int64 FirstFeatureID,
+      int32 Count,
+      float DefaultValue = 0.0f);
+
+  /**
+   * Retrieves the values of the given features as single-precision floating-
+   * point numbers. Each value is converted as by {@link GetFloat}, but the
+   * property's type is only resolved once for all of them.
+   *
+   * If a feature ID is out-of-range, or if the property table property is
+   * somehow invalid, the user-defined default value is used for it.
+   *
+   * @param Property The property table property.
+   * @param FeatureIDs The IDs of the features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The values of the features, in the same order as their IDs.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<float> GetFloatValuesForFeatures(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      const TArray<int64>& FeatureIDs,
+      float DefaultValue = 0.0f);
+
+  /**
+   * Retrieves the values of a range of consecutive features as double-
+   * precision floating-point numbers. Each value is converted as by {@link
+   * GetFloat64}, but the property's type is only resolved once for all of
+   * them, which is much faster than calling GetFloat64 for each feature.
+   *
+   * If a feature ID is out-of-range, or if the property table property is
+   * somehow invalid, the user-defined default value is used for it.
+   *
+   * @param Property The property table property.
+   * @param FirstFeatureID The ID of the first feature.
+   * @param Count The number of features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The values of the features, in order of their IDs.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<double> GetFloat64Values(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      int64 FirstFeatureID,
+      int32 Count,
+      double DefaultValue = 0.0);
+
+  /**
+   * Retrieves the values of the given features as double-precision floating-
+   * point numbers. Each value is converted as by {@link GetFloat64}, but the
+   * property's type is only resolved once for all of them.
+   *
+   * If a feature ID is out-of-range, or if the property table property is
+   * somehow invalid, the user-defined default value is used for it.
+   *
+   * @param Property The property table property.
+   * @param FeatureIDs The IDs of the features.
+   * @param DefaultValue The default value to fall back on.
+   * @return The values of the features, in the same order as their IDs.
+   */
+  UFUNCTION(
+      BlueprintCallable,
+      Category = "Cesium|Metadata|PropertyTableProperty")
+  static TArray<double> GetFloat64ValuesForFeatures(
+      UPARAM(ref) const FCesiumPropertyTableProperty& Property,
+      const TArray<int64>& FeatureIDs,
+      double DefaultValue = 0.0);
+
   /**
    * Attempts to retrieve the value for the given feature as a FIntPoint.
    *
@@ -1040,6 +1265,63 @@ public:
       UPARAM(ref) const FCesiumPropertyTableProperty& Property,
       int64 FeatureID);
 
+  /**
+   * Copies the raw values of a scalar property for all features, converted
+   * as by {@link UCesiumMetadataValueBlueprintLibrary::GetFloat} with a default
+   * value of zero, into the given array. This is equivalent to, but much faster
+   * than, calling {@link GetRawValue} for each feature and converting the
+   * result.
+   *
+   * This is not available to Blueprints.
+   *
+   * @param Property The property table property.
+   * @param OutValues The array to copy the values into. It must have room for
+   * at least as many values as there are features.
+   * @return True if the values were copied, or false if the property is not a
+   * valid, non-empty scalar property, or the array is too small, in which case
+   * the array is left unchanged.
+   */
+  static bool GetRawFloatValues(
+      const FCesiumPropertyTableProperty& Property,
+      TArrayView<float> OutValues);
+
+  /**
+   * Copies the raw values of a scalar property for all features, converted
+   * as by {@link UCesiumMetadataValueBlueprintLibrary::GetByte} with a default
+   * value of zero, into the given array. This is equivalent to, but much faster
+   * than, calling {@link GetRawValue} for each feature and converting the
+   * result.
+   *
+   * This is not available to Blueprints.
+   *
+   * @param Property The property table property.
+   * @param OutValues The array to copy the values into. It must have room for
+   * at least as many values as there are features.
+   * @return True if the values were copied, or false if the property is not a
+   * valid, non-empty scalar property, or the array is too small, in which case
+   * the array is left unchanged.
+   */
+  static bool GetRawByteValues(
+      const FCesiumPropertyTableProperty& Property,
+      TArrayView<uint8> OutValues);
+
+  /**
+   * Gets the glTF data that the property's values are read from: the data of
+   * its buffer views and the types of its offsets. The data is empty for the
+   * buffer views that the property doesn't use. It is all empty if the
+   * property wasn't read from a glTF's property table.
+   *
+   * Properties with the same type and source data have the same values, even
+   * if they are in different glTFs.
+   *
+   * This is not available to Blueprints.
+   *
+   * @param Property The property table property.
+   * @return The property's source data.
+   */
+  static const FCesiumPropertyTablePropertySource&
+  GetSourceData(const FCesiumPropertyTableProperty& Property);
+
   /**
    * Whether this property is normalized. Only applicable when this property has
    * an integer component type.
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CesiumMetadataEnum.h"
+#include "CesiumMetadataScalarAccessors.h"
 #include "CesiumMetadataValue.h"
 #include "GenericPlatform/GenericPlatform.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
@@ -99,6 +100,9 @@ public:
 
     _valueType = TypeToMetadataValueType<T>(pEnumDefinition);
     _normalized = Normalized;
+    _pScalarAccessors = &CesiumMetadataScalarAccessors::Table<
+        CesiumGltf::PropertyTexturePropertyView<T, Normalized>,
+        CesiumMetadataScalarAccessors::UVLookup>::Accessors;
   }
 
   const int64 getTexCoordSetIndex() const;
@@ -116,6 +120,11 @@ private:
   bool _normalized;
   TSharedPtr<FCesiumMetadataEnum> _pEnumDefinition;
 
+  // The getters for the scalar types most often requested from this property,
+  // or nullptr if the property is invalid.
+  const TCesiumMetadataScalarAccessors<const FVector2D&>* _pScalarAccessors =
+      nullptr;
+
   friend class UCesiumPropertyTexturePropertyBlueprintLibrary;
 };
 
@@ -4,6 +4,7 @@
 
 #include "CesiumRasterOverlayLoadFailureDetails.h"
 #include "CesiumRasterOverlays/RasterOverlay.h"
+#include "CesiumTextureCompression.h"
 #include "CesiumUtility/IntrusivePointer.h"
 #include "Components/ActorComponent.h"
 #include "CoreMinimal.h"
@@ -27,6 +28,31 @@ DECLARE_MULTICAST_DELEGATE_OneParam(
 CESIUMRUNTIME_API extern FCesiumRasterOverlayLoadFailure
     OnCesiumRasterOverlayLoadFailure;
 
+/**
+ * The channels of a raster overlay's images that are kept in its textures.
+ */
+UENUM(BlueprintType)
+enum class ECesiumRasterOverlayChannels : uint8 {
+  /**
+   * Keep the red, green, blue, and alpha channels of the images.
+   */
+  RGBA,
+
+  /**
+   * Keep only the red and alpha channels of the images, which are stored in
+   * the red and green channels of an RG8 texture. This is suited to
+   * translucent single-channel data, such as masks with soft edges.
+   */
+  RG,
+
+  /**
+   * Keep only the red channel of the images, in an R8 texture. This is suited
+   * to opaque single-channel data, such as classifications or shading derived
+   * from elevation.
+   */
+  R
+};
+
 /**
  * This struct is passed through the raster overlay options and is used when
  * `prepareRasterInLoadThread` is called.
@@ -43,6 +69,48 @@ struct FRasterOverlayRendererOptions {
 
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cesium")
   bool useMipmaps = true;
+
+  /**
+   * Whether to block-compress raster tile images on a worker thread before
+   * they are uploaded to the GPU.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cesium")
+  ECesiumTextureCompression compression = ECesiumTextureCompression::None;
+
+  /**
+   * Whether to keep this overlay in its own material layer when the tileset
+   * composites its raster overlays into one texture per tile. This should be
+   * set for overlays whose tiles change often, and for overlays whose layers
+   * don't blend them as color, such as clipping masks.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cesium")
+  bool dynamic = false;
+
+  /**
+   * The channels of the overlay's images to upload to the GPU. Material layers
+   * that sample an overlay with fewer than four channels must read its value
+   * from the red channel and, for RG, its coverage from the green channel.
+   * The ML_CesiumRasterOverlay layer that ships with the plugin reads all four
+   * channels, so an overlay that one of the tileset's materials samples with
+   * it is uploaded as RGBA, and a warning is logged.
+   *
+   * The channels are removed on a worker thread as each raster tile loads,
+   * before its mipmaps are generated, so an RG or R overlay takes a half or a
+   * quarter of the memory of an RGBA one. Such overlays are never block-
+   * compressed, and are kept in their own material layers when the tileset
+   * composites its overlays.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cesium")
+  ECesiumRasterOverlayChannels channels = ECesiumRasterOverlayChannels::RGBA;
+
+  /**
+   * Whether the overlay's images hold sRGB-encoded color. This should be
+   * disabled for overlays that hold data rather than color, so that their
+   * values are neither converted when sampled nor when mipmaps are generated.
+   * It only applies to RGBA overlays; RG and R overlays are always linear.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cesium")
+  bool sRGB = true;
 };
 
 /**
@@ -259,4 +327,8 @@ private:
   CesiumUtility::IntrusivePointer<CesiumRasterOverlays::RasterOverlay>
       _pOverlay;
   int32 _overlaysBeingDestroyed;
+
+  // The renderer options that the overlay was added with, which are the
+  // rendererOptions property adjusted for the tileset's materials.
+  FRasterOverlayRendererOptions _resolvedRendererOptions;
 };
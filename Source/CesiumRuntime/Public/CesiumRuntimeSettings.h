@@ -45,6 +45,34 @@ public:
   UPROPERTY(Config, EditAnywhere, Category = "Experimental Feature Flags")
   bool EnableExperimentalOcclusionCullingFeature = false;
 
+  /**
+   * The maximum time, in milliseconds, to spend each frame finishing the
+   * destruction of the meshes, textures, and other objects of unloaded tiles.
+   * Objects that don't fit in the budget are finished in later frames, in the
+   * order they were unloaded. At least one object is always processed each
+   * frame. If this is zero, all pending objects are processed every frame.
+   */
+  UPROPERTY(
+      Config,
+      EditAnywhere,
+      Category = "Performance",
+      meta = (ClampMin = 0.0, Units = "Milliseconds"))
+  float TileDestructionTimeBudget = 2.0f;
+
+  /**
+   * The GPU memory, in megabytes, that the streamed mips of the textures of
+   * tilesets with Stream Texture Mips enabled may use. Beyond this, mips that
+   * are finer than their tiles currently need are dropped until they are
+   * needed again. Mips that are needed are always uploaded, even if that
+   * exceeds the budget.
+   */
+  UPROPERTY(
+      Config,
+      EditAnywhere,
+      Category = "Performance",
+      meta = (ClampMin = 0.0, Units = "Megabytes"))
+  float TextureStreamingBudget = 1024.0f;
+
   /**
    * The number of requests to handle before each prune of old cached results
    * from the database.
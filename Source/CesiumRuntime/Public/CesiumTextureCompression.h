@@ -0,0 +1,37 @@
+// Copyright 2020-2025 CesiumGS, Inc. and Contributors
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CesiumTextureCompression.generated.h"
+
+/**
+ * Controls whether uncompressed textures are block-compressed on a worker
+ * thread before they are uploaded to the GPU. Block-compressed textures use a
+ * quarter to an eighth of the GPU memory of uncompressed ones, at some cost in
+ * image quality and in load-thread time.
+ *
+ * Compression is only applied when the current RHI supports the BC1 and BC3
+ * (DXT1 and DXT5) pixel formats, and only to 8-bit RGBA images whose width and
+ * height are multiples of four. Other textures are uploaded uncompressed.
+ */
+UENUM(BlueprintType)
+enum class ECesiumTextureCompression : uint8 {
+  /**
+   * Upload textures uncompressed.
+   */
+  None,
+
+  /**
+   * Compress textures by fitting each block's endpoints to its bounding box.
+   * This is quick, but can introduce visible color banding.
+   */
+  Fast,
+
+  /**
+   * Compress textures by fitting each block's endpoints to the principal axis
+   * of its colors and then refining them. This takes several times longer
+   * than Fast, but gives noticeably better quality on smooth gradients.
+   */
+  HighQuality UMETA(DisplayName = "High quality")
+};